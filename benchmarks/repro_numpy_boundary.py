@@ -0,0 +1,73 @@
+"""Python boundary cost of numeric arrays and windows.
+
+Each cycle a Python compute node reads a 1,000-element float array (or a
+1,000-element float window) either as ``value`` (a NumPy copy) or as
+``value_view`` (a read-only view over the input storage), and sums it.
+The ``none`` variant reads nothing and measures the rest of the graph.
+A full window is one contiguous run only when its ring has not wrapped,
+so on the window shape ``value_view`` mostly falls back to the copy.
+
+Run: ``uv run python benchmarks/repro_numpy_boundary.py
+[value,value_view,none] [array,window]``.
+"""
+import sys
+import time
+
+import numpy as np
+
+import hgraph as hg
+from hgraph import TS, TSW, Array, Size, WindowSize, compute_node, generator, graph, null_sink, to_window
+
+variant = sys.argv[1] if len(sys.argv) > 1 else "value_view"
+shape = sys.argv[2] if len(sys.argv) > 2 else "array"
+if variant not in {"value", "value_view", "none"}:
+    raise ValueError(f"unknown read variant: {variant}")
+if shape not in {"array", "window"}:
+    raise ValueError(f"unknown input shape: {shape}")
+
+ELEMENTS, CYCLES = 1000, 20000
+PAYLOAD = np.arange(ELEMENTS, dtype=np.float64)
+
+
+@generator
+def arrays() -> TS[Array[float, Size[ELEMENTS]]]:
+    for _ in range(CYCLES):
+        yield hg.MIN_TD, PAYLOAD
+
+
+@generator
+def floats() -> TS[float]:
+    for i in range(CYCLES):
+        yield hg.MIN_TD, float(i)
+
+
+def read(ts) -> float:
+    if variant == "value":
+        return float(ts.value.sum())
+    if variant == "value_view":
+        return float(ts.value_view.sum())
+    return 0.0
+
+
+@compute_node
+def read_array(ts: TS[Array[float, Size[ELEMENTS]]]) -> TS[float]:
+    return read(ts)
+
+
+@compute_node
+def read_window(ts: TSW[float, WindowSize[ELEMENTS], WindowSize[1]]) -> TS[float]:
+    return read(ts)
+
+
+@graph
+def g():
+    if shape == "array":
+        null_sink(read_array(arrays()))
+    else:
+        null_sink(read_window(to_window(floats(), ELEMENTS, 1)))
+
+
+t0 = time.perf_counter()
+hg.run_graph(g, start_time=hg.MIN_ST, end_time=hg.MIN_ST + (CYCLES + 2) * hg.MIN_TD)
+elapsed = time.perf_counter() - t0
+print(shape, variant, round(elapsed, 3), "s", round(elapsed / CYCLES * 1e6, 2), "us/cycle")
@@ -445,6 +445,35 @@ def scheduler_conflated_fixed_tsl_std(scale: float):
     return g, cycles
 
 
+@generator
+def _phased_pulse(cycles: int, period: int, phase: int) -> TS[int]:
+    """Tick once every `period` cycles, offset by `phase` cycles."""
+    yield (phase + 1) * MIN_TD, 0
+    for i in range(1, cycles // period):
+        yield period * MIN_TD, i
+
+
+def _sparse_branches_std(period: int):
+    """Many independent source -> chain -> sink branches where only one in
+    `period` ticks per engine cycle. Graph size is fixed across the family so
+    the per-cycle cost shows how scheduling scales with the fraction of nodes
+    due rather than with the total node count."""
+
+    def factory(cycle_scale: float, size_scale: float):
+        cycles = int(2_000 * cycle_scale)
+        width = max(2, int(1_000 * size_scale))
+
+        @graph
+        def g():
+            for branch in range(width):
+                null_sink(_chain_std(
+                    _phased_pulse(cycles, period, branch % period), 3))
+
+        return g, cycles
+
+    return factory
+
+
 def python_generator_boundary(scale: float):
     cycles = int(20_000 * scale)
 
@@ -896,7 +925,9 @@ def _tsd_churn_variant(cycle_scale: float, size_scale: float, stage: str):
     @graph
     def g():
         values = _tsd_churn_pulse(cycles, live, 5)
-        if stage == "map":
+        if stage == "map_recycled":
+            hg.set_trait("recycled_child_graphs", 5)
+        if stage in ("map", "map_recycled"):
             values = map_(_mapped_std, values)
         elif stage == "reduce":
             values = reduce(hg.add_, values, 0)
@@ -913,6 +944,10 @@ def tsd_churn_map_std(cycle_scale: float, size_scale: float):
     return _tsd_churn_variant(cycle_scale, size_scale, "map")
 
 
+def tsd_churn_map_recycled_std(cycle_scale: float, size_scale: float):
+    return _tsd_churn_variant(cycle_scale, size_scale, "map_recycled")
+
+
 def tsd_churn_reduce_std(cycle_scale: float, size_scale: float):
     return _tsd_churn_variant(cycle_scale, size_scale, "reduce")
 
@@ -1607,6 +1642,15 @@ SCENARIOS = {
     "scheduler_conflated_fixed_tsl_std": _scenario(
         "Scheduler", "Eight notifications conflated into one reducer",
         scheduler_conflated_fixed_tsl_std, suite="diagnostic"),
+    "scheduler_sparse_1_std": _scenario(
+        "Scheduler", "Large graph - every branch ticks each cycle",
+        _sparse_branches_std(1), suite="diagnostic", independent_size=True),
+    "scheduler_sparse_10_std": _scenario(
+        "Scheduler", "Large graph - 10% of branches tick each cycle",
+        _sparse_branches_std(10), suite="diagnostic", independent_size=True),
+    "scheduler_sparse_100_std": _scenario(
+        "Scheduler", "Large graph - 1% of branches tick each cycle",
+        _sparse_branches_std(100), suite="diagnostic", independent_size=True),
 
     "python_generator_boundary": _scenario(
         "Python boundary", "Python scalar generator to native sink",
@@ -1737,6 +1781,9 @@ SCENARIOS = {
     "tsd_churn_map_std": _scenario(
         "TSD - key lifecycle", "Key replacement - map only",
         tsd_churn_map_std, suite="diagnostic", independent_size=True),
+    "tsd_churn_map_recycled_std": _scenario(
+        "TSD - key lifecycle", "Key replacement - map with recycled child graphs",
+        tsd_churn_map_recycled_std, suite="diagnostic", independent_size=True),
     "tsd_churn_reduce_std": _scenario(
         "TSD - key lifecycle", "Key replacement - reduce only",
         tsd_churn_reduce_std, suite="diagnostic", independent_size=True),
@@ -208,9 +208,12 @@ namespace hgraph::analytics
     /** Select a scalar quantile from a numeric shaped array or tick window.
         A tick on either input schedules evaluation; the operator emits only
         when both inputs are valid and a selected window has reached its minimum
-        population. It retains no state beyond state already owned by a supplied
-        ``TSW``. Arrow Compute performs the interpolation using one of
-        ``linear``, ``lower``, ``higher``, ``midpoint``, or ``nearest``.
+        population. Arrays are evaluated by Arrow Compute's exact quantile. For
+        a ``TSW`` the node keeps an order-statistic tree of the window, updated
+        only by the values that entered or left it, so each tick costs
+        O(log N); it applies Arrow's interpolation rules, including ignoring
+        NaN values. Interpolation is one of ``linear``, ``lower``, ``higher``,
+        ``midpoint``, or ``nearest``.
         @param values Integer or floating-point ``Array`` or ``TSW`` input.
         @param q Live quantile in the inclusive range ``[0, 1]``.
         @param method Wiring-time interpolation method; defaults to ``linear``.
@@ -231,13 +234,12 @@ namespace hgraph::analytics
 
     /** Compute population or sample standard deviation over a numeric shaped array.
         The node has no warm-up state and emits for every valid input array.
-        Arrow Compute uses the divisor ``N - ddof``; ``ddof`` is fixed at
-        wiring time and defaults to zero.
+        A two-pass variance uses the divisor ``N - ddof``; ``ddof`` is fixed
+        at wiring time and defaults to zero.
         @param values Integer or floating-point shaped array.
         @param ddof Delta degrees of freedom subtracted from the observation count.
-        @return Floating-point standard deviation. An Arrow null result is NaN.
-        @throws std::invalid_argument when ``ddof`` is outside Arrow's integer range.
-        @throws std::runtime_error if Arrow Compute rejects the operation.
+        @return Floating-point standard deviation; NaN when ``N - ddof`` is
+                not positive.
         @par Python example
         @code{.py}
         import hgraph_analytics as hga
@@ -303,9 +305,11 @@ namespace hgraph::analytics
         A scalar stream produces running population variance. Numeric
         collections use the migrated collection contract: current valid
         members are treated as a sample and fewer than two members produce
-        zero. Binary and fixed-list inputs are evaluated element by element.
-        Invalid source cycles do not update running state or trigger output.
-        @param ts Numeric stream or collection.
+        zero. A ``TSW`` reports the population variance of its retained
+        observations once ready. Binary and fixed-list inputs are evaluated
+        element by element. Invalid source cycles do not update running state
+        or trigger output.
+        @param ts Numeric stream, collection, or typed window.
         @param default_value Compatibility fallback accepted by scalar-container
                              reductions.
         @param lhs Left input for binary or element-wise variance.
@@ -323,10 +327,13 @@ namespace hgraph::analytics
     };
 
     /** Compute the mean over a trailing observation-count or duration window.
-        The migrated graph retains the original warm-up contract. Tick windows
-        emit after ``min_window_period`` observations (the full period when the
-        minimum is zero); duration windows use the covered tick count as their
-        denominator. Invalid input cycles do not add observations.
+        One native node keeps a compensated running sum over a ring of the
+        window's observations. Tick windows emit once ``min_window_period``
+        observations have arrived, or after ``period + 1`` when the minimum is
+        zero, and average the last ``period`` of them. Duration windows hold
+        the ticks in ``(now - period, now]``, emit on every tick and every
+        eviction once one observation has left, and report NaN when empty.
+        Invalid input cycles do not add observations.
         @param ts Numeric input stream.
         @param period Positive observation count or duration fixed while wiring.
         @param min_window_period Optional minimum observation count or duration;
@@ -346,6 +353,117 @@ namespace hgraph::analytics
     {
     };
 
+    /** Compute the sum over a trailing observation-count or duration window.
+        Shares the window and warm-up contract of ``rolling_mean``; an empty
+        duration window sums to zero.
+        @param ts Numeric input stream.
+        @param period Positive observation count or duration fixed while wiring.
+        @param min_window_period Optional minimum observation count or duration;
+                                 zero selects the full period.
+        @return Floating-point trailing sum (NaN while the window holds a NaN).
+        @throws std::invalid_argument while wiring for invalid period/minimum
+                                     combinations.
+        @par Python example
+        @code{.py}
+        from datetime import timedelta
+        import hgraph_analytics as hga
+        traded_volume = hga.rolling_sum(fill_size, timedelta(minutes=5))
+        @endcode */
+    struct rolling_sum
+        : Operator<"hgraph.analytics.rolling_sum",
+                   In<"ts", TS<ScalarVar<"T">>>, Scalar<"period", Int>,
+                   Out<TS<Float>>>
+    {
+    };
+
+    /** Compute the population variance over a trailing observation-count or
+        duration window, maintained with Welford's update and its inverse.
+        Shares the window and warm-up contract of ``rolling_mean``.
+        @param ts Numeric input stream.
+        @param period Positive observation count or duration fixed while wiring.
+        @param min_window_period Optional minimum observation count or duration;
+                                 zero selects the full period.
+        @return Floating-point trailing variance (ddof=0).
+        @throws std::invalid_argument while wiring for invalid period/minimum
+                                     combinations.
+        @par Python example
+        @code{.py}
+        import hgraph_analytics as hga
+        dispersion = hga.rolling_var(returns, 50)
+        @endcode */
+    struct rolling_var
+        : Operator<"hgraph.analytics.rolling_var",
+                   In<"ts", TS<ScalarVar<"T">>>, Scalar<"period", Int>,
+                   Out<TS<Float>>>
+    {
+    };
+
+    /** Compute the minimum over a trailing observation-count or duration
+        window in amortised constant time per observation. Shares the window
+        and warm-up contract of ``rolling_mean``.
+        @param ts Numeric input stream.
+        @param period Positive observation count or duration fixed while wiring.
+        @param min_window_period Optional minimum observation count or duration;
+                                 zero selects the full period.
+        @return Floating-point trailing minimum.
+        @throws std::invalid_argument while wiring for invalid period/minimum
+                                     combinations.
+        @par Python example
+        @code{.py}
+        import hgraph_analytics as hga
+        low = hga.rolling_min(price, 20)
+        @endcode */
+    struct rolling_min
+        : Operator<"hgraph.analytics.rolling_min",
+                   In<"ts", TS<ScalarVar<"T">>>, Scalar<"period", Int>,
+                   Out<TS<Float>>>
+    {
+    };
+
+    /** Compute the maximum over a trailing observation-count or duration
+        window in amortised constant time per observation. Shares the window
+        and warm-up contract of ``rolling_mean``.
+        @param ts Numeric input stream.
+        @param period Positive observation count or duration fixed while wiring.
+        @param min_window_period Optional minimum observation count or duration;
+                                 zero selects the full period.
+        @return Floating-point trailing maximum.
+        @throws std::invalid_argument while wiring for invalid period/minimum
+                                     combinations.
+        @par Python example
+        @code{.py}
+        import hgraph_analytics as hga
+        high = hga.rolling_max(price, 20)
+        @endcode */
+    struct rolling_max
+        : Operator<"hgraph.analytics.rolling_max",
+                   In<"ts", TS<ScalarVar<"T">>>, Scalar<"period", Int>,
+                   Out<TS<Float>>>
+    {
+    };
+
+    /** Count the observations in a trailing observation-count or duration
+        window. Shares the window and warm-up contract of ``rolling_mean``.
+        @param ts Numeric input stream.
+        @param period Positive observation count or duration fixed while wiring.
+        @param min_window_period Optional minimum observation count or duration;
+                                 zero selects the full period.
+        @return Observations currently in the window.
+        @throws std::invalid_argument while wiring for invalid period/minimum
+                                     combinations.
+        @par Python example
+        @code{.py}
+        from datetime import timedelta
+        import hgraph_analytics as hga
+        fills_per_minute = hga.rolling_count(fill_size, timedelta(minutes=1))
+        @endcode */
+    struct rolling_count
+        : Operator<"hgraph.analytics.rolling_count",
+                   In<"ts", TS<ScalarVar<"T">>>, Scalar<"period", Int>,
+                   Out<TS<Int>>>
+    {
+    };
+
     /** Retick the latest valid input on a regular engine-time schedule.
         The first valid input establishes the value sampled at subsequent
         schedule boundaries. Once valid, the node continues to emit even when
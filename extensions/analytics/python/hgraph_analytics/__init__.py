@@ -37,7 +37,12 @@ _array_std = operator_function("hgraph.analytics.array_std")
 _rolling_window = operator_function("hgraph.analytics.rolling_window")
 _std = operator_function("hgraph.analytics.std")
 _var = operator_function("hgraph.analytics.var")
+_rolling_sum = operator_function("hgraph.analytics.rolling_sum")
 _rolling_mean = operator_function("hgraph.analytics.rolling_mean")
+_rolling_var = operator_function("hgraph.analytics.rolling_var")
+_rolling_min = operator_function("hgraph.analytics.rolling_min")
+_rolling_max = operator_function("hgraph.analytics.rolling_max")
+_rolling_count = operator_function("hgraph.analytics.rolling_count")
 _resample = operator_function("hgraph.analytics.resample")
 _to_window = operator_function("to_window")
 
@@ -187,8 +192,7 @@ def array_std(values, ddof: int = 0) -> TS[float]:
     Every valid array tick produces one floating-point result. All dimensions
     are reduced, ``ddof`` is fixed while wiring and defaults to zero, and the
     operator retains no state. A sample count insufficient for ``ddof`` yields
-    NaN; a value outside Arrow's supported integer range raises during
-    evaluation.
+    NaN.
     """
 
     return _array_std(values, ddof)
@@ -254,20 +258,61 @@ def var(*values, default_value=None):
     )
 
 
+def _rolling(operator, ts, period, min_window_period):
+    return (
+        operator(ts, period)
+        if min_window_period is None
+        else operator(ts, period, min_window_period)
+    )
+
+
 def rolling_mean(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
     """Return the mean over a trailing observation-count or duration window.
 
-    ``period`` and ``min_window_period`` are fixed while wiring. A zero or
-    omitted minimum selects the full tick-count period; duration windows use
-    the covered tick count as their denominator. Invalid source cycles do not
-    add observations. Invalid period/minimum combinations fail while wiring.
+    ``period`` and ``min_window_period`` are fixed while wiring. Tick windows
+    emit once ``min_window_period`` observations have arrived, or after
+    ``period + 1`` when the minimum is zero or omitted. Duration windows emit
+    on every tick and eviction once the first observation has left, and are
+    NaN when empty. Invalid source cycles do not add observations. Invalid
+    period/minimum combinations fail while wiring.
     """
 
-    return (
-        _rolling_mean(ts, period)
-        if min_window_period is None
-        else _rolling_mean(ts, period, min_window_period)
-    )
+    return _rolling(_rolling_mean, ts, period, min_window_period)
+
+
+def rolling_sum(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
+    """Return the sum over a trailing window; see :func:`rolling_mean`.
+
+    An empty duration window sums to zero.
+    """
+
+    return _rolling(_rolling_sum, ts, period, min_window_period)
+
+
+def rolling_var(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
+    """Return the population variance over a trailing window; see
+    :func:`rolling_mean`."""
+
+    return _rolling(_rolling_var, ts, period, min_window_period)
+
+
+def rolling_min(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
+    """Return the minimum over a trailing window; see :func:`rolling_mean`."""
+
+    return _rolling(_rolling_min, ts, period, min_window_period)
+
+
+def rolling_max(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
+    """Return the maximum over a trailing window; see :func:`rolling_mean`."""
+
+    return _rolling(_rolling_max, ts, period, min_window_period)
+
+
+def rolling_count(ts: TS[NUMBER], period: int | timedelta, min_window_period=None):
+    """Return the observation count of a trailing window; see
+    :func:`rolling_mean`."""
+
+    return _rolling(_rolling_count, ts, period, min_window_period)
 
 
 def resample(ts, period: timedelta):
@@ -295,7 +340,12 @@ __all__ = [
     "pct_change",
     "quantile",
     "resample",
+    "rolling_count",
+    "rolling_max",
     "rolling_mean",
+    "rolling_min",
+    "rolling_sum",
+    "rolling_var",
     "rolling_window",
     "span_to_alpha",
     "std",
@@ -139,6 +139,27 @@ def test_rolling_mean_supports_tick_and_duration_periods():
     assert math.isnan(duration[-1])
 
 
+def test_rolling_family_shares_the_window_contract():
+    values = [1, 5, 2, 8, 3]
+    assert hg.eval_node(hga.rolling_sum, values, 3) == [None, None, None, 15.0, 13.0]
+    assert hg.eval_node(hga.rolling_var, values, 3, 2) == pytest.approx(
+        [None, 4.0, 26.0 / 9.0, 6.0, 62.0 / 9.0]
+    )
+    assert hg.eval_node(hga.rolling_min, values, 3, 2) == [None, 1.0, 1.0, 2.0, 2.0]
+    assert hg.eval_node(hga.rolling_max, values, 3, 2) == [None, 5.0, 5.0, 8.0, 8.0]
+    assert hg.eval_node(hga.rolling_count, values, 3, 1) == [1, 2, 3, 3, 3]
+
+    assert hg.eval_node(hga.rolling_sum, values, hg.MIN_TD * 3) == [
+        None, None, None, 15.0, 13.0, 11.0, 3.0, 0.0
+    ]
+    assert hg.eval_node(hga.rolling_max, values, hg.MIN_TD * 3)[:-1] == [
+        None, None, None, 8.0, 8.0, 8.0, 3.0
+    ]
+    assert hg.eval_node(hga.rolling_count, values, hg.MIN_TD * 3) == [
+        None, None, None, 3, 3, 2, 1, 0
+    ]
+
+
 @pytest.mark.parametrize(
     ("period", "minimum", "message"),
     [
@@ -1,6 +1,7 @@
 #include <hgraph/analytics/operators.h>
 
 #include <hgraph/lib/std/operators/stream.h>
+#include <hgraph/lib/std/window_kernels.h>
 #include <hgraph/types/graph_wiring.h>
 #include <hgraph/types/metadata/value_plan_factory.h>
 #include <hgraph/types/operator_type_resolution.h>
@@ -8,14 +9,18 @@
 #include <hgraph/types/value/value_builder.h>
 
 #include "operator_registration.h"
+#include "order_statistic_tree.h"
 
 #include <arrow/api.h>
 #include <arrow/compute/api.h>
 #include <arrow/compute/initialize.h>
 
+#include <cmath>
 #include <concepts>
 #include <cstdint>
+#include <deque>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -26,11 +31,32 @@
 
 #include <fmt/format.h>
 
+namespace hgraph::analytics::detail
+{
+    /** Node state of a windowed quantile: the (tick time, value) entries it
+        has counted, oldest first, and the ordered multiset of their values. */
+    struct QuantileWindowState
+    {
+        std::deque<std::pair<DateTime, double>> entries{};
+        OrderStatisticTree                      ordered{};
+    };
+}  // namespace hgraph::analytics::detail
+
+namespace hgraph::static_schema_detail
+{
+    template <>
+    struct scalar_name<analytics::detail::QuantileWindowState>
+    {
+        static constexpr std::string_view value{"analytics.quantile_window_state"};
+    };
+}  // namespace hgraph::static_schema_detail
+
 namespace hgraph::analytics
 {
     namespace
     {
         using namespace hgraph::operator_type_resolution;
+        namespace window_kernels = hgraph::stdlib::window_kernels;
 
         [[nodiscard]] ValueTypeRef binding_for(const ValueTypeMetaData *meta)
         {
@@ -131,19 +157,6 @@ namespace hgraph::analytics
             }
         }
 
-        [[nodiscard]] Float standard_deviation_result(const arrow::Datum &datum)
-        {
-            if (!datum.is_scalar() || datum.type()->id() != arrow::Type::DOUBLE)
-            {
-                throw std::runtime_error(
-                    "hgraph.analytics.array_std: Arrow Compute returned an unexpected result");
-            }
-            const auto &scalar = datum.scalar_as<arrow::DoubleScalar>();
-            return scalar.is_valid
-                       ? scalar.value
-                       : std::numeric_limits<Float>::quiet_NaN();
-        }
-
         [[nodiscard]] bool window_ready(const TSWInputView &window)
         {
             if (window.empty()) { return false; }
@@ -156,24 +169,59 @@ namespace hgraph::analytics
             return window.size() >= window.min_period();
         }
 
-        template <typename T, bool IsWindow>
-        struct quantile_impl
+        [[nodiscard]] Float quantile_q(const Float q)
         {
-            static constexpr auto name = []
+            if (!(q >= 0.0 && q <= 1.0))
             {
-                if constexpr (IsWindow)
-                {
-                    return std::same_as<T, Int>
-                               ? "hgraph.analytics.quantile.window.int"
-                               : "hgraph.analytics.quantile.window.float";
-                }
-                else
+                throw std::invalid_argument(
+                    "hgraph.analytics.quantile: q must be in [0, 1]");
+            }
+            return q;
+        }
+
+        /** Arrow Compute's exact-quantile interpolation, evaluated against an
+            order-statistic tree instead of a materialised array. NaN values
+            are never held, matching Arrow, which ignores them; an empty tree
+            is Arrow's null result. */
+        [[nodiscard]] Float window_quantile(
+            const detail::OrderStatisticTree &ordered, Float q,
+            arrow::compute::QuantileOptions::Interpolation interpolation)
+        {
+            using Interpolation = arrow::compute::QuantileOptions::Interpolation;
+            if (ordered.empty()) { return std::numeric_limits<Float>::quiet_NaN(); }
+            const double index = static_cast<double>(ordered.size() - 1) * q;
+            std::size_t lower = static_cast<std::size_t>(index);
+            const double fraction = index - static_cast<double>(lower);
+            switch (interpolation)
+            {
+                case Interpolation::LOWER:
+                    return ordered.select(lower);
+                case Interpolation::HIGHER:
+                    return ordered.select(fraction != 0.0 ? lower + 1 : lower);
+                case Interpolation::NEAREST:
+                    // Ties round to the even index.
+                    if (fraction > 0.5 || (fraction == 0.5 && lower % 2 == 1)) { ++lower; }
+                    return ordered.select(lower);
+                case Interpolation::LINEAR:
+                case Interpolation::MIDPOINT:
                 {
-                    return std::same_as<T, Int>
-                               ? "hgraph.analytics.quantile.array.int"
-                               : "hgraph.analytics.quantile.array.float";
+                    const double lower_value = ordered.select(lower);
+                    if (fraction == 0.0) { return lower_value; }
+                    const double higher_value = ordered.select(lower + 1);
+                    return interpolation == Interpolation::LINEAR
+                               ? fraction * higher_value + (1.0 - fraction) * lower_value
+                               : lower_value / 2.0 + higher_value / 2.0;
                 }
-            }();
+            }
+            throw std::logic_error("hgraph.analytics.quantile: unhandled interpolation");
+        }
+
+        template <typename T>
+        struct quantile_impl
+        {
+            static constexpr auto name = std::same_as<T, Int>
+                                             ? "hgraph.analytics.quantile.array.int"
+                                             : "hgraph.analytics.quantile.array.float";
 
             static auto defaults()
             {
@@ -183,19 +231,8 @@ namespace hgraph::analytics
             static bool requires_(const ResolutionMap &,
                                   OperatorCallContext context)
             {
-                if constexpr (IsWindow)
-                {
-                    const auto *window =
-                        time_series_schema_at_as<AnyTSW>(context, 0);
-                    return window != nullptr &&
-                           window->value_schema->element_type ==
-                               scalar_descriptor<T>::value_meta();
-                }
-                else
-                {
-                    return numeric_array(ts_value_schema_at(context, 0),
-                                         scalar_descriptor<T>::value_meta());
-                }
+                return numeric_array(ts_value_schema_at(context, 0),
+                                     scalar_descriptor<T>::value_meta());
             }
 
             static void eval(In<"values", TsVar<"A">> input,
@@ -204,42 +241,98 @@ namespace hgraph::analytics
                              Out<TS<Float>> out)
             {
                 // Arrow's exact quantile kernel provides the five interpolation
-                // policies in O(N) auxiliary storage. Window readiness is checked
-                // before copying so warm-up cycles remain invalid and allocation-free.
+                // policies in O(N) auxiliary storage.
                 std::vector<T> values;
-                if constexpr (IsWindow)
-                {
-                    const TSWInputView window{input.base().borrowed_ref()};
-                    if (!window_ready(window)) { return; }
-                    values.reserve(window.size());
-                    for (std::size_t index = 0; index < window.size(); ++index)
-                    {
-                        values.push_back(window.at(index).checked_as<T>());
-                    }
-                }
-                else
-                {
-                    flatten_numeric_array<T>(input.value(), values);
-                }
-
+                flatten_numeric_array<T>(input.value(), values);
                 if (values.empty())
                 {
                     throw std::invalid_argument(
                         "hgraph.analytics.quantile: values must not be empty");
                 }
-                if (!(q.value() >= 0.0 && q.value() <= 1.0))
-                {
-                    throw std::invalid_argument(
-                        "hgraph.analytics.quantile: q must be in [0, 1]");
-                }
                 const arrow::compute::QuantileOptions options{
-                    q.value(), quantile_interpolation(method.value()), false, 1};
+                    quantile_q(q.value()), quantile_interpolation(method.value()), false, 1};
                 out.set(quantile_result(checked_arrow_result(
                     arrow::compute::Quantile(numeric_datum(values), options),
                     "hgraph.analytics.quantile")));
             }
         };
 
+        /** Windowed quantile. The node keeps the window's values in an
+            order-statistic tree and applies only the entries that entered or
+            left since its last evaluation, so a tick costs O(log N) rather
+            than a copy and selection over the whole window. */
+        template <typename T>
+        struct window_quantile_impl
+        {
+            static constexpr auto name = std::same_as<T, Int>
+                                             ? "hgraph.analytics.quantile.window.int"
+                                             : "hgraph.analytics.quantile.window.float";
+
+            static auto defaults()
+            {
+                return std::tuple{arg<"method">(Str{"linear"})};
+            }
+
+            static bool requires_(const ResolutionMap &,
+                                  OperatorCallContext context)
+            {
+                const auto *window = time_series_schema_at_as<AnyTSW>(context, 0);
+                return window != nullptr &&
+                       window->value_schema->element_type ==
+                           scalar_descriptor<T>::value_meta();
+            }
+
+            static void eval(In<"values", TsVar<"A">> input,
+                             In<"q", TS<Float>> q,
+                             Scalar<"method", Str> method,
+                             State<detail::QuantileWindowState> state,
+                             Out<TS<Float>> out)
+            {
+                const TSWInputView window{input.base().borrowed_ref()};
+                auto &current = state.modify();
+                synchronise(current, window);
+                // Warm-up cycles keep the tree current but remain invalid.
+                if (!window_ready(window)) { return; }
+                out.set(window_quantile(current.ordered, quantile_q(q.value()),
+                                        quantile_interpolation(method.value())));
+            }
+
+            /** Bring the tree to the window's current contents. Entries are
+                keyed by their tick time: the window only drops from the front
+                and appends at the back, so what is held is a prefix of the
+                window once the expired front is evicted. Anything else (a
+                rebound input) falls back to a rebuild. */
+            static void synchronise(detail::QuantileWindowState &state, const TSWInputView &window)
+            {
+                const std::size_t size = window.size();
+                const auto forget = [&state]
+                {
+                    const double value = state.entries.front().second;
+                    if (!std::isnan(value)) { state.ordered.erase(value); }
+                    state.entries.pop_front();
+                };
+                while (!state.entries.empty() &&
+                       (size == 0 || state.entries.front().first < window.time_at(0)))
+                {
+                    forget();
+                }
+                if (!state.entries.empty() &&
+                    (state.entries.size() > size ||
+                     state.entries.front().first != window.time_at(0) ||
+                     state.entries.back().first != window.time_at(state.entries.size() - 1)))
+                {
+                    state.entries.clear();
+                    state.ordered.clear();
+                }
+                for (std::size_t index = state.entries.size(); index < size; ++index)
+                {
+                    const auto value = static_cast<double>(window.at(index).checked_as<T>());
+                    state.entries.emplace_back(window.time_at(index), value);
+                    if (!std::isnan(value)) { state.ordered.insert(value); }
+                }
+            }
+        };
+
         template <typename T>
         struct array_std_impl
         {
@@ -262,22 +355,14 @@ namespace hgraph::analytics
             static void eval(In<"values", TsVar<"A">> input,
                              Scalar<"ddof", Int> ddof, Out<TS<Float>> out)
             {
-                // Arrow's two-pass variance kernel avoids the catastrophic
+                // The two-pass window kernel avoids the catastrophic
                 // cancellation of E[x^2] - E[x]^2. Flattening gives ndarray-like
                 // whole-array semantics and uses O(N) temporary storage.
                 std::vector<T> values;
                 flatten_numeric_array<T>(input.value(), values);
-                if (ddof.value() < std::numeric_limits<int>::min() ||
-                    ddof.value() > std::numeric_limits<int>::max())
-                {
-                    throw std::invalid_argument(
-                        "hgraph.analytics.array_std: ddof is outside Arrow's supported range");
-                }
-                const arrow::compute::VarianceOptions options{
-                    static_cast<int>(ddof.value()), false, 0};
-                out.set(standard_deviation_result(checked_arrow_result(
-                    arrow::compute::Stddev(numeric_datum(values), options),
-                    "hgraph.analytics.array_std")));
+                const Float variance = window_kernels::variance(
+                    window_kernels::Runs<T>{std::span<const T>{values}, std::span<const T>{}}, ddof.value());
+                out.set(std::sqrt(variance));
             }
         };
 
@@ -430,10 +515,10 @@ namespace hgraph::analytics
         }();
         static_cast<void>(arrow_compute_initialised);
 
-        register_overload<quantile, quantile_impl<Int, false>>();
-        register_overload<quantile, quantile_impl<Float, false>>();
-        register_overload<quantile, quantile_impl<Int, true>>();
-        register_overload<quantile, quantile_impl<Float, true>>();
+        register_overload<quantile, quantile_impl<Int>>();
+        register_overload<quantile, quantile_impl<Float>>();
+        register_overload<quantile, window_quantile_impl<Int>>();
+        register_overload<quantile, window_quantile_impl<Float>>();
         register_overload<array_std, array_std_impl<Int>>();
         register_overload<array_std, array_std_impl<Float>>();
         register_overload<rolling_window, rolling_window_arrays_impl>();
@@ -0,0 +1,172 @@
+#ifndef HGRAPH_ANALYTICS_ORDER_STATISTIC_TREE_H
+#define HGRAPH_ANALYTICS_ORDER_STATISTIC_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hgraph::analytics::detail
+{
+    /** Multiset of doubles with O(log n) expected insert, erase and rank
+        selection: a treap whose nodes carry their subtree size. Nodes live in
+        one vector and are recycled through a free list, so a window that
+        slides at a constant population stops allocating once warm. Priorities
+        come from a fixed-seed generator, keeping evaluation deterministic. */
+    class OrderStatisticTree
+    {
+      public:
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return root_ == nil ? 0 : nodes_[root_].size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return root_ == nil; }
+
+        void clear() noexcept
+        {
+            nodes_.clear();
+            free_.clear();
+            root_ = nil;
+        }
+
+        void insert(double value)
+        {
+            const std::uint32_t node = allocate(value);
+            auto [less, not_less] = split(root_, value, false);
+            root_ = merge(merge(less, node), not_less);
+        }
+
+        /** Remove one element equal to ``value``; false when none is held. */
+        bool erase(double value)
+        {
+            auto [less, not_less] = split(root_, value, false);
+            auto [equal, greater] = split(not_less, value, true);
+            const bool found = equal != nil;
+            if (found)
+            {
+                const std::uint32_t removed = equal;
+                equal = merge(nodes_[removed].left, nodes_[removed].right);
+                free_.push_back(removed);
+            }
+            root_ = merge(less, merge(equal, greater));
+            return found;
+        }
+
+        /** Element of zero-based ``rank`` in ascending order. */
+        [[nodiscard]] double select(std::size_t rank) const
+        {
+            if (rank >= size())
+            {
+                throw std::out_of_range("OrderStatisticTree::select rank out of range");
+            }
+            std::uint32_t node = root_;
+            for (;;)
+            {
+                const std::size_t left = subtree_size(nodes_[node].left);
+                if (rank < left) { node = nodes_[node].left; }
+                else if (rank == left) { return nodes_[node].value; }
+                else
+                {
+                    rank -= left + 1;
+                    node = nodes_[node].right;
+                }
+            }
+        }
+
+      private:
+        static constexpr std::uint32_t nil = std::numeric_limits<std::uint32_t>::max();
+
+        struct Node
+        {
+            double        value{};
+            std::uint32_t priority{};
+            std::uint32_t left{nil};
+            std::uint32_t right{nil};
+            std::uint32_t size{1};
+        };
+
+        [[nodiscard]] std::size_t subtree_size(std::uint32_t node) const noexcept
+        {
+            return node == nil ? 0 : nodes_[node].size;
+        }
+
+        void update(std::uint32_t node) noexcept
+        {
+            nodes_[node].size = static_cast<std::uint32_t>(
+                1 + subtree_size(nodes_[node].left) + subtree_size(nodes_[node].right));
+        }
+
+        [[nodiscard]] std::uint32_t next_priority() noexcept
+        {
+            // xorshift32: cheap, and only needs to be roughly uniform.
+            seed_ ^= seed_ << 13;
+            seed_ ^= seed_ >> 17;
+            seed_ ^= seed_ << 5;
+            return seed_;
+        }
+
+        [[nodiscard]] std::uint32_t allocate(double value)
+        {
+            const Node node{.value = value, .priority = next_priority()};
+            if (!free_.empty())
+            {
+                const std::uint32_t index = free_.back();
+                free_.pop_back();
+                nodes_[index] = node;
+                return index;
+            }
+            if (nodes_.size() >= nil)
+            {
+                throw std::length_error("OrderStatisticTree capacity exceeded");
+            }
+            nodes_.push_back(node);
+            return static_cast<std::uint32_t>(nodes_.size() - 1);
+        }
+
+        /** Split into (elements < value, elements >= value), or with
+            ``inclusive`` into (elements <= value, elements > value). */
+        [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> split(std::uint32_t node, double value,
+                                                                    bool inclusive) noexcept
+        {
+            if (node == nil) { return {nil, nil}; }
+            const bool goes_left = inclusive ? !(value < nodes_[node].value) : nodes_[node].value < value;
+            if (goes_left)
+            {
+                auto [left, right]  = split(nodes_[node].right, value, inclusive);
+                nodes_[node].right = left;
+                update(node);
+                return {node, right};
+            }
+            auto [left, right] = split(nodes_[node].left, value, inclusive);
+            nodes_[node].left  = right;
+            update(node);
+            return {left, node};
+        }
+
+        /** Join two treaps where every element of ``left`` orders before ``right``. */
+        [[nodiscard]] std::uint32_t merge(std::uint32_t left, std::uint32_t right) noexcept
+        {
+            if (left == nil) { return right; }
+            if (right == nil) { return left; }
+            if (nodes_[left].priority > nodes_[right].priority)
+            {
+                nodes_[left].right = merge(nodes_[left].right, right);
+                update(left);
+                return left;
+            }
+            nodes_[right].left = merge(left, nodes_[right].left);
+            update(right);
+            return right;
+        }
+
+        std::vector<Node>          nodes_{};
+        std::vector<std::uint32_t> free_{};
+        std::uint32_t              root_{nil};
+        std::uint32_t              seed_{0x9e3779b9u};
+    };
+}  // namespace hgraph::analytics::detail
+
+#endif  // HGRAPH_ANALYTICS_ORDER_STATISTIC_TREE_H
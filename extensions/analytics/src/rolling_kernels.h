@@ -0,0 +1,262 @@
+#ifndef HGRAPH_ANALYTICS_ROLLING_KERNELS_H
+#define HGRAPH_ANALYTICS_ROLLING_KERNELS_H
+
+#include <hgraph/util/date_time.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace hgraph::analytics::detail
+{
+    /** FIFO with random access over one vector that grows geometrically and
+        is otherwise reused, so a window sliding at a steady population stops
+        allocating once warm. */
+    template <typename T> class Ring
+    {
+      public:
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        [[nodiscard]] const T &operator[](std::size_t index) const noexcept
+        {
+            return slots_[(head_ + index) % slots_.size()];
+        }
+        [[nodiscard]] const T &front() const noexcept { return slots_[head_]; }
+        [[nodiscard]] const T &back() const noexcept { return (*this)[size_ - 1]; }
+
+        void reserve(std::size_t capacity)
+        {
+            if (capacity <= slots_.size()) { return; }
+            std::vector<T> slots;
+            slots.reserve(capacity);
+            for (std::size_t index = 0; index < size_; ++index) { slots.push_back((*this)[index]); }
+            slots.resize(capacity);
+            slots_ = std::move(slots);
+            head_  = 0;
+        }
+
+        void push_back(const T &value)
+        {
+            if (size_ == slots_.size()) { reserve(std::max<std::size_t>(8, slots_.size() * 2)); }
+            slots_[(head_ + size_) % slots_.size()] = value;
+            ++size_;
+        }
+
+        void pop_front() noexcept
+        {
+            head_ = (head_ + 1) % slots_.size();
+            --size_;
+        }
+
+        void pop_back() noexcept { --size_; }
+
+        void clear() noexcept
+        {
+            head_ = 0;
+            size_ = 0;
+        }
+
+      private:
+        std::vector<T> slots_{};
+        std::size_t    head_{0};
+        std::size_t    size_{0};
+    };
+
+    /**
+     * Running statistics over a trailing window of observations, updated as
+     * observations enter at the back and leave at the front.
+     *
+     * The sum is Neumaier-compensated and the moments use Welford's update
+     * and its inverse. Both are rebuilt from the held observations once as
+     * many have left as the window holds, which bounds drift at an amortised
+     * O(1) per observation however long the window slides. Minimum and
+     * maximum use monotonic wedges (O(1) amortised). NaN observations are
+     * counted apart: while one is held, every statistic but the count is NaN.
+     */
+    class RollingAccumulator
+    {
+      public:
+        /** Which statistics to maintain; the count is always kept. */
+        struct Tracked
+        {
+            bool sum{false};
+            bool moments{false};
+            bool extrema{false};
+        };
+
+        void track(Tracked tracked) noexcept { tracked_ = tracked; }
+
+        [[nodiscard]] std::size_t count() const noexcept { return entries_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+        [[nodiscard]] DateTime oldest_time() const noexcept { return entries_.front().time; }
+
+        void reserve(std::size_t capacity)
+        {
+            entries_.reserve(capacity);
+            if (tracked_.extrema)
+            {
+                minima_.reserve(capacity);
+                maxima_.reserve(capacity);
+            }
+        }
+
+        void push(DateTime time, double value)
+        {
+            entries_.push_back(Entry{time, value, next_sequence_});
+            if (std::isnan(value))
+            {
+                ++nan_count_;
+            }
+            else
+            {
+                if (tracked_.sum) { add(value); }
+                if (tracked_.moments) { add_moment(value); }
+                if (tracked_.extrema)
+                {
+                    while (!minima_.empty() && minima_.back().value >= value) { minima_.pop_back(); }
+                    minima_.push_back(Extremum{next_sequence_, value});
+                    while (!maxima_.empty() && maxima_.back().value <= value) { maxima_.pop_back(); }
+                    maxima_.push_back(Extremum{next_sequence_, value});
+                }
+            }
+            ++next_sequence_;
+        }
+
+        void pop() noexcept
+        {
+            const Entry entry = entries_.front();
+            entries_.pop_front();
+            if (std::isnan(entry.value))
+            {
+                --nan_count_;
+            }
+            else
+            {
+                if (tracked_.sum) { add(-entry.value); }
+                if (tracked_.moments) { remove_moment(entry.value); }
+                if (tracked_.extrema)
+                {
+                    if (!minima_.empty() && minima_.front().sequence == entry.sequence) { minima_.pop_front(); }
+                    if (!maxima_.empty() && maxima_.front().sequence == entry.sequence) { maxima_.pop_front(); }
+                }
+            }
+            if (++removed_since_rebuild_ >= entries_.size()) { rebuild(); }
+        }
+
+        void clear() noexcept
+        {
+            entries_.clear();
+            minima_.clear();
+            maxima_.clear();
+            nan_count_ = 0;
+            rebuild();
+        }
+
+        [[nodiscard]] double sum() const noexcept
+        {
+            return nan_count_ > 0 ? std::numeric_limits<double>::quiet_NaN() : sum_ + compensation_;
+        }
+
+        [[nodiscard]] double mean() const noexcept
+        {
+            return empty() ? std::numeric_limits<double>::quiet_NaN() : sum() / static_cast<double>(count());
+        }
+
+        /** Population variance. */
+        [[nodiscard]] double variance() const noexcept
+        {
+            if (empty() || nan_count_ > 0) { return std::numeric_limits<double>::quiet_NaN(); }
+            return std::max(0.0, m2_ / static_cast<double>(moment_count_));
+        }
+
+        [[nodiscard]] double min() const noexcept
+        {
+            return empty() || nan_count_ > 0 ? std::numeric_limits<double>::quiet_NaN() : minima_.front().value;
+        }
+
+        [[nodiscard]] double max() const noexcept
+        {
+            return empty() || nan_count_ > 0 ? std::numeric_limits<double>::quiet_NaN() : maxima_.front().value;
+        }
+
+      private:
+        struct Entry
+        {
+            DateTime      time{};
+            double        value{};
+            std::uint64_t sequence{};
+        };
+
+        struct Extremum
+        {
+            std::uint64_t sequence{};
+            double        value{};
+        };
+
+        void add(double value) noexcept
+        {
+            const double total = sum_ + value;
+            compensation_ += std::abs(sum_) >= std::abs(value) ? (sum_ - total) + value : (value - total) + sum_;
+            sum_ = total;
+        }
+
+        void add_moment(double value) noexcept
+        {
+            ++moment_count_;
+            const double delta = value - mean_;
+            mean_ += delta / static_cast<double>(moment_count_);
+            m2_ += delta * (value - mean_);
+        }
+
+        void remove_moment(double value) noexcept
+        {
+            if (--moment_count_ == 0)
+            {
+                mean_ = 0.0;
+                m2_   = 0.0;
+                return;
+            }
+            const double prior_mean = mean_;
+            mean_ -= (value - mean_) / static_cast<double>(moment_count_);
+            m2_ -= (value - prior_mean) * (value - mean_);
+        }
+
+        /** Recompute the sum and moments from the held observations. */
+        void rebuild() noexcept
+        {
+            sum_                   = 0.0;
+            compensation_          = 0.0;
+            moment_count_          = 0;
+            mean_                  = 0.0;
+            m2_                    = 0.0;
+            removed_since_rebuild_ = 0;
+            for (std::size_t index = 0; index < entries_.size(); ++index)
+            {
+                const double value = entries_[index].value;
+                if (std::isnan(value)) { continue; }
+                if (tracked_.sum) { add(value); }
+                if (tracked_.moments) { add_moment(value); }
+            }
+        }
+
+        Tracked         tracked_{};
+        Ring<Entry>     entries_{};
+        Ring<Extremum>  minima_{};
+        Ring<Extremum>  maxima_{};
+        std::uint64_t   next_sequence_{0};
+        std::size_t     nan_count_{0};
+        std::size_t     removed_since_rebuild_{0};
+        double          sum_{0.0};
+        double          compensation_{0.0};
+        std::size_t     moment_count_{0};
+        double          mean_{0.0};
+        double          m2_{0.0};
+    };
+}  // namespace hgraph::analytics::detail
+
+#endif  // HGRAPH_ANALYTICS_ROLLING_KERNELS_H
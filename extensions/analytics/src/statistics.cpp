@@ -1,15 +1,43 @@
 #include <hgraph/analytics/operators.h>
 
 #include "operator_registration.h"
+#include "rolling_kernels.h"
 
 #include <hgraph/lib/std/lifted_kernels.h>
 #include <hgraph/lib/std/operators/impl/arithmetic_impl.h>
 #include <hgraph/lib/std/operators/impl/collection_impl.h>
 #include <hgraph/lib/std/operators/impl/stream_impl.h>
+#include <hgraph/runtime/node_scheduler.h>
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace hgraph::analytics::detail
+{
+    /** Node state of a rolling-window statistic: the held window, the
+        observations ever admitted, and whether one has ever left. */
+    struct RollingWindowState
+    {
+        RollingAccumulator window{};
+        Int                observed{0};
+        bool               evicted{false};
+    };
+}  // namespace hgraph::analytics::detail
+
+namespace hgraph::static_schema_detail
+{
+    template <>
+    struct scalar_name<analytics::detail::RollingWindowState>
+    {
+        static constexpr std::string_view value{"analytics.rolling_window_state"};
+    };
+}  // namespace hgraph::static_schema_detail
 
 namespace hgraph::analytics::detail
 {
@@ -86,52 +114,206 @@ namespace hgraph::analytics::detail
             }
         };
 
-        /** Validate the analytics contract before delegating to the shared
-            tick-window rolling-average graph. */
-        struct rolling_mean_tick_compose : hgraph::stdlib::rolling_average_tick_compose
+        /** Statistic a rolling-window node reports. */
+        enum class RollingStat : std::uint8_t
+        {
+            Sum,
+            Mean,
+            Var,
+            Min,
+            Max,
+            Count,
+        };
+
+        struct RollingStatInfo
+        {
+            std::string_view operator_name;
+            /** Node names by window kind (tick, time) then element (int, float). */
+            const char *names[2][2];
+        };
+
+        constexpr RollingStatInfo rolling_stat_info[] = {
+            {"rolling_sum",
+             {{"hgraph.analytics.rolling_sum.tick.int", "hgraph.analytics.rolling_sum.tick.float"},
+              {"hgraph.analytics.rolling_sum.time.int", "hgraph.analytics.rolling_sum.time.float"}}},
+            {"rolling_mean",
+             {{"hgraph.analytics.rolling_mean.tick.int", "hgraph.analytics.rolling_mean.tick.float"},
+              {"hgraph.analytics.rolling_mean.time.int", "hgraph.analytics.rolling_mean.time.float"}}},
+            {"rolling_var",
+             {{"hgraph.analytics.rolling_var.tick.int", "hgraph.analytics.rolling_var.tick.float"},
+              {"hgraph.analytics.rolling_var.time.int", "hgraph.analytics.rolling_var.time.float"}}},
+            {"rolling_min",
+             {{"hgraph.analytics.rolling_min.tick.int", "hgraph.analytics.rolling_min.tick.float"},
+              {"hgraph.analytics.rolling_min.time.int", "hgraph.analytics.rolling_min.time.float"}}},
+            {"rolling_max",
+             {{"hgraph.analytics.rolling_max.tick.int", "hgraph.analytics.rolling_max.tick.float"},
+              {"hgraph.analytics.rolling_max.time.int", "hgraph.analytics.rolling_max.time.float"}}},
+            {"rolling_count",
+             {{"hgraph.analytics.rolling_count.tick.int", "hgraph.analytics.rolling_count.tick.float"},
+              {"hgraph.analytics.rolling_count.time.int", "hgraph.analytics.rolling_count.time.float"}}},
+        };
+
+        [[nodiscard]] constexpr const RollingStatInfo &rolling_info(RollingStat stat) noexcept
+        {
+            return rolling_stat_info[static_cast<std::size_t>(stat)];
+        }
+
+        template <RollingStat Stat>
+        using rolling_output_t = std::conditional_t<Stat == RollingStat::Count, Int, Float>;
+
+        [[nodiscard]] constexpr RollingAccumulator::Tracked rolling_tracked(RollingStat stat) noexcept
+        {
+            switch (stat)
+            {
+                case RollingStat::Sum:
+                case RollingStat::Mean: return {.sum = true};
+                case RollingStat::Var: return {.moments = true};
+                case RollingStat::Min:
+                case RollingStat::Max: return {.extrema = true};
+                case RollingStat::Count: return {};
+            }
+            return {};
+        }
+
+        template <RollingStat Stat>
+        [[nodiscard]] rolling_output_t<Stat> rolling_value(const RollingAccumulator &window) noexcept
+        {
+            if constexpr (Stat == RollingStat::Sum) { return window.sum(); }
+            else if constexpr (Stat == RollingStat::Mean) { return window.mean(); }
+            else if constexpr (Stat == RollingStat::Var) { return window.variance(); }
+            else if constexpr (Stat == RollingStat::Min) { return window.min(); }
+            else if constexpr (Stat == RollingStat::Max) { return window.max(); }
+            else { return static_cast<Int>(window.count()); }
+        }
+
+        /** Shared wiring-time contract of the rolling family. */
+        template <typename Period>
+        void validate_rolling_window(RollingStat stat, OperatorCallContext context)
+        {
+            const auto *period  = context.scalar_as<Period>("period");
+            const auto *minimum = context.scalar_as<Period>("min_window_period");
+            const std::string_view label = rolling_info(stat).operator_name;
+            if (period != nullptr && *period <= Period{0})
+            {
+                throw std::invalid_argument(std::string{label} + ": period must be positive");
+            }
+            if (period != nullptr && minimum != nullptr && (*minimum < Period{0} || *minimum > *period))
+            {
+                throw std::invalid_argument(std::string{label} +
+                                            ": min_window_period must be between zero and period");
+            }
+        }
+
+        template <RollingStat Stat> void bind_rolling_output(ResolutionMap &resolution)
         {
-            static constexpr auto name = "rolling_mean_tick";
+            using namespace hgraph::operator_type_resolution;
+            if (output_bound(resolution)) { return; }
+            bind_output(resolution,
+                        TypeRegistry::instance().ts(scalar_descriptor<rolling_output_t<Stat>>::value_meta()));
+        }
+
+        /** Trailing window of the last ``period`` observations as one node.
+            The first output follows ``min_window_period`` observations, or
+            ``period + 1`` when the minimum is zero (the contract of the lagged
+            running-sum graph this replaces); until the window fills it covers
+            every observation seen. */
+        template <RollingStat Stat, typename T> struct rolling_tick_impl
+        {
+            static constexpr auto name = rolling_info(Stat).names[0][std::same_as<T, Float>];
+
+            static bool requires_(const ResolutionMap &, OperatorCallContext context)
+            {
+                return context.scalar_as<Int>("period") != nullptr;
+            }
 
             static void resolve_default_types(ResolutionMap &resolution, OperatorCallContext context)
             {
-                const auto *period  = context.scalar_as<Int>("period");
-                const auto *minimum = context.scalar_as<Int>("min_window_period");
-                if (period != nullptr && *period <= 0)
-                {
-                    throw std::invalid_argument("rolling_mean: period must be positive");
-                }
-                if (period != nullptr && minimum != nullptr && (*minimum < 0 || *minimum > *period))
+                validate_rolling_window<Int>(Stat, context);
+                bind_rolling_output<Stat>(resolution);
+            }
+
+            static auto defaults() { return std::tuple{arg<"min_window_period">(Int{0})}; }
+
+            static void eval(In<"ts", TS<T>> ts, Scalar<"period", Int> period,
+                             Scalar<"min_window_period", Int> min_window_period,
+                             State<RollingWindowState> state, Out<TS<rolling_output_t<Stat>>> out)
+            {
+                auto             &current  = state.modify();
+                const std::size_t capacity = static_cast<std::size_t>(period.value());
+                if (current.observed == 0)
                 {
-                    throw std::invalid_argument(
-                        "rolling_mean: min_window_period must be between zero and period");
+                    current.window.track(rolling_tracked(Stat));
+                    current.window.reserve(capacity + 1);
                 }
-                hgraph::stdlib::rolling_average_tick_compose::resolve_default_types(resolution, context);
+                current.window.push(DateTime{}, static_cast<double>(ts.value()));
+                if (current.window.count() > capacity) { current.window.pop(); }
+                ++current.observed;
+
+                const Int first = min_window_period.value() > 0 ? min_window_period.value() : period.value() + 1;
+                if (current.observed >= first) { out.set(rolling_value<Stat>(current.window)); }
             }
         };
 
-        /** Validate the analytics contract before delegating to the shared
-            duration-window rolling-average graph. */
-        struct rolling_mean_time_compose : hgraph::stdlib::rolling_average_time_compose
+        /** Trailing window of the observations ticked in ``(now - period,
+            now]`` as one node. It reports on every input tick and at every
+            eviction time, starting from the first eviction so the first output
+            covers a full period; an empty window reports NaN (zero for the
+            sum and count). ``min_window_period`` is validated only. */
+        template <RollingStat Stat, typename T> struct rolling_time_impl
         {
-            static constexpr auto name = "rolling_mean_time";
+            static constexpr auto name = rolling_info(Stat).names[1][std::same_as<T, Float>];
+
+            static bool requires_(const ResolutionMap &, OperatorCallContext context)
+            {
+                return context.scalar_as<TimeDelta>("period") != nullptr;
+            }
 
             static void resolve_default_types(ResolutionMap &resolution, OperatorCallContext context)
             {
-                const auto *period  = context.scalar_as<TimeDelta>("period");
-                const auto *minimum = context.scalar_as<TimeDelta>("min_window_period");
-                if (period != nullptr && *period <= TimeDelta{0})
+                validate_rolling_window<TimeDelta>(Stat, context);
+                bind_rolling_output<Stat>(resolution);
+            }
+
+            static auto defaults() { return std::tuple{arg<"min_window_period">(TimeDelta{0})}; }
+
+            static void eval(In<"ts", TS<T>> ts, Scalar<"period", TimeDelta> period,
+                             Scalar<"min_window_period", TimeDelta>, DateTime now, NodeScheduler scheduler,
+                             State<RollingWindowState> state, Out<TS<rolling_output_t<Stat>>> out)
+            {
+                auto &current = state.modify();
+                if (current.observed == 0) { current.window.track(rolling_tracked(Stat)); }
+
+                bool evicted = false;
+                while (!current.window.empty() && current.window.oldest_time() + period.value() <= now)
+                {
+                    current.window.pop();
+                    evicted = true;
+                }
+                const bool ticked = ts.modified();
+                if (ticked)
                 {
-                    throw std::invalid_argument("rolling_mean: period must be positive");
+                    current.window.push(now, static_cast<double>(ts.value()));
+                    ++current.observed;
                 }
-                if (period != nullptr && minimum != nullptr &&
-                    (*minimum < TimeDelta{0} || *minimum > *period))
+                current.evicted = current.evicted || evicted;
+
+                if (current.evicted && (evicted || ticked)) { out.set(rolling_value<Stat>(current.window)); }
+                // Only the oldest observation's expiry needs an alarm; it moves
+                // when that observation leaves or when one enters an empty window.
+                if ((evicted || (ticked && current.window.count() == 1)) && !current.window.empty())
                 {
-                    throw std::invalid_argument(
-                        "rolling_mean: min_window_period must be between zero and period");
+                    scheduler.schedule(current.window.oldest_time() + period.value());
                 }
-                hgraph::stdlib::rolling_average_time_compose::resolve_default_types(resolution, context);
             }
         };
+
+        template <typename Op, RollingStat Stat> void register_rolling_overloads()
+        {
+            register_overload<Op, rolling_tick_impl<Stat, Int>>();
+            register_overload<Op, rolling_tick_impl<Stat, Float>>();
+            register_overload<Op, rolling_time_impl<Stat, Int>>();
+            register_overload<Op, rolling_time_impl<Stat, Float>>();
+        }
     }  // namespace
 
     void register_statistics_operators() {
@@ -181,9 +363,15 @@ namespace hgraph::analytics::detail
         register_overload<std_, stream::tsw_std_impl<Float>>();
         register_overload<std_, stream::tsw_std_ddof_impl<Int>>();
         register_overload<std_, stream::tsw_std_ddof_impl<Float>>();
+        register_overload<var_, stream::tsw_var_impl<Int>>();
+        register_overload<var_, stream::tsw_var_impl<Float>>();
 
-        register_graph_overload<rolling_mean, rolling_mean_tick_compose>();
-        register_graph_overload<rolling_mean, rolling_mean_time_compose>();
+        register_rolling_overloads<rolling_sum, RollingStat::Sum>();
+        register_rolling_overloads<rolling_mean, RollingStat::Mean>();
+        register_rolling_overloads<rolling_var, RollingStat::Var>();
+        register_rolling_overloads<rolling_min, RollingStat::Min>();
+        register_rolling_overloads<rolling_max, RollingStat::Max>();
+        register_rolling_overloads<rolling_count, RollingStat::Count>();
         register_overload<resample, hgraph::stdlib::resample_impl>();
     }
 }  // namespace hgraph::analytics::detail
@@ -6,6 +6,7 @@
 #include <hgraph/lib/testing/eval_node.h>
 #include <hgraph/types/metadata/value_plan_factory.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <iostream>
@@ -13,6 +14,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -252,6 +254,20 @@ namespace
         }
     };
 
+    template <fixed_string Method>
+    struct SlidingQuantileMethodGraph
+    {
+        static constexpr auto name = "analytics_sliding_quantile_method_graph";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Float>> input)
+        {
+            auto window = wire<stdlib::to_window>(w, input, Int{5});
+            auto q = wire<stdlib::const_, TS<Float>>(w, Float{0.3});
+            return wire<quantile>(w, window, q, Str{Method.sv()})
+                .template as<TS<Float>>();
+        }
+    };
+
     struct SampleArrayStdGraph
     {
         static constexpr auto name = "analytics_sample_array_std_graph";
@@ -435,6 +451,63 @@ namespace
                 "window quantile readiness");
     }
 
+    /** Arrow's exact quantile over ``window``, computed by sorting. */
+    [[nodiscard]] Float reference_quantile(std::vector<Float> window, Float q,
+                                           std::string_view method)
+    {
+        std::ranges::sort(window);
+        const double index = static_cast<double>(window.size() - 1) * q;
+        auto lower = static_cast<std::size_t>(index);
+        const double fraction = index - static_cast<double>(lower);
+        const std::size_t higher = fraction != 0.0 ? lower + 1 : lower;
+        if (method == "lower") { return window[lower]; }
+        if (method == "higher") { return window[higher]; }
+        if (method == "nearest")
+        {
+            if (fraction > 0.5 || (fraction == 0.5 && lower % 2 == 1)) { ++lower; }
+            return window[lower];
+        }
+        if (method == "midpoint") { return window[lower] / 2.0 + window[higher] / 2.0; }
+        return fraction * window[higher] + (1.0 - fraction) * window[lower];
+    }
+
+    template <fixed_string Method>
+    void check_sliding_quantile(const std::vector<Float> &inputs)
+    {
+        std::vector<std::optional<Float>> ticks;
+        for (const Float input : inputs) { ticks.emplace_back(input); }
+        const auto results = eval_node<SlidingQuantileMethodGraph<Method>>(ticks);
+        require(results.size() == inputs.size(), "sliding quantile tick count");
+        for (std::size_t index = 0; index < inputs.size(); ++index)
+        {
+            if (index + 1 < 5)
+            {
+                require(!results[index].has_value(), "sliding quantile warm-up");
+                continue;
+            }
+            const std::vector<Float> window(inputs.begin() + static_cast<std::ptrdiff_t>(index) - 4,
+                                            inputs.begin() + static_cast<std::ptrdiff_t>(index) + 1);
+            const Float expected = reference_quantile(window, 0.3, Method.sv());
+            require(results[index].has_value() &&
+                        std::abs(*results[index] - expected) <= 1.0e-12,
+                    "sliding quantile " + std::string{Method.sv()} + " at tick " +
+                        std::to_string(index));
+        }
+    }
+
+    void test_sliding_window_quantile()
+    {
+        // Duplicates enter and leave the window, and the order of the held
+        // values changes as it slides.
+        const std::vector<Float> inputs{5.0, 1.0, 4.0, 4.0, 9.0, -2.0, 4.0, 7.5,
+                                        0.0, 4.0, 3.0, 3.0, 8.0, -1.0, 6.0};
+        check_sliding_quantile<"linear">(inputs);
+        check_sliding_quantile<"lower">(inputs);
+        check_sliding_quantile<"higher">(inputs);
+        check_sliding_quantile<"midpoint">(inputs);
+        check_sliding_quantile<"nearest">(inputs);
+    }
+
     void test_array_standard_deviation()
     {
         const Value input = array_1d<Int>({1, 2, 3, 4});
@@ -499,6 +572,7 @@ int main()
         test_cumulative_sum();
         test_correlation();
         test_quantile();
+        test_sliding_window_quantile();
         test_array_standard_deviation();
         test_rolling_window();
         return 0;
@@ -120,6 +120,16 @@ namespace
         }
     };
 
+    struct WindowVarGraph
+    {
+        static constexpr auto name = "analytics_window_var";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Float>> ts) {
+            auto window = wire<hgraph::stdlib::to_window>(w, ts, Int{5}, Int{3});
+            return wire<var_, TS<Float>>(w, window);
+        }
+    };
+
     struct RollingMeanGraph
     {
         static constexpr auto name = "analytics_rolling_mean";
@@ -127,6 +137,20 @@ namespace
         static Port<TS<Float>> compose(Wiring &w, Port<TS<Int>> ts) { return wire<rolling_mean, TS<Float>>(w, ts, Int{3}, Int{2}); }
     };
 
+    template <typename Op, Int Minimum> struct RollingTickGraph
+    {
+        static constexpr auto name = "analytics_rolling_tick";
+
+        static Port<TS<Float>> compose(Wiring &w, Port<TS<Int>> ts) { return wire<Op, TS<Float>>(w, ts, Int{3}, Int{Minimum}); }
+    };
+
+    struct RollingCountGraph
+    {
+        static constexpr auto name = "analytics_rolling_count";
+
+        static Port<TS<Int>> compose(Wiring &w, Port<TS<Int>> ts) { return wire<rolling_count, TS<Int>>(w, ts, Int{3}, Int{1}); }
+    };
+
     using HomogeneousIntBundle = UnNamedTSB<Field<"a", TS<Int>>, Field<"b", TS<Int>>, Field<"c", TS<Int>>>;
 
     struct BundleStdGraph
@@ -163,10 +187,25 @@ namespace
                              "window population std");
         require_float_output(eval_node<WindowSampleStdGraph>(values<Int>(1, 2, 3, 4, 5)),
                              values<Float>(none, none, 1.0, std::sqrt(5.0 / 3.0), std::sqrt(2.5)), "window sample std");
+        require_float_output(eval_node<WindowVarGraph>(values<Float>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0)),
+                             values<Float>(none, none, 2.0 / 3.0, 1.25, 2.0, 2.0), "window population var");
         require_float_output(eval_node<RollingMeanGraph>(values<Int>(1, 2, 3, 4, 5)), values<Float>(none, 1.5, 2.0, 3.0, 4.0),
                              "rolling mean");
     }
 
+    void test_rolling_family() {
+        const auto observations = values<Int>(1, 5, 2, 8, 3);
+        require_float_output(eval_node<RollingTickGraph<rolling_sum, 0>>(observations),
+                             values<Float>(none, none, none, 15.0, 13.0), "rolling sum");
+        require_float_output(eval_node<RollingTickGraph<rolling_var, 2>>(observations),
+                             values<Float>(none, 4.0, 26.0 / 9.0, 6.0, 62.0 / 9.0), "rolling var");
+        require_float_output(eval_node<RollingTickGraph<rolling_min, 2>>(observations),
+                             values<Float>(none, 1.0, 1.0, 2.0, 2.0), "rolling min");
+        require_float_output(eval_node<RollingTickGraph<rolling_max, 2>>(observations),
+                             values<Float>(none, 5.0, 5.0, 8.0, 8.0), "rolling max");
+        require(eval_node<RollingCountGraph>(observations) == values<Int>(1, 2, 3, 3, 3), "rolling count");
+    }
+
     void test_collection_dispersion() {
         require_erased_float_output(
             eval_node<std_, TSS<Int>>(values<Value>(set_delta<Int>({1}, {}), set_delta<Int>({2}, {}), set_delta<Int>({-1, 3}, {}))),
@@ -239,6 +278,7 @@ int main() {
         hgraph::analytics::register_analytics_operators();
         test_running_and_binary_dispersion();
         test_window_dispersion_and_rolling_mean();
+        test_rolling_family();
         test_collection_dispersion();
         test_rolling_mean_validation();
         test_resample_schedule();
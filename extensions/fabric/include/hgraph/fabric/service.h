@@ -19,6 +19,10 @@ inline constexpr std::size_t FABRIC_LIVE_NOTICE_LIMIT_PER_SESSION{4096U};
 inline constexpr std::size_t FABRIC_NOTIFICATION_REQUEST_LIMIT{1024U};
 inline constexpr std::size_t FABRIC_NOTIFICATION_RETRY_LIMIT{8U};
 inline constexpr std::size_t FABRIC_DIAGNOSTIC_EVENT_LIMIT{256U};
+/** Worker threads reading requested Frames, and the bound on load requests
+    queued, in flight or completed but not yet delivered. */
+inline constexpr std::size_t FABRIC_LOAD_WORKERS{4U};
+inline constexpr std::size_t FABRIC_LOAD_QUEUE_LIMIT{1024U};
 
 /** Select where accepted revision notifications are delivered. Configured
     uses the Notifier stored in FabricConfig. GraphTransport exposes requests
@@ -130,8 +134,13 @@ struct FabricTransportEventService
     using request_schema = FabricTransportEvent;
 };
 
-/** Synchronous v1 load request/reply surface. The service owns persistence
-    access; a later asynchronous strategy can retain this contract. */
+/** Load request/reply surface. The service owns persistence access and
+    reads requested Frames off the graph thread on a bounded worker pool. A
+    real-time graph receives each response on the cycle after its read
+    completes; a simulation waits for the cycle's reads and responds in the
+    cycle of the request. A later request under the same id supersedes one
+    still in flight. Stores whose reads may not leave the graph thread are
+    read inline, as before. */
 struct FabricLoadService
 {
     static constexpr std::string_view name{"fabric_load"};
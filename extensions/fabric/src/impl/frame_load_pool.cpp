@@ -0,0 +1,177 @@
+#include "frame_load_pool.h"
+
+#include <hgraph/fabric/service.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace hgraph::fabric::detail
+{
+FrameLoadPool::~FrameLoadPool()
+{
+    stop();
+}
+
+void FrameLoadPool::start(persistence::store::FrameStore frames)
+{
+    std::lock_guard lock{mutex_};
+    off_thread_ = frames.reads_off_thread();
+    frames_ = std::move(frames);
+}
+
+void FrameLoadPool::stop() noexcept
+{
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+        workers = std::move(workers_);
+        workers_.clear();
+    }
+    work_.notify_all();
+    for (auto &worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    std::lock_guard lock{mutex_};
+    queued_.clear();
+    completed_.clear();
+    in_flight_ = 0;
+    idle_ = 0;
+    stopping_ = false;
+    frames_.reset();
+    off_thread_ = false;
+}
+
+void FrameLoadPool::attach(PushSourceSender sender)
+{
+    PushSourceSender wake;
+    Int pending{};
+    {
+        std::lock_guard lock{mutex_};
+        sender_ = std::move(sender);
+        if (!completed_.empty())
+        {
+            wake = sender_;
+            pending = static_cast<Int>(completed_.back().job.sequence);
+        }
+    }
+    static_cast<void>(wake.try_send(pending));
+}
+
+void FrameLoadPool::submit(FrameLoadJob job, bool wait)
+{
+    std::unique_lock lock{mutex_};
+    if (wait)
+    {
+        space_.wait(lock, [this] { return queued_.size() + in_flight_ < FABRIC_LOAD_QUEUE_LIMIT; });
+    }
+    else if (queued_.size() + in_flight_ + completed_.size() >= FABRIC_LOAD_QUEUE_LIMIT)
+    {
+        throw std::overflow_error("fabric load queue is full");
+    }
+    if (!off_thread_)
+    {
+        // The store's reads may not leave this thread; the caller's own drain
+        // takes the completion.
+        lock.unlock();
+        FrameLoadCompletion completion{.job = std::move(job)};
+        try
+        {
+            completion.frame = frames_.read(completion.job.key);
+        }
+        catch (...)
+        {
+            completion.error = std::current_exception();
+        }
+        lock.lock();
+        static_cast<void>(complete_locked(std::move(completion)));
+        return;
+    }
+    queued_.push_back(std::move(job));
+    if (idle_ == 0 && workers_.size() < FABRIC_LOAD_WORKERS)
+    {
+        workers_.emplace_back([this] { worker_loop(); });
+    }
+    lock.unlock();
+    work_.notify_one();
+}
+
+std::vector<FrameLoadCompletion> FrameLoadPool::take(bool wait)
+{
+    std::vector<FrameLoadCompletion> completed;
+    {
+        std::unique_lock lock{mutex_};
+        if (wait)
+        {
+            drained_.wait(lock, [this] { return queued_.empty() && in_flight_ == 0; });
+        }
+        completed.swap(completed_);
+    }
+    std::ranges::sort(completed, {}, [](const FrameLoadCompletion &item) { return item.job.sequence; });
+    return completed;
+}
+
+std::size_t FrameLoadPool::outstanding() const
+{
+    std::lock_guard lock{mutex_};
+    return queued_.size() + in_flight_ + completed_.size();
+}
+
+std::size_t FrameLoadPool::workers() const
+{
+    std::lock_guard lock{mutex_};
+    return workers_.size();
+}
+
+PushSourceSender FrameLoadPool::complete_locked(FrameLoadCompletion completion)
+{
+    completed_.push_back(std::move(completion));
+    space_.notify_one();
+    if (queued_.empty() && in_flight_ == 0)
+    {
+        drained_.notify_all();
+    }
+    return sender_;
+}
+
+void FrameLoadPool::worker_loop()
+{
+    std::unique_lock lock{mutex_};
+    for (;;)
+    {
+        ++idle_;
+        work_.wait(lock, [this] { return stopping_ || !queued_.empty(); });
+        --idle_;
+        if (stopping_)
+        {
+            return;
+        }
+        FrameLoadCompletion completion{.job = std::move(queued_.front())};
+        queued_.pop_front();
+        ++in_flight_;
+        lock.unlock();
+
+        try
+        {
+            completion.frame = frames_.read(completion.job.key);
+        }
+        catch (...)
+        {
+            completion.error = std::current_exception();
+        }
+        const auto sequence = static_cast<Int>(completion.job.sequence);
+
+        lock.lock();
+        --in_flight_;
+        PushSourceSender wake = complete_locked(std::move(completion));
+        lock.unlock();
+        static_cast<void>(wake.try_send(sequence));
+        lock.lock();
+    }
+}
+} // namespace hgraph::fabric::detail
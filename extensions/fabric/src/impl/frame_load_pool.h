@@ -0,0 +1,118 @@
+#ifndef HGRAPH_FABRIC_IMPL_FRAME_LOAD_POOL_H
+#define HGRAPH_FABRIC_IMPL_FRAME_LOAD_POOL_H
+
+#include <hgraph/fabric/types.h>
+
+#include <hgraph/persistence/frame_store.h>
+#include <hgraph/runtime/push_source_node.h>
+#include <hgraph/types/frame.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hgraph::fabric::detail
+{
+/** One Frame read handed to the load pool. ``sequence`` is assigned by the
+    graph thread in submission order and identifies the latest request made
+    under ``request_id``. */
+struct FrameLoadJob
+{
+    std::uint64_t sequence{};
+    Int request_id{};
+    Str data_id{};
+    DataVersion version{};
+    Str key{};
+};
+
+struct FrameLoadCompletion
+{
+    FrameLoadJob job{};
+    /** Empty when the key is absent. */
+    Frame frame{};
+    std::exception_ptr error{};
+};
+
+/** Reads and decodes requested Frames off the graph thread.
+
+    Up to ``FABRIC_LOAD_WORKERS`` workers are started as work arrives, so a
+    graph that never loads owns no thread. At most
+    ``FABRIC_LOAD_QUEUE_LIMIT`` requests are queued, in flight or completed
+    but not yet taken. A completed read wakes the attached push source (the
+    real-time drain); a simulation drain instead waits in ``take`` until
+    every submitted read has completed. A simulation cycle may submit more
+    requests than the limit: its submits wait for queue space instead of
+    throwing, and its completions are not counted, as the cycle's drain takes
+    all of them.
+
+    A store whose reads may not leave the calling thread (see
+    ``FrameStore::reads_off_thread``) is read inline in ``submit``, and the
+    completion is taken exactly as a worker's would be.
+
+    The mutex is taken once per submitted request and once per drain, never
+    per tick. */
+class FrameLoadPool final
+{
+  public:
+    FrameLoadPool() = default;
+    /** Stops the workers, waiting for reads in flight. */
+    ~FrameLoadPool();
+
+    FrameLoadPool(const FrameLoadPool &) = delete;
+    FrameLoadPool &operator=(const FrameLoadPool &) = delete;
+    FrameLoadPool(FrameLoadPool &&) = delete;
+    FrameLoadPool &operator=(FrameLoadPool &&) = delete;
+
+    /** Bind the store workers read from. Starts no thread. */
+    void start(persistence::store::FrameStore frames);
+    /** Stop the workers, waiting for reads in flight, and drop every request
+        not yet taken. The attached push source is kept. */
+    void stop() noexcept;
+
+    /** Wake ``sender`` whenever a read completes. Pending completions wake it
+        at once. */
+    void attach(PushSourceSender sender);
+
+    /** Queue one read. At the queue limit, throws ``std::overflow_error``,
+        or with ``wait`` blocks until fewer than the limit are queued or in
+        flight. */
+    void submit(FrameLoadJob job, bool wait);
+
+    /** Completed reads in submission order. With ``wait``, first block until
+        no submitted read is queued or in flight. */
+    [[nodiscard]] std::vector<FrameLoadCompletion> take(bool wait);
+
+    /** Requests submitted and not yet taken. */
+    [[nodiscard]] std::size_t outstanding() const;
+    [[nodiscard]] std::size_t workers() const;
+
+  private:
+    void worker_loop();
+    /** Record one completion and return the sender to wake; requires
+        ``mutex_``. */
+    [[nodiscard]] PushSourceSender complete_locked(FrameLoadCompletion completion);
+
+    persistence::store::FrameStore frames_{};
+    bool off_thread_{};
+
+    mutable std::mutex mutex_{};
+    std::condition_variable work_{};
+    std::condition_variable drained_{};
+    std::condition_variable space_{};
+    std::deque<FrameLoadJob> queued_{};
+    std::vector<FrameLoadCompletion> completed_{};
+    std::size_t in_flight_{};
+    std::size_t idle_{};
+    bool stopping_{};
+    PushSourceSender sender_{};
+
+    std::vector<std::thread> workers_{};
+};
+} // namespace hgraph::fabric::detail
+
+#endif // HGRAPH_FABRIC_IMPL_FRAME_LOAD_POOL_H
@@ -6,10 +6,12 @@
 #include <hgraph/fabric/service.h>
 
 #include <hgraph/runtime/node_scheduler.h>
+#include <hgraph/runtime/push_source_node.h>
 #include <hgraph/types/static_node.h>
 
 #include <compare>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -80,6 +82,22 @@ struct TransportEventInput
     bool fatal{};
 };
 
+struct LoadedFrame
+{
+    Int request_id{};
+    Str data_id{};
+    DataVersion version{};
+    Frame frame{};
+};
+
+/** The loads taken by one drain. ``failure`` is the first failed read; the
+    drain rethrows it once ``frames`` have been delivered. */
+struct LoadedFrames
+{
+    std::vector<LoadedFrame> frames{};
+    std::exception_ptr failure{};
+};
+
 struct FabricServicePlan
 {
     std::vector<SubscriptionSpec> live{};
@@ -157,6 +175,19 @@ class FabricServiceRuntime final
 
     [[nodiscard]] std::optional<std::tuple<Str, DataVersion, Frame>> load(std::string_view data_id,
                                                                           DataVersion version) const;
+    /** Validate a load on the graph thread and hand its read to the load
+        pool. The request supersedes any still in flight under the same id.
+        With ``wait`` (a simulation, whose drain waits for the cycle's reads)
+        a full pool blocks the submit instead of throwing. */
+    void submit_load(Int request_id, std::string_view data_id, DataVersion version, bool wait = false);
+    /** Completed loads in submission order, recording store events exactly
+        as ``load`` does. Superseded and missing Frames are dropped. A failed
+        read does not stop the drain: every completion taken is settled and
+        the first failure is returned alongside the loaded Frames. With
+        ``wait``, first wait for every submitted read to complete. */
+    [[nodiscard]] LoadedFrames take_loads(bool wait);
+    /** Real-time services wake their load drain through this push source. */
+    void attach_load_signal(PushSourceSender sender);
     /** Monotonic graph-thread sequence advanced whenever an internal
         diagnostic event is recorded. Service nodes project changes onto an
         ordinary time-series edge so diagnostics consumers are scheduled
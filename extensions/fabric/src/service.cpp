@@ -9,6 +9,7 @@
 #include <hgraph/lib/std/operators/conversion.h>
 #include <hgraph/runtime/executor.h>
 #include <hgraph/runtime/logger.h>
+#include <hgraph/runtime/push_source_node.h>
 #include <hgraph/types/metadata/value_plan_factory.h>
 #include <hgraph/types/static_node.h>
 #include <hgraph/types/value/value_builder.h>
@@ -16,8 +17,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <tuple>
+#include <typeindex>
 #include <utility>
 #include <vector>
 
@@ -495,26 +498,24 @@ struct FabricPublicationNode
     return builder.build();
 }
 
+/** Validates each modified request on the graph thread and hands its read
+    to the runtime's load pool. ``submitted`` ticks with the number handed
+    over so the drain runs later in the same cycle. In simulation (``wait``)
+    a cycle with more requests than the pool holds waits for queue space. */
 struct FabricLoadNode
 {
     static constexpr auto name = "hgraph.fabric.service.load";
 
     static void eval(In<"requests", TSD<Int, FabricLoadRequest>, InputValidity::Unchecked> requests,
                      In<"ready", TS<Bool>, InputValidity::Unchecked>,
-                     Scalar<"runtime", FabricServiceRuntimeHandle> runtime,
-                     Out<FabricServiceNodeResult<TSD<Int, FabricLoadResponse>>> result)
+                     Scalar<"runtime", FabricServiceRuntimeHandle> runtime, Scalar<"wait", Bool> wait,
+                     Out<TS<Int>> submitted)
     {
-        auto responses = result.template field<"value">();
-        auto diagnostics_changed = result.template field<"diagnostics_changed">();
-        const Int before = runtime.value().value->diagnostic_revision();
-        UnwindCleanupGuard diagnostic_change{
-            [&] { emit_diagnostic_change(before, runtime.value(), diagnostics_changed); }};
         if (!requests.modified())
         {
-            diagnostic_change.complete();
             return;
         }
-        auto mutation = responses.begin_mutation(responses.evaluation_time());
+        Int count{};
         for (const auto &[request_id, request] : requests.modified_items())
         {
             if (!request.valid())
@@ -527,19 +528,102 @@ struct FabricLoadNode
             {
                 continue;
             }
-            const auto loaded = runtime.value().value->load(requested_data_id.value(), requested_version.value());
-            if (!loaded.has_value())
-            {
-                continue;
-            }
-            auto [data_id, version, frame] = *loaded;
-            Value response = load_response_value(std::move(data_id), version, std::move(frame));
-            mutation.set(request_id, response.view());
+            runtime.value().value->submit_load(request_id.checked_as<Int>(), requested_data_id.value(),
+                                               requested_version.value(), wait.value());
+            ++count;
         }
-        diagnostic_change.complete();
+        if (count != 0)
+        {
+            submitted.set(count);
+        }
+    }
+};
+
+void deliver_loads(bool wait, const FabricServiceRuntimeHandle &runtime,
+                   const Out<FabricServiceNodeResult<TSD<Int, FabricLoadResponse>>> &result)
+{
+    auto responses = result.template field<"value">();
+    auto diagnostics_changed = result.template field<"diagnostics_changed">();
+    const Int before = runtime.value->diagnostic_revision();
+    UnwindCleanupGuard diagnostic_change{[&] { emit_diagnostic_change(before, runtime, diagnostics_changed); }};
+    auto loaded = runtime.value->take_loads(wait);
+    if (!loaded.frames.empty())
+    {
+        auto mutation = responses.begin_mutation(responses.evaluation_time());
+        for (auto &item : loaded.frames)
+        {
+            Value request_id{item.request_id};
+            Value response = load_response_value(std::move(item.data_id), item.version, std::move(item.frame));
+            mutation.set(request_id.view(), response.view());
+        }
+    }
+    diagnostic_change.complete();
+    if (loaded.failure)
+    {
+        std::rethrow_exception(loaded.failure);
+    }
+}
+
+/** Simulation drain: waits at this point of the cycle for every read the
+    cycle submitted, so responses keep the request's evaluation time and do
+    not depend on read latency. Nodes ranked between the submission and this
+    drain run while the reads are in flight. */
+struct FabricLoadDrainNode
+{
+    static constexpr auto name = "hgraph.fabric.service.load.drain";
+
+    static void eval(In<"submitted", TS<Int>>, Scalar<"runtime", FabricServiceRuntimeHandle> runtime,
+                     Out<FabricServiceNodeResult<TSD<Int, FabricLoadResponse>>> result)
+    {
+        deliver_loads(true, runtime.value(), result);
+    }
+};
+
+/** Real-time drain: never waits. Reads completed by the workers wake it
+    through the ``completed`` push source; reads a store kept on the graph
+    thread complete before ``submitted`` ticks. */
+struct FabricLoadCompletionNode
+{
+    static constexpr auto name = "hgraph.fabric.service.load.complete";
+
+    static void eval(In<"submitted", TS<Int>, InputValidity::Unchecked>,
+                     In<"completed", TS<Int>, InputValidity::Unchecked>,
+                     Scalar<"runtime", FabricServiceRuntimeHandle> runtime,
+                     Out<FabricServiceNodeResult<TSD<Int, FabricLoadResponse>>> result)
+    {
+        deliver_loads(false, runtime.value(), result);
     }
 };
 
+struct FabricLoadSignalTag
+{
+};
+
+[[nodiscard]] Port<TS<Int>> load_completion_signal(Wiring &wiring, FabricServiceRuntimeHandle runtime)
+{
+    const auto *schema = ts_type<TS<Int>>();
+    return Port<TS<Int>>{
+        wiring, wiring.add_unique_node(std::type_index(typeid(FabricLoadSignalTag)),
+                                       make_push_source_node(
+                                           *schema, make_push_source_conflating_policy(*schema->delta_value_schema),
+                                           [runtime = std::move(runtime)](PushSourceSender sender) {
+                                               runtime.value->attach_load_signal(std::move(sender));
+                                           }),
+                                       std::span<const WiringPortRef>{}, Value{})};
+}
+
+template <typename Requests, typename Ready>
+[[nodiscard]] Port<FabricServiceNodeResult<TSD<Int, FabricLoadResponse>>>
+wire_load(Wiring &wiring, Port<Requests> requests, Port<Ready> ready, const FabricServiceRuntimeHandle &runtime)
+{
+    auto submitted = wire<FabricLoadNode>(wiring, requests, ready, runtime, Bool{!wiring.is_realtime()});
+    if (!wiring.is_realtime())
+    {
+        return wire<FabricLoadDrainNode>(wiring, submitted, runtime);
+    }
+    return wire<FabricLoadCompletionNode>(wiring, submitted, load_completion_signal(wiring, runtime), runtime);
+}
+
 struct FabricDiagnosticsNode
 {
     static constexpr auto name = "hgraph.fabric.service.diagnostics";
@@ -664,7 +748,7 @@ struct FabricServiceImpl
         auto planned_replay_result = wire<FabricPlannedReplayNode>(wiring, ready, runtime);
         auto planned_live_result =
             wire<FabricPlannedLiveNode>(wiring, notices, controls, ready, notification_mode.value(), runtime);
-        auto load_result = wire<FabricLoadNode>(wiring, loads, ready, runtime);
+        auto load_result = wire_load(wiring, loads, ready, runtime);
 
         auto notification_requests = service_result_value(wiring, publication_result);
         auto snapshot = service_result_value(wiring, snapshot_result);
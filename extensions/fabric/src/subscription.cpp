@@ -1,5 +1,7 @@
 #include "impl/service_runtime.h"
 
+#include "impl/frame_load_pool.h"
+
 #include <hgraph/fabric/config.h>
 #include <hgraph/fabric/keys.h>
 #include <hgraph/fabric/metadata_codec.h>
@@ -9,7 +11,9 @@
 
 #include <algorithm>
 #include <charconv>
+#include <cstdint>
 #include <deque>
+#include <exception>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -633,6 +637,10 @@ struct FabricServiceRuntime::Impl
     std::map<Str, RevisionId, IdLess> advertised{};
     std::optional<Notifier> notification_override{};
     std::map<Str, FabricDiagnosticEventInput, IdLess> events{};
+    FrameLoadPool loads{};
+    /** Sequence of the latest load submitted under each request id. */
+    std::map<Int, std::uint64_t> load_requests{};
+    std::uint64_t load_sequence{};
     Int diagnostic_revision{};
     bool graph_notifications{};
     bool running{};
@@ -693,6 +701,47 @@ struct FabricServiceRuntime::Impl
         }
     }
 
+    [[nodiscard]] Str load_key(Str &data_id, DataVersion version) const
+    {
+        if (!running || !config.has_value())
+        {
+            throw std::logic_error("fabric service runtime is not started");
+        }
+        require_data_id(data_id);
+        if (version <= 0)
+        {
+            throw std::invalid_argument("fabric load version must be positive");
+        }
+        return data_version_key(config->prefix, data_id, version);
+    }
+
+    /** Record the store events of one finished read. False when the Frame is
+        missing; a failed read is rethrown. */
+    [[nodiscard]] bool loaded(const Str &data_id, DataVersion version, const Frame &frame,
+                              const std::exception_ptr &error)
+    {
+        if (error)
+        {
+            try
+            {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception &failure)
+            {
+                record_event("store", "frame.read", failure.what(), false, true);
+                throw;
+            }
+        }
+        if (!frame.has_value())
+        {
+            record_event("store", "frame.missing",
+                         "requested Fabric Frame is not present: " + data_id + ":" + std::to_string(version), false,
+                         false);
+            return false;
+        }
+        return true;
+    }
+
     [[nodiscard]] FabricConfig &configured()
     {
         if (!running || !config.has_value())
@@ -765,6 +814,7 @@ void FabricServiceRuntime::start(GlobalStateView global_state)
     {
         impl_->config->notifications = *impl_->notification_override;
     }
+    impl_->loads.start(impl_->config->frames);
     impl_->running = true;
 }
 
@@ -775,6 +825,8 @@ void FabricServiceRuntime::stop() noexcept
         return;
     }
     impl_->running = false;
+    impl_->loads.stop();
+    impl_->load_requests.clear();
     impl_->publishers.clear();
     impl_->publication_queues.clear();
     impl_->advertised.clear();
@@ -925,36 +977,85 @@ bool FabricServiceRuntime::publication_work_pending() const noexcept
 std::optional<std::tuple<Str, DataVersion, Frame>> FabricServiceRuntime::load(std::string_view requested_data_id,
                                                                               DataVersion version) const
 {
-    if (!impl_->running || !impl_->config.has_value())
-    {
-        throw std::logic_error("fabric service runtime is not started");
-    }
     Str data_id{requested_data_id};
-    require_data_id(data_id);
-    if (version <= 0)
-    {
-        throw std::invalid_argument("fabric load version must be positive");
-    }
+    const Str key = impl_->load_key(data_id, version);
     Frame frame;
+    std::exception_ptr error;
     try
     {
-        frame = impl_->config->frames.read(data_version_key(impl_->config->prefix, data_id, version));
+        frame = impl_->config->frames.read(key);
     }
-    catch (const std::exception &error)
+    catch (...)
     {
-        impl_->record_event("store", "frame.read", error.what(), false, true);
-        throw;
+        error = std::current_exception();
     }
-    if (!frame.has_value())
+    if (!impl_->loaded(data_id, version, frame, error))
     {
-        impl_->record_event("store", "frame.missing",
-                            "requested Fabric Frame is not present: " + data_id + ":" + std::to_string(version),
-                            false, false);
         return std::nullopt;
     }
     return std::tuple<Str, DataVersion, Frame>{std::move(data_id), version, std::move(frame)};
 }
 
+void FabricServiceRuntime::submit_load(Int request_id, std::string_view requested_data_id, DataVersion version,
+                                       bool wait)
+{
+    Str data_id{requested_data_id};
+    Str key = impl_->load_key(data_id, version);
+    const std::uint64_t sequence = ++impl_->load_sequence;
+    impl_->loads.submit(FrameLoadJob{
+        .sequence = sequence,
+        .request_id = request_id,
+        .data_id = std::move(data_id),
+        .version = version,
+        .key = std::move(key),
+    }, wait);
+    impl_->load_requests.insert_or_assign(request_id, sequence);
+}
+
+LoadedFrames FabricServiceRuntime::take_loads(bool wait)
+{
+    LoadedFrames result;
+    for (auto &completion : impl_->loads.take(wait))
+    {
+        auto &job = completion.job;
+        const auto latest = impl_->load_requests.find(job.request_id);
+        if (latest == impl_->load_requests.end() || latest->second != job.sequence)
+        {
+            continue;
+        }
+        impl_->load_requests.erase(latest);
+        try
+        {
+            if (!impl_->loaded(job.data_id, job.version, completion.frame, completion.error))
+            {
+                continue;
+            }
+        }
+        catch (...)
+        {
+            // Completions after this one were already taken from the pool;
+            // settle them before the failure is reported.
+            if (!result.failure)
+            {
+                result.failure = std::current_exception();
+            }
+            continue;
+        }
+        result.frames.push_back(LoadedFrame{
+            .request_id = job.request_id,
+            .data_id = std::move(job.data_id),
+            .version = job.version,
+            .frame = std::move(completion.frame),
+        });
+    }
+    return result;
+}
+
+void FabricServiceRuntime::attach_load_signal(PushSourceSender sender)
+{
+    impl_->loads.attach(std::move(sender));
+}
+
 Int FabricServiceRuntime::diagnostic_revision() const noexcept
 {
     return impl_->diagnostic_revision;
@@ -986,6 +1087,9 @@ std::vector<std::pair<Str, Str>> FabricServiceRuntime::diagnostics() const
         {"publication.queue_limit_per_data_id", std::to_string(FABRIC_PUBLICATION_QUEUE_LIMIT_PER_DATA_ID)},
         {"live.notices", std::to_string(live_notices)},
         {"live.notice_limit_per_session", std::to_string(FABRIC_LIVE_NOTICE_LIMIT_PER_SESSION)},
+        {"load.outstanding", std::to_string(impl_->loads.outstanding())},
+        {"load.workers", std::to_string(impl_->loads.workers())},
+        {"load.queue_limit", std::to_string(FABRIC_LOAD_QUEUE_LIMIT)},
         {"resolution.calls", std::to_string(metrics.calls)},
         {"resolution.forests.ready", std::to_string(metrics.forests_ready)},
         {"resolution.forests.unchanged",
@@ -16,6 +16,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <spdlog/sinks/ringbuffer_sink.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -24,6 +27,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -39,6 +43,8 @@ constexpr hg::DateTime BASE_TIME{hg::TimeDelta{1'800'000'000'000'000}};
 std::vector<std::pair<hg::DateTime, std::int64_t>> observed_frames{};
 std::vector<std::tuple<hg::DateTime, hg::Str, std::int64_t>> observed_tagged_frames{};
 std::map<hg::Str, hgf::FabricDiagnosticEventInput> observed_diagnostic_events{};
+/** Written on the graph thread of a real-time run, read by the test. */
+std::atomic<std::int64_t> observed_realtime_load{0};
 
 struct CapturedLog
 {
@@ -144,6 +150,33 @@ struct CountingFrameContext
     return ops;
 }
 
+/** Wraps a store whose reads fail for every key naming ``broken``. */
+struct FailingFrameContext
+{
+    hgps::FrameStore store{};
+};
+
+[[nodiscard]] const hgps::FrameStoreOps &failing_frame_ops()
+{
+    static const hgps::FrameStoreOps ops{
+        [](void *context, std::string_view key, hg::Frame value, std::optional<hgps::Compression> compression) {
+            static_cast<FailingFrameContext *>(context)->store.write(key, std::move(value), compression);
+        },
+        [](void *context, std::string_view key) {
+            if (key.find("broken") != std::string_view::npos)
+            {
+                throw std::runtime_error("test Frame read failed");
+            }
+            return static_cast<FailingFrameContext *>(context)->store.read(key);
+        },
+        [](void *context, std::string_view key) {
+            return static_cast<FailingFrameContext *>(context)->store.contains(key);
+        },
+        [](void *context) { static_cast<FailingFrameContext *>(context)->store.clear(); },
+    };
+    return ops;
+}
+
 [[nodiscard]] hgf::FabricConfig counting_config(const hgf::FabricConfig &base, std::shared_ptr<IoCounters> counters)
 {
     hgf::FabricConfig result = base;
@@ -491,6 +524,31 @@ struct LoadGraph
     }
 };
 
+struct CaptureRealtimeLoad
+{
+    static constexpr auto name = "hgraph.fabric.test.capture_realtime_load";
+
+    static void eval(hg::In<"loaded", hgf::FabricLoadResponse> loaded)
+    {
+        const auto value = loaded.template field<"frame">();
+        if (value.modified() && value.valid())
+        {
+            observed_realtime_load.store(frame_value(value.value()));
+        }
+    }
+};
+
+struct RealtimeLoadGraph
+{
+    static constexpr auto name = "hgraph.fabric.test.realtime_load";
+
+    static void compose(hg::Wiring &wiring)
+    {
+        hgf::register_service(wiring);
+        static_cast<void>(hg::wire<CaptureRealtimeLoad>(wiring, hgf::request_load(wiring, "prices", 2)));
+    }
+};
+
 struct CaptureDiagnostics
 {
     static constexpr auto name = "hgraph.fabric.test.capture_diagnostics";
@@ -939,6 +997,149 @@ TEST_CASE("service diagnostics retain typed transport and store events")
     CHECK(events.at("kafka.disconnect").occurrences == 1);
 }
 
+TEST_CASE("submitted loads are read by the pool and delivered in submission order")
+{
+    auto config = hgf::make_memory_fabric_config("tests/subscription/async-load");
+    for (hgf::DataVersion version = 1; version <= 3; ++version)
+    {
+        config.frames.write(hgf::data_version_key(config.prefix, "prices", version), frame(version));
+    }
+    hgf::detail::FabricServicePlanHandle plan{
+        std::make_shared<hgf::detail::FabricServicePlan>()};
+    hgf::detail::FabricServiceRuntime runtime{std::move(plan)};
+    hg::GlobalContext context;
+    hgf::set_fabric_config(context.state().view(), config);
+    runtime.start(context.state().view());
+
+    runtime.submit_load(1, "prices", 1);
+    runtime.submit_load(2, "prices", 2);
+    runtime.submit_load(1, "prices", 3);
+    runtime.submit_load(3, "missing", 1);
+    CHECK_THROWS_AS(runtime.submit_load(4, "prices", 0), std::invalid_argument);
+
+    const auto loaded = runtime.take_loads(true);
+    CHECK_FALSE(loaded.failure);
+    REQUIRE(loaded.frames.size() == 2);
+    CHECK(loaded.frames[0].request_id == 2);
+    CHECK(frame_value(loaded.frames[0].frame) == 2);
+    CHECK(loaded.frames[1].request_id == 1);
+    CHECK(loaded.frames[1].version == 3);
+    CHECK(frame_value(loaded.frames[1].frame) == 3);
+    CHECK(runtime.take_loads(true).frames.empty());
+
+    const auto values = runtime.diagnostics();
+    const std::map<hg::Str, hg::Str> diagnostics{values.begin(), values.end()};
+    CHECK(diagnostics.at("load.outstanding") == "0");
+    CHECK(std::stoull(diagnostics.at("load.workers")) >= 1);
+    CHECK(std::stoull(diagnostics.at("load.workers")) <= hgf::FABRIC_LOAD_WORKERS);
+    const auto events = runtime.events();
+    CHECK(std::ranges::any_of(events, [](const auto &event) { return event.first == "store.frame.missing"; }));
+}
+
+TEST_CASE("a failed load read still delivers the loads taken with it")
+{
+    auto base = hgf::make_memory_fabric_config("tests/subscription/failed-load");
+    hgf::FabricConfig config = base;
+    config.frames = hgps::FrameStore{std::make_shared<FailingFrameContext>(FailingFrameContext{.store = base.frames}),
+                                     failing_frame_ops()};
+    config.frames.write(hgf::data_version_key(config.prefix, "prices", 2), frame(2));
+    hgf::detail::FabricServicePlanHandle plan{
+        std::make_shared<hgf::detail::FabricServicePlan>()};
+    hgf::detail::FabricServiceRuntime runtime{std::move(plan)};
+    hg::GlobalContext context;
+    hgf::set_fabric_config(context.state().view(), config);
+    runtime.start(context.state().view());
+
+    runtime.submit_load(1, "broken", 1);
+    runtime.submit_load(2, "prices", 2);
+
+    const auto loaded = runtime.take_loads(true);
+    REQUIRE(loaded.failure);
+    CHECK_THROWS_AS(std::rethrow_exception(loaded.failure), std::runtime_error);
+    REQUIRE(loaded.frames.size() == 1);
+    CHECK(loaded.frames[0].request_id == 2);
+    CHECK(frame_value(loaded.frames[0].frame) == 2);
+
+    const auto again = runtime.take_loads(true);
+    CHECK_FALSE(again.failure);
+    CHECK(again.frames.empty());
+    const auto values = runtime.diagnostics();
+    const std::map<hg::Str, hg::Str> diagnostics{values.begin(), values.end()};
+    CHECK(diagnostics.at("load.outstanding") == "0");
+    const auto events = runtime.events();
+    CHECK(std::ranges::any_of(events, [](const auto &event) { return event.first == "store.frame.read"; }));
+}
+
+TEST_CASE("a simulation cycle may submit more loads than the pool holds")
+{
+    auto config = hgf::make_memory_fabric_config("tests/subscription/load-backpressure");
+    config.frames.write(hgf::data_version_key(config.prefix, "prices", 1), frame(1));
+    hgf::detail::FabricServicePlanHandle plan{
+        std::make_shared<hgf::detail::FabricServicePlan>()};
+    hgf::detail::FabricServiceRuntime runtime{std::move(plan)};
+    hg::GlobalContext context;
+    hgf::set_fabric_config(context.state().view(), config);
+    runtime.start(context.state().view());
+
+    // One simulation cycle: every submit waits for queue space, then the
+    // drain takes all of them together.
+    constexpr hg::Int requests = static_cast<hg::Int>(hgf::FABRIC_LOAD_QUEUE_LIMIT) + 100;
+    for (hg::Int request_id = 1; request_id <= requests; ++request_id)
+    {
+        runtime.submit_load(request_id, "prices", 1, true);
+    }
+    const auto loaded = runtime.take_loads(true);
+    CHECK_FALSE(loaded.failure);
+    REQUIRE(loaded.frames.size() == static_cast<std::size_t>(requests));
+    for (std::size_t index = 0; index < loaded.frames.size(); ++index)
+    {
+        CHECK(loaded.frames[index].request_id == static_cast<hg::Int>(index) + 1);
+    }
+    CHECK(frame_value(loaded.frames.back().frame) == 1);
+
+    // A real-time submit still refuses work past the limit: completions not
+    // yet taken by its drain count against it.
+    for (hg::Int request_id = 1; request_id <= static_cast<hg::Int>(hgf::FABRIC_LOAD_QUEUE_LIMIT); ++request_id)
+    {
+        runtime.submit_load(request_id, "prices", 1);
+    }
+    CHECK_THROWS_AS(runtime.submit_load(requests + 1, "prices", 1), std::overflow_error);
+    CHECK(runtime.take_loads(true).frames.size() == hgf::FABRIC_LOAD_QUEUE_LIMIT);
+}
+
+TEST_CASE("a real-time load drain wakes when a pool read completes")
+{
+    hg::stdlib::register_standard_operators();
+    hgf::register_fabric_operators();
+    auto config = hgf::make_memory_fabric_config("tests/subscription/realtime-load");
+    REQUIRE(config.frames.reads_off_thread());
+    static_cast<void>(seed(config, "prices", 1, 2, BASE_TIME + hg::TimeDelta{1}));
+    observed_realtime_load = 0;
+
+    auto graph = hg::build_graph<RealtimeLoadGraph>(hg::WiringOptions{.is_realtime = true});
+    hgf::set_fabric_config(graph.global_state(), config);
+    const hg::DateTime start = hg::testing::wall_now();
+    hg::GraphExecutorBuilder builder;
+    builder.graph_builder(std::move(graph))
+        .mode(hg::GraphExecutorMode::RealTime)
+        .start_time(start)
+        .end_time(start + hg::TimeDelta{10'000'000});
+    auto executor = builder.make_executor();
+    auto view = executor.view();
+    {
+        hg::testing::AsyncGraphExecutorRun runner{view};
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (observed_realtime_load.load() == 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        view.request_stop();
+        runner.join();
+    }
+
+    CHECK(observed_realtime_load.load() == 2);
+}
+
 TEST_CASE("stalled service queues and diagnostic paths enforce hard bounds")
 {
     SECTION("publication requests")
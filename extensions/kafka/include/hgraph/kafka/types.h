@@ -379,7 +379,7 @@ namespace hgraph::kafka
     using KafkaConsumerDefaults =
         Bundle<"hgraph.kafka::KafkaConsumerDefaults", Field<"ingress_record_limit", Int>, Field<"ingress_byte_limit", Int>,
                Field<"inbound_overflow", KafkaOverflowAction>, Field<"failure_policy", KafkaFailurePolicy>,
-               Field<"options", HomogeneousTuple<KafkaOption>>>;
+               Field<"consume_batch_limit", Int>, Field<"options", HomogeneousTuple<KafkaOption>>>;
 
     using KafkaProducerOptions =
         Bundle<"hgraph.kafka::KafkaProducerOptions", Field<"idempotent", Bool>, Field<"acknowledgements", Str>,
@@ -43,6 +43,7 @@ namespace hgraph::kafka
         ServiceConfigBuilder &outbound_limits(Int records, Int bytes);
         ServiceConfigBuilder &inbound_overflow(KafkaOverflowAction value);
         ServiceConfigBuilder &consumer_failure_policy(KafkaFailurePolicy value);
+        ServiceConfigBuilder &consume_batch_limit(Int value);
         ServiceConfigBuilder &outbound_overflow(KafkaOverflowAction value,
                                                 KafkaOverflowAction stage_full = KafkaOverflowAction::Fail);
         ServiceConfigBuilder &shutdown_drain_timeout(std::chrono::milliseconds value);
@@ -70,6 +71,7 @@ namespace hgraph::kafka
         std::vector<KafkaOptionInput> producer_options_{};
         KafkaOverflowAction           inbound_overflow_{KafkaOverflowAction::Fail};
         KafkaFailurePolicy            consumer_failure_policy_{KafkaFailurePolicy::Report};
+        Int                           consume_batch_limit_{256};
         KafkaOverflowAction           outbound_overflow_{KafkaOverflowAction::Stage};
         KafkaOverflowAction           stage_overflow_{KafkaOverflowAction::Fail};
         Int                           shutdown_drain_timeout_ms_{5'000};
@@ -134,7 +136,8 @@ namespace hgraph::kafka
         KafkaOverflowAction outbound_overflow       = KafkaOverflowAction::Stage,
         KafkaOverflowAction stage_overflow = KafkaOverflowAction::Fail, Int shutdown_drain_timeout_ms = 5'000,
         KafkaFailurePolicy producer_failure_policy = KafkaFailurePolicy::Report, Str producer_acknowledgements = "all",
-        Int producer_retries = 2'147'483'647, Int producer_linger_ms = 5, Int producer_batch_record_limit = 1'000);
+        Int producer_retries = 2'147'483'647, Int producer_linger_ms = 5, Int producer_batch_record_limit = 1'000,
+        Int consume_batch_limit = 256);
 
     [[nodiscard]] HGRAPH_KAFKA_EXPORT Value make_subscription_key(
         std::vector<Str> topics, Str group_id, Str start_position = "committed:earliest", Str stop_position = "unbounded",
@@ -198,11 +198,14 @@ class KafkaConsumerDefaults(CompoundScalar, namespace=_NAMESPACE):
     ingress_byte_limit: int = 64 * 1024 * 1024
     inbound_overflow: KafkaOverflowAction = KafkaOverflowAction.FAIL
     failure_policy: KafkaFailurePolicy = KafkaFailurePolicy.REPORT
+    consume_batch_limit: int = 256
     options: tuple[KafkaOption, ...] = ()
 
     def __post_init__(self) -> None:
         if self.ingress_record_limit <= 0 or self.ingress_byte_limit <= 0:
             raise ValueError("Kafka ingress limits must be positive")
+        if self.consume_batch_limit <= 0:
+            raise ValueError("Kafka consume batch limit must be positive")
         if self.inbound_overflow == KafkaOverflowAction.STAGE:
             raise ValueError("Kafka inbound overflow cannot use Stage")
 
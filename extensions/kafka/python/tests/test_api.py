@@ -86,6 +86,7 @@ def test_compound_scalar_api_preserves_nullable_and_ordered_values() -> None:
         ),
         lambda: kafka.KafkaCursor("", 0, "", -1, -1),
         lambda: kafka.KafkaConsumerDefaults(ingress_record_limit=0),
+        lambda: kafka.KafkaConsumerDefaults(consume_batch_limit=0),
         lambda: kafka.KafkaConsumerDefaults(
             inbound_overflow=kafka.KafkaOverflowAction.STAGE
         ),
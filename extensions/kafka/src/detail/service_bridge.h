@@ -269,6 +269,45 @@ public:
     return push_impl(channel, std::move(value), retained_bytes, true, false);
   }
 
+  struct BatchedOutput {
+    Value value{};
+    std::size_t retained_bytes{};
+  };
+
+  /** Admit ``outputs`` in order as ordinary payload values, stopping at the
+   *  first one the limits reject. Each value is checked exactly as a
+   *  sequence of ``push`` calls would check it, but the burst takes the
+   *  bridge lock once and publishes at most one conflated wake. Returns the
+   *  number admitted; the rejected value and those after it are left
+   *  untouched. */
+  std::size_t push_batch(OutputChannel channel,
+                         std::span<BatchedOutput> outputs) {
+    PushSourceSender wake;
+    Int generation{};
+    std::size_t accepted{};
+    {
+      std::lock_guard lock{mutex_};
+      auto &state = at(channel);
+      bool wake_needed{};
+      for (auto &output : outputs) {
+        if (!enqueue_locked(channel, state, std::move(output.value),
+                            output.retained_bytes, false, false,
+                            wake_needed)) {
+          break;
+        }
+        ++accepted;
+      }
+      if (!wake_needed) {
+        return accepted;
+      }
+      state.wake_outstanding = true;
+      generation = ++state.generation;
+      wake = state.sender;
+    }
+    wake.send_blocking(generation);
+    return accepted;
+  }
+
   [[nodiscard]] std::optional<QueuedOutput> pop(OutputChannel channel) {
     std::optional<QueuedOutput> result;
     {
@@ -318,6 +357,20 @@ public:
                         item.recovery && record_time_recoveries_pending_ != 0};
   }
 
+  /** Scheduling state of the head value, as ``peek`` reports it, without
+   *  copying the value itself. */
+  [[nodiscard]] std::optional<QueuedOutput>
+  peek_schedule(OutputChannel channel) const {
+    std::lock_guard lock{mutex_};
+    const auto &state = at(channel);
+    if (state.values.empty()) {
+      return std::nullopt;
+    }
+    const auto &item = state.values.front();
+    return QueuedOutput{Value{}, item.evaluation_time,
+                        item.recovery && record_time_recoveries_pending_ != 0};
+  }
+
   [[nodiscard]] std::size_t pending(OutputChannel channel) const {
     std::lock_guard lock{mutex_};
     return at(channel).values.size();
@@ -500,49 +553,12 @@ private:
     {
       std::lock_guard lock{mutex_};
       auto &state = at(channel);
-      const auto limits = control && record_time_recovery_controls_pending_ != 0
-                              ? state.recovery_control_limits
-                              : (control ? state.control_limits : state.limits);
-      const auto records =
-          control ? state.control_records : state.payload_records;
-      const auto bytes = control ? state.control_bytes : state.payload_bytes;
-      const bool recovery_full =
-          recovery &&
-          (record_time_recoveries_pending_ == 0 ||
-           state.recovery_records >= state.recovery_limits.records ||
-           retained_bytes >
-               state.recovery_limits.bytes -
-                   std::min(state.recovery_bytes, state.recovery_limits.bytes));
-      const bool ordinary_full =
-          !recovery &&
-          (limits.records == 0 || limits.bytes == 0 ||
-           records + (control ? 0 : state.reserved_records) >= limits.records ||
-           retained_bytes >
-               limits.bytes -
-                   std::min(bytes + (control ? 0 : state.reserved_bytes),
-                            limits.bytes));
-      if (!accepting_ || recovery_full || ordinary_full) {
+      bool wake_needed{};
+      if (!enqueue_locked(channel, state, std::move(value), retained_bytes,
+                          control, recovery, wake_needed)) {
         return false;
       }
-      state.retained_bytes += retained_bytes;
-      if (control) {
-        ++state.control_records;
-        state.control_bytes += retained_bytes;
-      } else {
-        ++state.payload_records;
-        state.payload_bytes += retained_bytes;
-      }
-      if (recovery) {
-        ++state.recovery_records;
-        state.recovery_bytes += retained_bytes;
-      }
-      QueuedValue item{std::move(value), retained_bytes, control, recovery};
-      item.evaluation_time = queued_evaluation_time(channel, item.value);
-      inherit_subscription_schedule(channel, state, item);
-      const auto position = insertion_point(channel, state, item);
-      const bool became_head = position == state.values.begin();
-      state.values.insert(position, std::move(item));
-      if (!state.wake_outstanding || became_head) {
+      if (wake_needed) {
         state.wake_outstanding = true;
         generation = ++state.generation;
         wake = state.sender;
@@ -551,6 +567,7 @@ private:
     wake.send_blocking(generation);
     return true;
   }
+
   struct QueuedValue {
     Value value{};
     std::size_t retained_bytes{};
@@ -579,6 +596,58 @@ private:
     bool wake_outstanding{};
   };
 
+  /** Admission check and insertion for one value; the caller holds
+   *  ``mutex_`` and publishes the wake when ``wake_needed`` is set. */
+  [[nodiscard]] bool enqueue_locked(OutputChannel channel, Channel &state,
+                                    Value &&value, std::size_t retained_bytes,
+                                    bool control, bool recovery,
+                                    bool &wake_needed) {
+    const auto limits = control && record_time_recovery_controls_pending_ != 0
+                            ? state.recovery_control_limits
+                            : (control ? state.control_limits : state.limits);
+    const auto records =
+        control ? state.control_records : state.payload_records;
+    const auto bytes = control ? state.control_bytes : state.payload_bytes;
+    const bool recovery_full =
+        recovery &&
+        (record_time_recoveries_pending_ == 0 ||
+         state.recovery_records >= state.recovery_limits.records ||
+         retained_bytes >
+             state.recovery_limits.bytes -
+                 std::min(state.recovery_bytes, state.recovery_limits.bytes));
+    const bool ordinary_full =
+        !recovery &&
+        (limits.records == 0 || limits.bytes == 0 ||
+         records + (control ? 0 : state.reserved_records) >= limits.records ||
+         retained_bytes >
+             limits.bytes -
+                 std::min(bytes + (control ? 0 : state.reserved_bytes),
+                          limits.bytes));
+    if (!accepting_ || recovery_full || ordinary_full) {
+      return false;
+    }
+    state.retained_bytes += retained_bytes;
+    if (control) {
+      ++state.control_records;
+      state.control_bytes += retained_bytes;
+    } else {
+      ++state.payload_records;
+      state.payload_bytes += retained_bytes;
+    }
+    if (recovery) {
+      ++state.recovery_records;
+      state.recovery_bytes += retained_bytes;
+    }
+    QueuedValue item{std::move(value), retained_bytes, control, recovery};
+    item.evaluation_time = queued_evaluation_time(channel, item.value);
+    inherit_subscription_schedule(channel, state, item);
+    const auto position = insertion_point(channel, state, item);
+    const bool became_head = position == state.values.begin();
+    state.values.insert(position, std::move(item));
+    wake_needed = wake_needed || !state.wake_outstanding || became_head;
+    return true;
+  }
+
   [[nodiscard]] static std::optional<DateTime>
   queued_evaluation_time(OutputChannel channel, const Value &value) {
     if (channel != OutputChannel::Subscription) {
@@ -700,7 +769,8 @@ struct SubscriptionDrainNode {
   eval(In<"signal", TS<Int>>, Scalar<"bridge", ServiceBridgeHandle> bridge,
        SingleShotScheduler scheduler,
        Out<TSD<KafkaSubscriptionKey, KafkaSubscriptionOutput>> out) {
-    auto next = bridge.value().value->peek(OutputChannel::Subscription);
+    auto next =
+        bridge.value().value->peek_schedule(OutputChannel::Subscription);
     if (!next.has_value()) {
       return;
     }
@@ -733,13 +803,13 @@ struct SubscriptionDrainNode {
         const auto cursor = fields.at("cursor");
         const auto state = fields.at("state");
         if (record.data() != nullptr) {
-          value.set("record", record.clone());
+          value.set("record", record);
         }
         if (cursor.data() != nullptr) {
-          value.set("cursor", cursor.clone());
+          value.set("cursor", cursor);
         }
         if (state.data() != nullptr) {
-          value.set("state", state.clone());
+          value.set("state", state);
         }
         Value update = value.build();
         mutation.set(fields.at("subscription_key"), update.view());
@@ -748,7 +818,8 @@ struct SubscriptionDrainNode {
         }
       }
 
-      next = bridge.value().value->peek(OutputChannel::Subscription);
+      next = bridge.value().value->peek_schedule(
+          OutputChannel::Subscription);
       if (!next.has_value()) {
         return;
       }
@@ -37,6 +37,7 @@
 #include <mutex>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -160,6 +161,7 @@ struct RuntimeConfig {
   std::int64_t linger_ms{};
   std::int64_t batch_record_limit{};
   OutputLimits ingress{};
+  std::size_t consume_batch_limit{};
   OutputLimits outbound{};
   KafkaOverflowAction inbound_overflow{KafkaOverflowAction::Fail};
   KafkaFailurePolicy consumer_failure_policy{KafkaFailurePolicy::Report};
@@ -205,6 +207,8 @@ struct RuntimeConfig {
                      "ingress record limit"),
       positive_limit(consumer.at("ingress_byte_limit"), "ingress byte limit"),
   };
+  result.consume_batch_limit =
+      positive_limit(consumer.at("consume_batch_limit"), "consume batch limit");
   result.outbound = OutputLimits{
       positive_limit(producer.at("outbound_record_limit"),
                      "outbound record limit"),
@@ -682,6 +686,8 @@ private:
                             rd_kafka_topic_partition_list_t *partitions);
   void handle_poll_error(rd_kafka_resp_err_t error, const char *message);
   void consume(rd_kafka_message_t *message);
+  void flush_subscription_batch();
+  void report_ingress_overflow();
   void process_commits(rd_kafka_t *consumer);
   void check_positions(rd_kafka_t *consumer);
   void update_flow_control(rd_kafka_t *consumer);
@@ -733,6 +739,8 @@ private:
   bool bounded_after_recovery_{};
   std::deque<BufferedRecord> recovery_records_{};
   std::size_t recovery_bytes_{};
+  bool batching_{};
+  std::vector<ServiceBridge::BatchedOutput> subscription_batch_{};
   std::optional<DateTime> last_recovery_evaluation_time_{};
   bool record_time_recovery_participant_{};
   bool record_time_recovery_arrived_{};
@@ -1003,6 +1011,22 @@ public:
     return pending >= high_records || bytes >= high_bytes;
   }
 
+  /** Records one live poll may publish without crossing the high watermark,
+   *  so batching never outruns the pause that flow control would apply
+   *  between single polls. Always at least one. */
+  [[nodiscard]] std::size_t ingress_batch_headroom() const {
+    const auto limit = config_.consume_batch_limit;
+    if (simulation_) {
+      return limit;
+    }
+    const auto pending =
+        bridge_.value->payload_pending(OutputChannel::Subscription);
+    const auto high_records =
+        std::max<std::size_t>(1, config_.ingress.records * 4 / 5);
+    return std::clamp<std::size_t>(
+        high_records - std::min(pending, high_records), 1, limit);
+  }
+
   [[nodiscard]] bool ingress_below_low_watermark() const {
     if (simulation_) {
       return true;
@@ -1036,6 +1060,22 @@ public:
         retained_bytes);
   }
 
+  [[nodiscard]] ServiceBridge::BatchedOutput
+  batched_subscription(Value key, Value record, Value cursor,
+                       KafkaSubscriptionState state,
+                       std::size_t retained_bytes) {
+    return ServiceBridge::BatchedOutput{
+        .value = subscription_envelope(std::move(key), std::move(record),
+                                       std::move(cursor), state, std::nullopt),
+        .retained_bytes = retained_bytes,
+    };
+  }
+
+  std::size_t
+  emit_subscription_batch(std::span<ServiceBridge::BatchedOutput> outputs) {
+    return bridge_.value->push_batch(OutputChannel::Subscription, outputs);
+  }
+
   bool emit_recovery_subscription(Value key, std::optional<Value> record,
                                   std::optional<Value> cursor,
                                   KafkaSubscriptionState state,
@@ -1769,15 +1809,29 @@ void ConsumerSession::run() noexcept {
           continue;
         }
       }
-      rd_kafka_message_t *message = rd_kafka_consumer_poll(consumer, 50);
-      if (message) {
+      // Drain what librdkafka has already fetched, up to the batch limit, and
+      // publish the burst with one bridge lock and one graph wake. Only the
+      // first poll waits: rd_kafka_consume_batch_queue would instead hold a
+      // partial batch until the timeout expired.
+      const std::size_t batch_limit = owner_.ingress_batch_headroom();
+      batching_ = true;
+      for (std::size_t polled = 0; polled < batch_limit && !stopping_;
+           ++polled) {
+        rd_kafka_message_t *message =
+            rd_kafka_consumer_poll(consumer, polled == 0 ? 50 : 0);
+        if (!message) {
+          break;
+        }
         if (message->err == RD_KAFKA_RESP_ERR_NO_ERROR) {
           consume(message);
         } else if (message->err != RD_KAFKA_RESP_ERR__PARTITION_EOF) {
+          flush_subscription_batch();
           handle_poll_error(message->err, rd_kafka_message_errstr(message));
         }
         rd_kafka_message_destroy(message);
       }
+      flush_subscription_batch();
+      batching_ = false;
       check_positions(consumer);
     }
     process_commits(consumer);
@@ -1881,6 +1935,12 @@ void ConsumerSession::poll_manual_reconnect(rd_kafka_t *consumer) {
 void ConsumerSession::configure_assignment(
     rd_kafka_t *consumer, rd_kafka_resp_err_t error,
     rd_kafka_topic_partition_list_t *partitions) {
+  if (batching_) {
+    // A rebalance runs inside rd_kafka_consumer_poll, partway through a
+    // batch: publish the records polled under the previous assignment
+    // before any state change of the new one.
+    flush_subscription_batch();
+  }
   if (error == RD_KAFKA_RESP_ERR__ASSIGN_PARTITIONS) {
     // Assignment generations are runtime-wide rather than
     // session-local. A removed and later re-added subscription must
@@ -2328,26 +2388,52 @@ void ConsumerSession::consume(rd_kafka_message_t *message) {
     });
     return;
   }
+  const auto state = recovering_ ? KafkaSubscriptionState::Recovering
+                                 : KafkaSubscriptionState::Live;
+  if (batching_) {
+    subscription_batch_.push_back(owner_.batched_subscription(
+        key_.clone(), std::move(record), std::move(cursor), state, retained));
+    return;
+  }
   if (!owner_.emit_subscription(key_.clone(), std::move(record),
-                                std::move(cursor),
-                                recovering_ ? KafkaSubscriptionState::Recovering
-                                            : KafkaSubscriptionState::Live,
-                                retained)) {
-    const bool dropped =
-        owner_.config().inbound_overflow == KafkaOverflowAction::Drop;
-    owner_.emit_event(dropped ? KafkaSeverity::Warning : KafkaSeverity::Fatal,
-                      Str{"consumer"}, Str{"queue_overflow"},
-                      RD_KAFKA_RESP_ERR__QUEUE_FULL, false, !dropped,
-                      dropped ? Str{"Kafka record was dropped because the "
-                                    "bounded ingress queue is full"}
-                              : Str{"bounded ingress queue is full"},
-                      spec_.identity, {},
-                      !dropped && owner_.config().consumer_failure_policy ==
-                                      KafkaFailurePolicy::StopGraph);
-    if (!dropped) {
-      failed_ = true;
-      stopping_ = true;
+                                std::move(cursor), state, retained)) {
+    report_ingress_overflow();
+  }
+}
+
+void ConsumerSession::flush_subscription_batch() {
+  std::span<ServiceBridge::BatchedOutput> pending{subscription_batch_};
+  while (!pending.empty()) {
+    // Admission stops at the first rejected record, exactly where a
+    // sequence of single pushes would have reported the overflow.
+    const std::size_t accepted = owner_.emit_subscription_batch(pending);
+    if (accepted == pending.size()) {
+      break;
+    }
+    report_ingress_overflow();
+    if (stopping_) {
+      break;
     }
+    pending = pending.subspan(accepted + 1);
+  }
+  subscription_batch_.clear();
+}
+
+void ConsumerSession::report_ingress_overflow() {
+  const bool dropped =
+      owner_.config().inbound_overflow == KafkaOverflowAction::Drop;
+  owner_.emit_event(dropped ? KafkaSeverity::Warning : KafkaSeverity::Fatal,
+                    Str{"consumer"}, Str{"queue_overflow"},
+                    RD_KAFKA_RESP_ERR__QUEUE_FULL, false, !dropped,
+                    dropped ? Str{"Kafka record was dropped because the "
+                                  "bounded ingress queue is full"}
+                            : Str{"bounded ingress queue is full"},
+                    spec_.identity, {},
+                    !dropped && owner_.config().consumer_failure_policy ==
+                                    KafkaFailurePolicy::StopGraph);
+  if (!dropped) {
+    failed_ = true;
+    stopping_ = true;
   }
 }
 
@@ -2710,6 +2796,10 @@ void ConsumerSession::check_positions(rd_kafka_t *consumer) {
 
 void ConsumerSession::emit_state(KafkaSubscriptionState state,
                                  std::optional<DateTime> evaluation_time) {
+  // Records already batched were polled before this state change.
+  if (batching_) {
+    flush_subscription_batch();
+  }
   owner_.emit_subscription_state(key_.clone(), state, evaluation_time);
 }
 
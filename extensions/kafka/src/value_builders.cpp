@@ -236,6 +236,11 @@ namespace hgraph::kafka
         return *this;
     }
 
+    ServiceConfigBuilder &ServiceConfigBuilder::consume_batch_limit(Int value) {
+        consume_batch_limit_ = value;
+        return *this;
+    }
+
     ServiceConfigBuilder &ServiceConfigBuilder::outbound_overflow(KafkaOverflowAction value, KafkaOverflowAction stage_full) {
         outbound_overflow_ = value;
         stage_overflow_    = stage_full;
@@ -272,7 +277,8 @@ namespace hgraph::kafka
             bootstrap_servers_, client_id_, idempotent_producer_, ingress_record_limit_, ingress_byte_limit_,
             outbound_record_limit_, outbound_byte_limit_, common_options_, consumer_options_, producer_options_, inbound_overflow_,
             consumer_failure_policy_, outbound_overflow_, stage_overflow_, shutdown_drain_timeout_ms_, producer_failure_policy_,
-            producer_acknowledgements_, producer_retries_, producer_linger_ms_, producer_batch_record_limit_);
+            producer_acknowledgements_, producer_retries_, producer_linger_ms_, producer_batch_record_limit_,
+            consume_batch_limit_);
     }
 
     ServiceConfigBuilder service_config() { return {}; }
@@ -463,7 +469,7 @@ namespace hgraph::kafka
                               KafkaFailurePolicy consumer_failure_policy, KafkaOverflowAction outbound_overflow,
                               KafkaOverflowAction stage_overflow, Int shutdown_drain_timeout_ms,
                               KafkaFailurePolicy producer_failure_policy, Str producer_acknowledgements, Int producer_retries,
-                              Int producer_linger_ms, Int producer_batch_record_limit) {
+                              Int producer_linger_ms, Int producer_batch_record_limit, Int consume_batch_limit) {
         register_kafka_types();
         if (bootstrap_servers.empty()) {
             throw std::invalid_argument("Kafka service config requires at least one bootstrap server");
@@ -485,6 +491,7 @@ namespace hgraph::kafka
         if (producer_retries < 0 || producer_linger_ms < 0 || producer_batch_record_limit <= 0) {
             throw std::invalid_argument("Kafka producer retry/batch settings are out of range");
         }
+        if (consume_batch_limit <= 0) { throw std::invalid_argument("Kafka consume batch limit must be positive"); }
         if (inbound_overflow == KafkaOverflowAction::Stage) {
             throw std::invalid_argument("Kafka inbound overflow cannot use Stage");
         }
@@ -502,6 +509,7 @@ namespace hgraph::kafka
             {"ingress_byte_limit", atomic(ingress_byte_limit)},
             {"inbound_overflow", atomic(inbound_overflow)},
             {"failure_policy", atomic(consumer_failure_policy)},
+            {"consume_batch_limit", atomic(consume_batch_limit)},
             {"options", options(std::move(consumer_options))},
         });
         Value producer   = bundle<KafkaProducerOptions>({
@@ -81,6 +81,35 @@ void test_bridge_wake_handles_graph_teardown() {
   bridge.stop();
 }
 
+void test_bridge_batch_admission_stops_at_first_rejection() {
+  using hgraph::kafka::detail::OutputChannel;
+  using BatchedOutput = hgraph::kafka::detail::ServiceBridge::BatchedOutput;
+  hgraph::kafka::detail::ServiceBridge bridge{{3, 4096}, {3, 4096},
+                                               {3, 4096}};
+  bridge.start(false);
+
+  std::vector<BatchedOutput> burst;
+  for (Int value = 0; value < 5; ++value) {
+    burst.push_back(BatchedOutput{Value{value}, sizeof(Int)});
+  }
+  require(bridge.push_batch(OutputChannel::Event, burst) == 3,
+          "a Kafka bridge batch was not admitted up to its record limit");
+  require(bridge.pending(OutputChannel::Event) == 3,
+          "a Kafka bridge batch queued past its record limit");
+  require(burst[3].value.has_value() && burst[4].value.has_value(),
+          "rejected Kafka bridge batch values were consumed");
+  for (Int expected = 0; expected < 3; ++expected) {
+    const auto queued = bridge.pop(OutputChannel::Event);
+    require(queued.has_value() &&
+                queued->value.view().checked_as<Int>() == expected,
+            "a Kafka bridge batch was not queued in order");
+  }
+  require(bridge.push_batch(OutputChannel::Event,
+                            std::span{burst}.subspan(3)) == 2,
+          "a Kafka bridge batch remainder was not admitted after a drain");
+  bridge.stop();
+}
+
 template <typename Fn> void require_invalid(Fn &&fn, std::string message) {
   bool rejected = false;
   try {
@@ -1038,6 +1067,7 @@ void test_public_value_validation_and_producer_configuration() {
                                .producer_retries(Int{7})
                                .producer_linger(17ms)
                                .producer_batch_record_limit(Int{23})
+                               .consume_batch_limit(Int{64})
                                .build();
   const auto producer =
       configured.view().as_bundle().at("producer").as_bundle();
@@ -1051,6 +1081,13 @@ void test_public_value_validation_and_producer_configuration() {
           "producer linger setting was not preserved");
   require(producer.at("batch_record_limit").checked_as<Int>() == Int{23},
           "producer batch record setting was not preserved");
+  require(configured.view()
+                  .as_bundle()
+                  .at("consumer_defaults")
+                  .as_bundle()
+                  .at("consume_batch_limit")
+                  .checked_as<Int>() == Int{64},
+          "consumer batch limit setting was not preserved");
 
   production_config =
       hgraph::kafka::service_config()
@@ -2523,6 +2560,7 @@ int main() {
   try {
     hgraph::stdlib::register_standard_operators();
     test_bridge_wake_handles_graph_teardown();
+    test_bridge_batch_admission_stops_at_first_rejection();
     const auto release_state = hgraph::make_scope_exit(release_test_state);
     initialize_values();
     test_public_value_validation_and_producer_configuration();
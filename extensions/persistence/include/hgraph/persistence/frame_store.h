@@ -4,10 +4,14 @@
 #include <hgraph/persistence/export.h>
 #include <hgraph/persistence/store_location.h>
 #include <hgraph/types/frame.h>
+#include <hgraph/util/date_time.h>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 /**
  * Object-store frame persistence (RFC 0016).
@@ -41,6 +45,18 @@ namespace hgraph::persistence::store
         Zstd,
     };
 
+    /**
+     * Read-ahead for replaying a segmented recording. While the graph consumes
+     * segment N, a worker reads and decodes up to ``segments`` segments past
+     * it, starting another only while the decoded segments it holds stay
+     * under ``max_bytes``. Zero ``segments`` reads each segment on demand.
+     */
+    struct ReplayPrefetch
+    {
+        std::size_t segments{1};
+        std::size_t max_bytes{std::size_t{256} * 1024 * 1024};
+    };
+
     struct FrameStoreConfig
     {
         Location    location{MemoryLocation{}};
@@ -48,6 +64,27 @@ namespace hgraph::persistence::store
         Compression compression{Compression::Default};
         /** Reject a write whose key already exists (RFC 0016 decision). */
         bool immutable{true};
+        ReplayPrefetch replay_prefetch{};
+    };
+
+    /**
+     * The part of a stored frame a reader will use: a replay over a wide
+     * frame names the few columns it reads and the run's ``[start, end)``.
+     *
+     * ``columns`` lists the returned columns in order; empty keeps them all.
+     * With a ``time_column`` (which must be a timestamp), native stores skip
+     * whole groups of rows that lie entirely outside the interval: Parquet
+     * row groups by their column statistics, Arrow IPC record batches by
+     * scanning the time column before the rest is kept. Pruning is by whole
+     * group, so rows outside the interval can still be returned and a reader
+     * filters by time as before.
+     */
+    struct FrameReadProjection
+    {
+        std::vector<std::string> columns{};
+        std::string              time_column{};
+        std::optional<DateTime>  start{};
+        std::optional<DateTime>  end{};
     };
 
     /**
@@ -102,9 +139,21 @@ namespace hgraph::persistence::store
                    std::optional<Compression> compression = {}) const;
         /** An empty ``Frame`` when the key is absent. */
         [[nodiscard]] Frame read(std::string_view key) const;
+        /** Read only what ``projection`` names. The filesystem stores push
+            the projection into the file reader; any other store reads the
+            whole frame and drops the unused columns. A missing column
+            throws. */
+        [[nodiscard]] Frame read(std::string_view key, const FrameReadProjection &projection) const;
         [[nodiscard]] bool  contains(std::string_view key) const;
         /** True only for native stores that implement immutable segment keys. */
         [[nodiscard]] bool supports_segmented_recordings() const noexcept;
+        /** True for the native stores, whose reads may run on a worker
+            thread. A Python or custom store keeps every read on the calling
+            thread. */
+        [[nodiscard]] bool reads_off_thread() const noexcept;
+        /** The configured read-ahead of a native store; none for any other
+            store, whose reads may not leave the calling thread. */
+        [[nodiscard]] ReplayPrefetch replay_prefetch() const noexcept;
         void               clear() const;
 
         /** True when this handle owns a concrete representation. */
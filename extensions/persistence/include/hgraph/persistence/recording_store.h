@@ -64,6 +64,9 @@ namespace hgraph::persistence
                                                Frame frame);
     [[nodiscard]] HGRAPH_PERSISTENCE_EXPORT Frame store_read(GlobalStateView state,
                                                              std::string_view key);
+    /** ``store_read`` through ``FrameStore::read``'s projection. */
+    [[nodiscard]] HGRAPH_PERSISTENCE_EXPORT Frame store_read(
+        GlobalStateView state, std::string_view key, const store::FrameReadProjection &projection);
     [[nodiscard]] HGRAPH_PERSISTENCE_EXPORT bool store_contains(GlobalStateView state,
                                                                 std::string_view key);
 
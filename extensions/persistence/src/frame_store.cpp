@@ -7,12 +7,16 @@
 #include <arrow/buffer.h>
 #include <arrow/filesystem/filesystem.h>
 #include <arrow/filesystem/localfs.h>
+#include <arrow/io/file.h>
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/reader.h>
 #include <arrow/ipc/writer.h>
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/table.h>
+#include <arrow/type.h>
 
 #if defined(HGRAPH_PERSISTENCE_WITH_S3)
 #include <arrow/filesystem/s3fs.h>
@@ -20,13 +24,21 @@
 
 #if defined(HGRAPH_PERSISTENCE_WITH_PARQUET)
 #include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
 #include <parquet/arrow/writer.h>
+#include <parquet/file_reader.h>
+#include <parquet/metadata.h>
 #include <parquet/properties.h>
+#include <parquet/schema.h>
+#include <parquet/statistics.h>
+#include <parquet/types.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <limits>
 #include <mutex>
 #include <stdexcept>
 #include <unordered_map>
@@ -54,6 +66,117 @@ namespace hgraph::persistence::store
 
         [[nodiscard]] const FrameStoreOps &memory_store_ops() noexcept;
         [[nodiscard]] const FrameStoreOps &filesystem_store_ops() noexcept;
+
+        [[nodiscard]] int projected_field(const arrow::Schema &schema, const std::string &name)
+        {
+            const int index = schema.GetFieldIndex(name);
+            if (index < 0)
+            {
+                throw std::invalid_argument("frame-store projection names a missing column: " + name);
+            }
+            return index;
+        }
+
+        /** The top-level fields a projected read must load, in schema order:
+            the projected columns (all, when none are named) and the time
+            column. */
+        [[nodiscard]] std::vector<int> projected_fields(const arrow::Schema      &schema,
+                                                        const FrameReadProjection &projection)
+        {
+            std::vector<int> indices;
+            if (projection.columns.empty())
+            {
+                for (int index = 0; index < schema.num_fields(); ++index) { indices.push_back(index); }
+            }
+            for (const auto &name : projection.columns) { indices.push_back(projected_field(schema, name)); }
+            if (!projection.time_column.empty())
+            {
+                const int time = projected_field(schema, projection.time_column);
+                if (schema.field(time)->type()->id() != arrow::Type::TIMESTAMP)
+                {
+                    throw std::invalid_argument("frame-store projection time column is not a timestamp: " +
+                                                projection.time_column);
+                }
+                indices.push_back(time);
+            }
+            std::ranges::sort(indices);
+            const auto repeated = std::ranges::unique(indices);
+            indices.erase(repeated.begin(), repeated.end());
+            return indices;
+        }
+
+        /** The projected columns of ``table`` in projection order, sharing
+            their data. */
+        [[nodiscard]] std::shared_ptr<arrow::Table> select_columns(std::shared_ptr<arrow::Table> table,
+                                                                   const FrameReadProjection   &projection)
+        {
+            if (table == nullptr || projection.columns.empty()) { return table; }
+            std::vector<int> indices;
+            indices.reserve(projection.columns.size());
+            for (const auto &name : projection.columns)
+            {
+                indices.push_back(projected_field(*table->schema(), name));
+            }
+            return unwrap(table->SelectColumns(indices), "select projected columns");
+        }
+
+        /** ``when`` in ``unit`` ticks since the epoch, rounded down or up
+            when ``unit`` is coarser than a microsecond, saturating when it
+            is finer. */
+        [[nodiscard]] std::int64_t ticks_in(DateTime when, arrow::TimeUnit::type unit, bool round_up)
+        {
+            const std::int64_t micros =
+                std::chrono::duration_cast<std::chrono::microseconds>(when.time_since_epoch()).count();
+            const auto divide = [&](std::int64_t divisor) {
+                const std::int64_t quotient  = micros / divisor;
+                const std::int64_t remainder = micros % divisor;
+                if (remainder > 0 && round_up) { return quotient + 1; }
+                if (remainder < 0 && !round_up) { return quotient - 1; }
+                return quotient;
+            };
+            switch (unit)
+            {
+            case arrow::TimeUnit::SECOND:
+                return divide(1'000'000);
+            case arrow::TimeUnit::MILLI:
+                return divide(1'000);
+            case arrow::TimeUnit::MICRO:
+                return micros;
+            case arrow::TimeUnit::NANO: {
+                constexpr std::int64_t limit = std::numeric_limits<std::int64_t>::max() / 1'000;
+                if (micros > limit) { return std::numeric_limits<std::int64_t>::max(); }
+                if (micros < -limit) { return std::numeric_limits<std::int64_t>::min(); }
+                return micros * 1'000;
+            }
+            }
+            return micros;
+        }
+
+        /** Whether rows timed ``[first, last]`` (in ``unit``) can meet the
+            projection's interval. */
+        [[nodiscard]] bool overlaps(std::int64_t first, std::int64_t last, arrow::TimeUnit::type unit,
+                                    const FrameReadProjection &projection)
+        {
+            return (!projection.start || last >= ticks_in(*projection.start, unit, false)) &&
+                   (!projection.end || first < ticks_in(*projection.end, unit, true));
+        }
+
+        [[nodiscard]] bool batch_overlaps(const arrow::Array &times, const FrameReadProjection &projection)
+        {
+            const auto  &timestamps = static_cast<const arrow::TimestampArray &>(times);
+            std::int64_t first      = std::numeric_limits<std::int64_t>::max();
+            std::int64_t last       = std::numeric_limits<std::int64_t>::min();
+            bool         any        = false;
+            for (std::int64_t row = 0; row < timestamps.length(); ++row)
+            {
+                if (timestamps.IsNull(row)) { continue; }
+                first = std::min(first, timestamps.Value(row));
+                last  = std::max(last, timestamps.Value(row));
+                any   = true;
+            }
+            const auto unit = static_cast<const arrow::TimestampType &>(*times.type()).unit();
+            return !any || overlaps(first, last, unit, projection);
+        }
     }  // namespace
 
     bool parquet_available() noexcept
@@ -152,6 +275,8 @@ namespace hgraph::persistence::store
           public:
             explicit MemoryStore(FrameStoreConfig config) : config_(std::move(config)) {}
 
+            [[nodiscard]] const FrameStoreConfig &config() const noexcept { return config_; }
+
             void write(std::string_view key, Frame frame, std::optional<Compression>)
             {
                 require_valid_key(key);
@@ -219,10 +344,15 @@ namespace hgraph::persistence::store
                             bool atomic_local_publication = false)
                 : config_(std::move(config)), fs_(std::move(fs)), root_(std::move(root)),
                   object_store_(std::move(object_store)),
-                  atomic_local_publication_(atomic_local_publication)
+                  atomic_local_publication_(atomic_local_publication),
+                  // Only the local filesystem publishes atomically, and only it can map.
+                  memory_map_reads_(atomic_local_publication && memory_map_supported() &&
+                                    config_.format == Format::ArrowIpc)
             {
             }
 
+            [[nodiscard]] const FrameStoreConfig &config() const noexcept { return config_; }
+
             void write(std::string_view key, Frame frame, std::optional<Compression> compression)
             {
                 require_valid_key(key);
@@ -285,8 +415,18 @@ namespace hgraph::persistence::store
                 {
                     return Frame{};
                 }
-                auto in = unwrap(fs_->OpenInputFile(path), "open input file");
-                return Frame{read_table(in)};
+                return Frame{read_table(open_input(path))};
+            }
+
+            [[nodiscard]] Frame read(std::string_view key, const FrameReadProjection &projection)
+            {
+                require_valid_key(key);
+                const auto path = resolve(key);
+                if (!exists(path))
+                {
+                    return Frame{};
+                }
+                return Frame{select_columns(read_table(open_input(path), &projection), projection)};
             }
 
             [[nodiscard]] bool contains(std::string_view key)
@@ -298,6 +438,33 @@ namespace hgraph::persistence::store
             void clear() { object_store_.clear(); }
 
           private:
+            /** Whether a published file may stay mapped while the store replaces or
+                removes it: POSIX unlinks beneath a live mapping, Windows refuses. */
+            [[nodiscard]] static constexpr bool memory_map_supported() noexcept
+            {
+#if defined(_WIN32)
+                return false;
+#else
+                return true;
+#endif
+            }
+
+            /** Local IPC reads map the file, so an uncompressed table's buffers are
+                slices of the page cache rather than copies in the memory pool. The
+                mapping lives as long as the last buffer referencing it; publication
+                only ever renames a new file over the key, so a mapped file is never
+                written in place. */
+            [[nodiscard]] std::shared_ptr<arrow::io::RandomAccessFile> open_input(
+                const std::string &path) const
+            {
+                if (memory_map_reads_)
+                {
+                    return unwrap(arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ),
+                                  "map input file");
+                }
+                return unwrap(fs_->OpenInputFile(path), "open input file");
+            }
+
             [[nodiscard]] static std::string temporary_sibling(const std::string &path)
             {
                 static std::atomic<std::uint64_t> sequence{0};
@@ -362,14 +529,21 @@ namespace hgraph::persistence::store
                 }
             }
 
+            /** The whole table, or with a ``projection`` only its fields and
+                the record batches or row groups that can meet its interval. */
             [[nodiscard]] std::shared_ptr<arrow::Table> read_table(
-                const std::shared_ptr<arrow::io::RandomAccessFile> &in) const
+                const std::shared_ptr<arrow::io::RandomAccessFile> &in,
+                const FrameReadProjection                          *projection = nullptr) const
             {
                 switch (config_.format)
                 {
                 case Format::ArrowIpc: {
                     auto reader =
                         unwrap(arrow::ipc::RecordBatchFileReader::Open(in), "open IPC reader");
+                    if (projection != nullptr)
+                    {
+                        return read_ipc_projected(in, *reader->schema(), *projection);
+                    }
                     return unwrap(reader->ToTable(), "read IPC table");
                 }
                 case Format::Parquet:
@@ -377,6 +551,10 @@ namespace hgraph::persistence::store
                 {
                     auto reader = unwrap(parquet::arrow::OpenFile(in, arrow::default_memory_pool()),
                                          "open Parquet reader");
+                    if (projection != nullptr)
+                    {
+                        return read_parquet_projected(*reader, *projection);
+                    }
                     return unwrap(reader->ReadTable(), "read Parquet table");
                 }
 #else
@@ -387,6 +565,114 @@ namespace hgraph::persistence::store
                 return nullptr;
             }
 
+            /** Reopen with only the projected fields, so the others are never
+                decoded (or, mapped, never touched), and keep the record
+                batches whose time column can meet the interval. */
+            [[nodiscard]] static std::shared_ptr<arrow::Table> read_ipc_projected(
+                const std::shared_ptr<arrow::io::RandomAccessFile> &in, const arrow::Schema &full,
+                const FrameReadProjection &projection)
+            {
+                auto options            = arrow::ipc::IpcReadOptions::Defaults();
+                options.included_fields = projected_fields(full, projection);
+                auto reader = unwrap(arrow::ipc::RecordBatchFileReader::Open(in, options),
+                                     "open projected IPC reader");
+
+                arrow::FieldVector fields;
+                for (const int index : options.included_fields) { fields.push_back(full.field(index)); }
+                const auto schema = arrow::schema(std::move(fields), full.metadata());
+                const int  time   = projection.time_column.empty()
+                                        ? -1
+                                        : schema->GetFieldIndex(projection.time_column);
+
+                std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+                for (int index = 0; index < reader->num_record_batches(); ++index)
+                {
+                    auto batch = unwrap(reader->ReadRecordBatch(index), "read IPC record batch");
+                    if (time >= 0 && !batch_overlaps(*batch->column(time), projection)) { continue; }
+                    batches.push_back(std::move(batch));
+                }
+                return unwrap(arrow::Table::FromRecordBatches(schema, std::move(batches)),
+                              "assemble projected IPC table");
+            }
+
+#if defined(HGRAPH_PERSISTENCE_WITH_PARQUET)
+            static void collect_leaves(const parquet::arrow::SchemaField &field, std::vector<int> &leaves)
+            {
+                if (field.is_leaf())
+                {
+                    leaves.push_back(field.column_index);
+                    return;
+                }
+                for (const auto &child : field.children) { collect_leaves(child, leaves); }
+            }
+
+            /** Row-group statistics are in the Parquet column's own unit;
+                a group without usable min/max statistics is always kept. */
+            [[nodiscard]] static bool row_group_overlaps(const parquet::FileMetaData &metadata, int row_group,
+                                                         int leaf, const FrameReadProjection &projection)
+            {
+                const auto statistics = metadata.RowGroup(row_group)->ColumnChunk(leaf)->statistics();
+                if (statistics == nullptr || !statistics->HasMinMax() ||
+                    statistics->physical_type() != parquet::Type::INT64)
+                {
+                    return true;
+                }
+                const auto logical = metadata.schema()->Column(leaf)->logical_type();
+                if (logical == nullptr || !logical->is_timestamp()) { return true; }
+                arrow::TimeUnit::type unit;
+                switch (static_cast<const parquet::TimestampLogicalType &>(*logical).time_unit())
+                {
+                case parquet::LogicalType::TimeUnit::MILLIS:
+                    unit = arrow::TimeUnit::MILLI;
+                    break;
+                case parquet::LogicalType::TimeUnit::MICROS:
+                    unit = arrow::TimeUnit::MICRO;
+                    break;
+                case parquet::LogicalType::TimeUnit::NANOS:
+                    unit = arrow::TimeUnit::NANO;
+                    break;
+                default:
+                    return true;
+                }
+                const auto &typed = static_cast<const parquet::Int64Statistics &>(*statistics);
+                return overlaps(typed.min(), typed.max(), unit, projection);
+            }
+
+            /** Read only the projected columns' leaves, from only the row
+                groups whose time statistics can meet the interval. */
+            [[nodiscard]] static std::shared_ptr<arrow::Table> read_parquet_projected(
+                parquet::arrow::FileReader &reader, const FrameReadProjection &projection)
+            {
+                const auto        &manifest = reader.manifest();
+                arrow::FieldVector top;
+                for (const auto &field : manifest.schema_fields) { top.push_back(field.field); }
+                const arrow::Schema schema{std::move(top)};
+
+                std::vector<int> leaves;
+                for (const int index : projected_fields(schema, projection))
+                {
+                    collect_leaves(manifest.schema_fields[static_cast<std::size_t>(index)], leaves);
+                }
+
+                const auto       metadata = reader.parquet_reader()->metadata();
+                std::vector<int> row_groups;
+                const int        time_leaf =
+                    projection.time_column.empty()
+                               ? -1
+                               : manifest.schema_fields[static_cast<std::size_t>(
+                                                            schema.GetFieldIndex(projection.time_column))]
+                                     .column_index;
+                for (int row_group = 0; row_group < metadata->num_row_groups(); ++row_group)
+                {
+                    if (time_leaf < 0 || row_group_overlaps(*metadata, row_group, time_leaf, projection))
+                    {
+                        row_groups.push_back(row_group);
+                    }
+                }
+                return unwrap(reader.ReadRowGroups(row_groups, leaves), "read Parquet row groups");
+            }
+#endif
+
             [[nodiscard]] static std::shared_ptr<arrow::util::Codec> ipc_codec(
                 Compression compression)
             {
@@ -426,6 +712,7 @@ namespace hgraph::persistence::store
             std::string                            root_;
             ObjectStore                            object_store_{};
             bool                                   atomic_local_publication_{false};
+            bool                                   memory_map_reads_{false};
         };
 
         [[nodiscard]] const FrameStoreOps &filesystem_store_ops() noexcept
@@ -449,6 +736,40 @@ namespace hgraph::persistence::store
 
     }  // namespace
 
+    Frame FrameStore::read(std::string_view key, const FrameReadProjection &projection) const
+    {
+        if (ops_ == &filesystem_store_ops())
+        {
+            return static_cast<FileSystemStore *>(context_.get())->read(key, projection);
+        }
+        const Frame frame = ops_->read(context_.get(), key);
+        return Frame{select_columns(frame.table, projection)};
+    }
+
+    bool FrameStore::reads_off_thread() const noexcept
+    {
+        // Only the native stores are known to tolerate a read from another
+        // thread; a Python or custom store keeps every read on the run thread.
+        return context_ != nullptr && (ops_ == &memory_store_ops() || ops_ == &filesystem_store_ops());
+    }
+
+    ReplayPrefetch FrameStore::replay_prefetch() const noexcept
+    {
+        if (!reads_off_thread())
+        {
+            return ReplayPrefetch{.segments = 0};
+        }
+        if (ops_ == &memory_store_ops())
+        {
+            return static_cast<const MemoryStore *>(context_.get())->config().replay_prefetch;
+        }
+        if (ops_ == &filesystem_store_ops())
+        {
+            return static_cast<const FileSystemStore *>(context_.get())->config().replay_prefetch;
+        }
+        return ReplayPrefetch{.segments = 0};
+    }
+
     FrameStore make_frame_store(FrameStoreConfig config)
     {
         if (config.format == Format::Parquet && !parquet_available())
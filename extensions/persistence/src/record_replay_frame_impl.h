@@ -6,6 +6,8 @@
 #include <hgraph/persistence/recording_options.h>
 #include <hgraph/persistence/recording_store.h>
 
+#include "segment_prefetcher.h"
+
 #include <arrow/array.h>
 #include <arrow/table.h>
 #include <hgraph/lib/std/operators/io.h>
@@ -22,6 +24,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -224,7 +227,17 @@ namespace hgraph::persistence
             std::size_t              next_segment{0};
             DateTime                 as_of{MAX_DT};
             DateTime                 start_time{MIN_ST};
+            DateTime                 end_time{MAX_ET};
             bool                     segmented{false};
+            /** How segments after the first are read: the stored columns the
+                first resolved to, over the run's ``[start_time, end_time]``.
+                Segments of one recording share its schema, and rows outside
+                the run are discarded by row selection anyway. Empty until the
+                first segment is installed. */
+            store::FrameReadProjection segment_projection{};
+            /** Set for a segmented replay from a store that allows read-ahead.
+                Declared last: its worker decodes against the fields above. */
+            std::unique_ptr<SegmentPrefetcher> prefetcher{};
         };
 
         struct RecordedFrameRows
@@ -296,25 +309,92 @@ namespace hgraph::persistence
         }
 
         /** Resolve the caller's projection against this segment and select the
-            rows it replays. Resolution is stored on the handle rather than
-            applied to the table: row selection is a Take, which preserves
-            column order, so the indices stay valid for the selected frame. */
-        [[nodiscard]] inline Frame prepare_replay_segment(ReplayHandle &handle, Frame frame)
-        {
-            handle.source_columns = table_ts_detail::resolve_replay_columns(
+            rows it replays. Resolution is kept beside the table rather than
+            applied to it: row selection is a Take, which preserves column
+            order, so the indices stay valid for the selected frame. Reads only
+            start-time fields of ``handle``, so a prefetch worker may run it. */
+        [[nodiscard]] inline ReplaySegment prepare_replay_segment(const ReplayHandle &handle,
+                                                                  Frame               frame)
+        {
+            ReplaySegment segment;
+            segment.columns = table_ts_detail::resolve_replay_columns(
                 frame, *handle.recording_layout, handle.source_names, handle.as_of_named,
                 handle.removes_named);
-            return data_frame_detail::select_replay_frame(frame, *handle.recording_layout,
-                                                          handle.source_columns, handle.as_of,
-                                                          handle.start_time);
+            segment.frame = data_frame_detail::select_replay_frame(
+                frame, *handle.recording_layout, segment.columns, handle.as_of, handle.start_time);
+            return segment;
+        }
+
+        inline void install_replay_segment(ReplayHandle &handle, ReplaySegment segment)
+        {
+            handle.frame = std::move(segment.frame);
+            handle.source_columns = std::move(segment.columns);
+            handle.row = 0;
+        }
+
+        /** Derive ``segment_projection`` from the installed segment. The
+            date column prunes by time only when it is a timestamp: a
+            hand-built recording may carry some other date encoding. */
+        inline void remember_segment_projection(ReplayHandle &handle)
+        {
+            const auto &schema = *handle.frame.table->schema();
+            auto       &projection = handle.segment_projection;
+            for (const int column : handle.source_columns)
+            {
+                if (column >= 0)
+                {
+                    projection.columns.push_back(schema.field(column)->name());
+                }
+            }
+            const auto &date = schema.field(handle.source_columns.front());
+            if (date->type()->id() == arrow::Type::TIMESTAMP)
+            {
+                projection.time_column = date->name();
+                projection.start = handle.start_time;
+                if (handle.end_time < MAX_ET)
+                {
+                    projection.end = handle.end_time + MIN_TD;
+                }
+            }
+        }
+
+        /** Start reading ahead of ``handle.next_segment`` when the selected
+            store allows it; otherwise segments are read on demand. Call it once
+            the first segment is installed, so every read it makes goes
+            through ``segment_projection``. */
+        inline void start_segment_prefetch(ReplayHandle &handle, GlobalStateView gs)
+        {
+            auto       selected = frame_store(gs);
+            const auto limits = selected.replay_prefetch();
+            if (limits.segments == 0)
+            {
+                return;
+            }
+            const ReplayHandle *owner = &handle;
+            handle.prefetcher = std::make_unique<SegmentPrefetcher>(
+                std::move(selected), handle.fq_key, handle.next_segment, limits,
+                handle.segment_projection,
+                [owner](Frame frame) { return prepare_replay_segment(*owner, std::move(frame)); });
         }
 
         [[nodiscard]] inline bool load_next_replay_segment(ReplayHandle &handle, GlobalStateView gs)
         {
             while (true)
             {
-                Frame next = store_read(
-                    gs, segment_key(handle.fq_key, handle.next_segment));
+                std::optional<ReplaySegment> next;
+                if (handle.prefetcher != nullptr)
+                {
+                    next = handle.prefetcher->next();
+                }
+                else if (Frame stored =
+                             handle.segment_projection.columns.empty()
+                                 ? store_read(gs, segment_key(handle.fq_key, handle.next_segment))
+                                 : store_read(gs, segment_key(handle.fq_key, handle.next_segment),
+                                              handle.segment_projection);
+                         stored.has_value())
+                {
+                    next = prepare_replay_segment(handle, std::move(stored));
+                }
                 if (!next.has_value())
                 {
                     handle.frame = Frame{};
@@ -322,8 +402,11 @@ namespace hgraph::persistence
                     return false;
                 }
                 ++handle.next_segment;
-                handle.frame = prepare_replay_segment(handle, std::move(next));
-                handle.row = 0;
+                install_replay_segment(handle, std::move(*next));
+                if (handle.segment_projection.columns.empty())
+                {
+                    remember_segment_projection(handle);
+                }
                 if (frame_rows(handle.frame) != 0)
                 {
                     return true;
@@ -584,7 +667,7 @@ namespace hgraph::persistence
             Scalar<"removed_names", ScalarVar<"RN", HomogeneousTuple<Str>>>   removed_names,
             Scalar<"date_key", Str> date_key, Scalar<"as_of_key", Str> as_of_key,
             Scalar<"frame_prefix", Str> frame_prefix, Scalar<"model", Str>, TraitsView traits,
-            GlobalStateView gs,
+            GlobalStateView gs, EngineControlView engine,
             DateTime now, State<FrameReplayState> state, SingleShotScheduler sched,
             Out<TsVar<"O">> out)
         {
@@ -625,20 +708,26 @@ namespace hgraph::persistence
             handle->fq_key = fq_key;
             handle->as_of = config.as_of.value_or(MAX_DT);
             handle->start_time = now;
+            handle->end_time = engine.end_time();
             handle->segmented = segmented;
             if (segmented)
             {
                 // The marker claims the logical key. Segments are complete,
                 // standalone frames and an absent next key is the natural end
-                // of an interrupted or still-running recording.
+                // of an interrupted or still-running recording. The first
+                // segment is read whole: its resolution names the columns
+                // every later read projects to.
                 handle->next_segment = 0;
-                static_cast<void>(
-                    record_replay_frame_detail::load_next_replay_segment(*handle, gs));
+                if (record_replay_frame_detail::load_next_replay_segment(*handle, gs))
+                {
+                    record_replay_frame_detail::start_segment_prefetch(*handle, gs);
+                }
             }
             else
             {
-                handle->frame =
-                    record_replay_frame_detail::prepare_replay_segment(*handle, std::move(stored));
+                record_replay_frame_detail::install_replay_segment(
+                    *handle,
+                    record_replay_frame_detail::prepare_replay_segment(*handle, std::move(stored)));
             }
             if (frame_rows(handle->frame) > 0)
             {
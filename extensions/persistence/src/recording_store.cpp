@@ -138,6 +138,16 @@ namespace hgraph::persistence
         return {};
     }
 
+    Frame store_read(GlobalStateView state, std::string_view key,
+                     const store::FrameReadProjection &projection)
+    {
+        if (auto selected = frame_store(state))
+        {
+            return selected.read(key, projection);
+        }
+        return {};
+    }
+
     bool store_contains(GlobalStateView state, std::string_view key)
     {
         if (auto selected = frame_store(state))
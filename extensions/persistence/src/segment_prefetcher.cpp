@@ -0,0 +1,129 @@
+#include "segment_prefetcher.h"
+
+#include <hgraph/persistence/recording_store.h>
+
+#include <arrow/table.h>
+#include <arrow/util/byte_size.h>
+
+#include <utility>
+
+namespace hgraph::persistence
+{
+    SegmentPrefetcher::SegmentPrefetcher(store::FrameStore store, std::string key,
+                                         std::size_t first_segment, store::ReplayPrefetch limits,
+                                         store::FrameReadProjection projection, Decode decode)
+        : store_(std::move(store)), key_(std::move(key)), limits_(limits),
+          projection_(std::move(projection)), decode_(std::move(decode)),
+          next_read_(first_segment)
+    {
+        worker_ = std::thread{[this] { worker_loop(); }};
+    }
+
+    SegmentPrefetcher::~SegmentPrefetcher()
+    {
+        {
+            std::scoped_lock lock{mutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        if (worker_.joinable())
+        {
+            worker_.join();
+        }
+    }
+
+    std::optional<ReplaySegment> SegmentPrefetcher::next()
+    {
+        std::unique_lock lock{mutex_};
+        ready_changed_.wait(lock, [this] { return !ready_.empty() || exhausted_; });
+        if (!ready_.empty())
+        {
+            Ready ready = std::move(ready_.front());
+            ready_.pop_front();
+            held_bytes_ -= ready.bytes;
+            lock.unlock();
+            wake_.notify_one();
+            return std::move(ready.segment);
+        }
+        if (error_)
+        {
+            std::rethrow_exception(error_);
+        }
+
+        // The worker is parked at the first absent key and touches nothing
+        // until it is resumed, so this probe owns ``next_read_``.
+        const std::size_t segment = next_read_;
+        lock.unlock();
+        Frame frame = store_.read(segment_key(key_, segment), projection_);
+        if (!frame.has_value())
+        {
+            return std::nullopt;
+        }
+        ReplaySegment decoded = decode_(std::move(frame));
+        lock.lock();
+        next_read_ = segment + 1;
+        exhausted_ = false;
+        lock.unlock();
+        wake_.notify_one();
+        return decoded;
+    }
+
+    bool SegmentPrefetcher::may_read() const noexcept
+    {
+        // At least one segment is always admitted: a segment larger than the
+        // budget must still replay, it just is not read further ahead of.
+        return !exhausted_ && ready_.size() < limits_.segments &&
+               (ready_.empty() || held_bytes_ < limits_.max_bytes);
+    }
+
+    void SegmentPrefetcher::worker_loop()
+    {
+        std::unique_lock lock{mutex_};
+        for (;;)
+        {
+            wake_.wait(lock, [this] { return stopping_ || may_read(); });
+            if (stopping_)
+            {
+                return;
+            }
+            const std::size_t segment = next_read_;
+            lock.unlock();
+
+            std::optional<Ready> ready;
+            std::exception_ptr   error;
+            try
+            {
+                Frame frame = store_.read(segment_key(key_, segment), projection_);
+                if (frame.has_value())
+                {
+                    ReplaySegment decoded = decode_(std::move(frame));
+                    std::size_t   bytes   = 0;
+                    if (decoded.frame.has_value())
+                    {
+                        bytes = static_cast<std::size_t>(
+                            arrow::util::TotalBufferSize(*decoded.frame.table));
+                    }
+                    ready.emplace(Ready{std::move(decoded), bytes});
+                }
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (ready.has_value())
+            {
+                held_bytes_ += ready->bytes;
+                ready_.push_back(std::move(*ready));
+                next_read_ = segment + 1;
+            }
+            else
+            {
+                exhausted_ = true;
+                error_     = std::move(error);
+            }
+            ready_changed_.notify_one();
+        }
+    }
+}  // namespace hgraph::persistence
@@ -0,0 +1,97 @@
+#ifndef HGRAPH_PERSISTENCE_SEGMENT_PREFETCHER_H
+#define HGRAPH_PERSISTENCE_SEGMENT_PREFETCHER_H
+
+#include <hgraph/persistence/frame_store.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hgraph::persistence
+{
+    /** One replay segment after projection resolution and row selection. */
+    struct ReplaySegment
+    {
+        Frame frame{};
+        /** Stored column per layout column, ``-1`` where the recording does
+            not carry one (see ``resolve_replay_columns``). */
+        std::vector<int> columns{};
+    };
+
+    /**
+     * Reads and decodes the segments of one segmented recording ahead of the
+     * replay consuming them (RFC 0019 segment keys), so a segment boundary
+     * costs a hand-off instead of a store read plus row selection.
+     *
+     * One worker walks ``<key>.<n>`` from ``first_segment`` within the
+     * store's ``ReplayPrefetch`` limits and parks at the first absent key.
+     * ``next`` hands segments out in key order. At the parked key it probes
+     * once more on the calling thread, exactly as on-demand replay would, so
+     * a segment published since the worker looked is still replayed.
+     *
+     * Every segment is read through ``projection``, so a store that pushes
+     * it down skips the columns and record batches replay would discard.
+     *
+     * The mutex is taken at segment boundaries only, never per tick. The
+     * store must be one whose ``replay_prefetch`` allows prefetching, and
+     * ``decode`` must be safe to run off the run thread.
+     */
+    class SegmentPrefetcher
+    {
+      public:
+        using Decode = std::function<ReplaySegment(Frame)>;
+
+        SegmentPrefetcher(store::FrameStore store, std::string key, std::size_t first_segment,
+                          store::ReplayPrefetch limits, store::FrameReadProjection projection,
+                          Decode decode);
+        /** Stops the worker, waiting for a read or decode in flight. */
+        ~SegmentPrefetcher();
+
+        SegmentPrefetcher(const SegmentPrefetcher &)            = delete;
+        SegmentPrefetcher &operator=(const SegmentPrefetcher &) = delete;
+        SegmentPrefetcher(SegmentPrefetcher &&)                 = delete;
+        SegmentPrefetcher &operator=(SegmentPrefetcher &&)      = delete;
+
+        /** The next segment, or nullopt once its key is absent. A failed read
+            or decode is rethrown here, after every segment before it. */
+        [[nodiscard]] std::optional<ReplaySegment> next();
+
+      private:
+        struct Ready
+        {
+            ReplaySegment segment;
+            std::size_t   bytes{0};
+        };
+
+        void worker_loop();
+        /** Whether the worker may start another segment; requires ``mutex_``. */
+        [[nodiscard]] bool may_read() const noexcept;
+
+        store::FrameStore          store_;
+        std::string                key_;
+        store::ReplayPrefetch      limits_;
+        store::FrameReadProjection projection_;
+        Decode                     decode_;
+
+        std::mutex              mutex_{};
+        std::condition_variable wake_{};
+        std::condition_variable ready_changed_{};
+        std::deque<Ready>       ready_{};
+        std::size_t             held_bytes_{0};
+        std::size_t             next_read_{0};
+        bool                    exhausted_{false};
+        bool                    stopping_{false};
+        std::exception_ptr      error_{};
+
+        std::thread worker_{};
+    };
+}  // namespace hgraph::persistence
+
+#endif  // HGRAPH_PERSISTENCE_SEGMENT_PREFETCHER_H
@@ -65,10 +65,12 @@ namespace test_detail
 
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 using namespace hgraph;
 using namespace hgraph::persistence::store;
@@ -92,6 +94,33 @@ namespace
         return Frame{arrow::Table::Make(schema, {array})};
     }
 
+    /** A timed frame wider than a replay needs: time, a, b, c. */
+    [[nodiscard]] Frame make_wide_frame()
+    {
+        arrow::TimestampBuilder time_builder{arrow::timestamp(arrow::TimeUnit::MICRO, "UTC"),
+                                             arrow::default_memory_pool()};
+        REQUIRE(time_builder.AppendValues(std::vector<std::int64_t>{1'000'000, 2'000'000, 3'000'000}).ok());
+        std::shared_ptr<arrow::Array> times;
+        REQUIRE(time_builder.Finish(&times).ok());
+        arrow::FieldVector                         fields{arrow::field("time", times->type())};
+        std::vector<std::shared_ptr<arrow::Array>> columns{times};
+        for (const char *name : {"a", "b", "c"})
+        {
+            arrow::Int64Builder builder;
+            REQUIRE(builder.AppendValues(std::vector<std::int64_t>{1, 2, 3}).ok());
+            std::shared_ptr<arrow::Array> array;
+            REQUIRE(builder.Finish(&array).ok());
+            fields.push_back(arrow::field(name, arrow::int64()));
+            columns.push_back(std::move(array));
+        }
+        return Frame{arrow::Table::Make(arrow::schema(std::move(fields)), std::move(columns))};
+    }
+
+    [[nodiscard]] DateTime at_seconds(std::int64_t seconds)
+    {
+        return DateTime{std::chrono::seconds{seconds}};
+    }
+
     [[nodiscard]] Value make_metadata()
     {
         BundleBuilder details{ValuePlanFactory::instance().type_for(
@@ -330,6 +359,23 @@ TEST_CASE("frame store: a local store persists frames as files")
     }
 }
 
+TEST_CASE("frame store: a local IPC frame outlives its file and its store")
+{
+    TempDir dir{"mapped"};
+    Frame   frame;
+    {
+        auto store = make_frame_store(local_config(dir, Format::ArrowIpc));
+        store.write("run/prices", make_frame(5));
+        frame = store.read("run/prices");
+        // Local IPC reads are memory-mapped; removing the published file must
+        // not invalidate a table still backed by it.
+        store.clear();
+        CHECK_FALSE(store.contains("run/prices"));
+    }
+    REQUIRE(frame.has_value());
+    CHECK(frame.table->Equals(*make_frame(5).table));
+}
+
 TEST_CASE("frame store: a relative local root is resolved once")
 {
     TempDir workspace{"relative_root"};
@@ -373,6 +419,48 @@ TEST_CASE("frame store: both formats round-trip a frame")
     }
 }
 
+TEST_CASE("frame store: a projected read loads only the named columns and overlapping groups")
+{
+    TempDir dir{"projection"};
+
+    std::vector<FrameStore> stores{make_frame_store(FrameStoreConfig{}),
+                                   make_frame_store(local_config(dir, Format::ArrowIpc))};
+    if (parquet_available())
+    {
+        stores.push_back(make_frame_store(local_config(dir, Format::Parquet)));
+        stores.back().write("wide.parquet", make_wide_frame());
+    }
+    for (std::size_t index = 0; index < 2; ++index) { stores[index].write("wide", make_wide_frame()); }
+
+    for (std::size_t index = 0; index < stores.size(); ++index)
+    {
+        const std::string key = index == 2 ? "wide.parquet" : "wide";
+        const Frame       projected =
+            stores[index].read(key, FrameReadProjection{.columns     = {"c", "time"},
+                                                        .time_column = "time",
+                                                        .start       = at_seconds(2),
+                                                        .end         = at_seconds(4)});
+        REQUIRE(projected.has_value());
+        REQUIRE(projected.table->num_columns() == 2);
+        CHECK(projected.table->field(0)->name() == "c");
+        CHECK(projected.table->field(1)->name() == "time");
+        // Pruning is by whole group: the group reaching into [2s, 4s) stays.
+        CHECK(projected.table->num_rows() == 3);
+
+        CHECK_THROWS(stores[index].read(key, FrameReadProjection{.columns = {"missing"}}));
+        CHECK_FALSE(stores[index].read("absent", FrameReadProjection{.columns = {"a"}}).has_value());
+        if (index == 0) { continue; }
+
+        // Every row lies after the interval, so the file's only group is skipped.
+        const Frame pruned = stores[index].read(
+            key, FrameReadProjection{.columns = {"a"}, .time_column = "time", .end = at_seconds(1)});
+        REQUIRE(pruned.has_value());
+        CHECK(pruned.table->num_columns() == 1);
+        CHECK(pruned.table->num_rows() == 0);
+        CHECK_THROWS(stores[index].read(key, FrameReadProjection{.time_column = "a"}));
+    }
+}
+
 TEST_CASE("frame store: RFC 0001 frame metadata survives persistence")
 {
     // The property the RFC leans on: a stored frame answers "what produced
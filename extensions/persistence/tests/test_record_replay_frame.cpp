@@ -53,6 +53,7 @@ namespace test_detail
 
 #include <algorithm>
 #include <cstdint>
+#include <filesystem>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -361,6 +362,22 @@ using namespace hgraph::persistence::store;
         }
         return recorder.finish();
     }
+
+    /** ``frame`` with a trailing column that replay does not read. */
+    [[nodiscard]] Frame with_unreplayed_column(Frame frame)
+    {
+        arrow::Int64Builder noise;
+        for (std::int64_t row = 0; row < frame_rows(frame); ++row)
+        {
+            require_arrow(noise.Append(row));
+        }
+        auto widened = frame.table->AddColumn(frame.table->num_columns(),
+                                              arrow::field("noise", arrow::int64()),
+                                              std::make_shared<arrow::ChunkedArray>(finish(noise)));
+        require_arrow(widened.status());
+        frame.table = *std::move(widened);
+        return frame;
+    }
 }  // namespace
 
 TEST_CASE("frame backend: record writes a bitemporal frame to the store; "
@@ -506,6 +523,67 @@ TEST_CASE("frame backend: one and many immutable segments replay identically")
     CHECK_OUTPUT((eval_node<SegmentEquivalenceReplayGraph<"many">>()), expected);
 }
 
+TEST_CASE("frame backend: segment read-ahead replays identically at every depth")
+{
+    stdlib::register_standard_operators();
+    const auto expected = values<Int>(10, 20, 30, 40, 50);
+    // On demand, one ahead, and two ahead under a budget that admits only
+    // one decoded segment at a time.
+    for (const persistence::store::ReplayPrefetch prefetch :
+         {persistence::store::ReplayPrefetch{.segments = 0},
+          persistence::store::ReplayPrefetch{.segments = 1},
+          persistence::store::ReplayPrefetch{.segments = 2, .max_bytes = 1}})
+    {
+        GlobalContext context;
+        const auto    state = context.state().view();
+        persistence::set_frame_store(
+            state, persistence::store::make_frame_store(
+                       persistence::store::FrameStoreConfig{.replay_prefetch = prefetch}));
+        record_replay::set_config(
+            state, record_replay::RecordReplayConfig{.backend = "hgraph.persistence.frame"});
+
+        (void)eval_node<SegmentedRecordGraph>(expected);
+        REQUIRE(test_detail::store_contains(state, "book.prices.2"));
+        CHECK_OUTPUT(eval_node<ReplayGraph>(), expected);
+    }
+}
+
+TEST_CASE("frame backend: segments replay through a local store's projected reads")
+{
+    stdlib::register_standard_operators();
+    const auto root =
+        std::filesystem::temp_directory_path() / "hgraph_replay_projected_segments";
+    // Later segments are read with only the columns the first resolved to,
+    // on demand and ahead of the replay alike.
+    for (const std::size_t depth : {std::size_t{0}, std::size_t{1}})
+    {
+        std::filesystem::remove_all(root);
+        GlobalContext context;
+        const auto    state = context.state().view();
+        persistence::set_frame_store(
+            state, persistence::store::make_frame_store(persistence::store::FrameStoreConfig{
+                       .location = persistence::store::LocalLocation{root.string()},
+                       .replay_prefetch = persistence::store::ReplayPrefetch{.segments = depth}}));
+        record_replay::set_config(
+            state, record_replay::RecordReplayConfig{.backend = "hgraph.persistence.frame"});
+
+        test_detail::store_write(state, "book.prices", persistence::segmented_recording_marker());
+        test_detail::store_write(
+            state, "book.prices.0",
+            with_unreplayed_column(
+                scalar_segment({{MIN_ST, Int{10}}, {MIN_ST + TimeDelta{1}, Int{20}}})));
+        test_detail::store_write(
+            state, "book.prices.1",
+            with_unreplayed_column(scalar_segment({{MIN_ST + TimeDelta{2}, Int{30}}})));
+        test_detail::store_write(
+            state, "book.prices.2",
+            with_unreplayed_column(scalar_segment({{MIN_ST + TimeDelta{3}, Int{40}}})));
+
+        CHECK_OUTPUT(eval_node<ReplayGraph>(), values<Int>(10, 20, 30, 40));
+    }
+    std::filesystem::remove_all(root);
+}
+
 TEST_CASE("frame backend: replay consumes completed segments without a "
           "completion manifest")
 {
@@ -35,7 +35,9 @@ namespace hgraph::stdlib
         @par Python example
         @code{.py}
         prices = hg.from_data_frame[TSD[str, TS[float]]](frame, dt_col="date", key_col="symbol")
-        @endcode */
+        @endcode
+        @note Replay keeps only the date, key and value columns and reads
+        each Arrow chunk in place; other columns are never decoded. */
     struct from_data_frame : Operator<"from_data_frame", Scalar<"df", Frame>, Scalar<"dt_col", Str>,
                                       Scalar<"key_col", Str>, Scalar<"value_col", Str>,
                                       Scalar<"offset", TimeDelta>, Out<TsVar<"O">>>
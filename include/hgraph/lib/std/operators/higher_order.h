@@ -113,6 +113,8 @@ namespace hgraph::stdlib
         std::optional<WiredFn>  default_branch{};
         /** Rebuild the active branch on EVERY key tick, not just a key change (Python ``reload_on_ticked``). */
         bool reload_on_ticked{false};
+        /** Stopped branch graphs kept for restart (``SwitchNodeSpec::warm_branches``). */
+        std::size_t warm_branches{0};
 
         [[nodiscard]] SwitchCases &&reload(bool value = true) &&
         {
@@ -120,10 +122,16 @@ namespace hgraph::stdlib
             return std::move(*this);
         }
 
+        [[nodiscard]] SwitchCases &&warm(std::size_t count) &&
+        {
+            warm_branches = count;
+            return std::move(*this);
+        }
+
         [[nodiscard]] bool operator==(const SwitchCases &other) const
         {
             return cases == other.cases && default_branch == other.default_branch &&
-                   reload_on_ticked == other.reload_on_ticked;
+                   reload_on_ticked == other.reload_on_ticked && warm_branches == other.warm_branches;
         }
     };
 
@@ -156,6 +164,8 @@ namespace hgraph::stdlib
      * @param ts Positional inputs forwarded to the selected branch.
      * @param kwargs Named inputs forwarded to the selected branch.
      * @param reload_on_ticked Rebuild the branch on every key tick even when its value is unchanged.
+     * @param warm_branches Keep this many stopped branches constructed and restart them on return
+     *        instead of rebuilding; they keep their node state (``SwitchCases::warm``).
      * @return The active child graph's output, repointed when the branch changes.
      * @par Python example
      * @code{.py}
@@ -527,6 +537,7 @@ struct std::hash<hgraph::stdlib::SwitchCases>
         }
         if (cases.default_branch.has_value()) { combine(std::hash<hgraph::WiredFn>{}(*cases.default_branch)); }
         combine(cases.reload_on_ticked ? 1 : 0);
+        combine(cases.warm_branches);
         return h;
     }
 };
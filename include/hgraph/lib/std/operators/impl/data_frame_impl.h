@@ -44,18 +44,25 @@ namespace hgraph::stdlib
                                                 std::int64_t row,
                                                 const TSOutputView &out);
 
-        /** from_data_frame reading plan (heap handle via node State). */
+        /** from_data_frame reading plan (heap handle via node State).
+            ``frame`` keeps only the replayed columns, and each is read
+            through a cursor over its Arrow chunks resolved at load, so a
+            replayed row touches neither the unused columns nor a
+            concatenated copy of the used ones. */
         struct FromFramePlan
         {
-            Frame                     frame{};
-            std::string               dt_col{};
-            TimeDelta                 offset{};
-            std::int64_t              row{0};
-            FromFrameRowApplication   apply_row{&missing_from_frame_row_application};
-            const ValueTypeMetaData  *key_meta{nullptr};      // TSD key
-            std::string               key_col{};
-            const ValueTypeMetaData  *bundle_meta{nullptr};   // TSB(-child) value bundle
-            std::vector<FieldRead>    fields{};               // value cell reads
+            Frame                          frame{};
+            std::string                    dt_col{};
+            TimeDelta                      offset{};
+            std::int64_t                   row{0};
+            FromFrameRowApplication        apply_row{&missing_from_frame_row_application};
+            const ValueTypeMetaData       *key_meta{nullptr};      // TSD key
+            std::string                    key_col{};
+            const ValueTypeMetaData       *bundle_meta{nullptr};   // TSB(-child) value bundle
+            std::vector<FieldRead>         fields{};               // value cell reads
+            FrameColumnCursor              dt{};
+            FrameColumnCursor              key{};
+            std::vector<FrameColumnCursor> cells{};                // parallel to ``fields``
         };
 
         struct ReplayFrameTick
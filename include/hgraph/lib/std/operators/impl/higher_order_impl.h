@@ -1488,6 +1488,7 @@ namespace hgraph::stdlib
             SwitchNodeSpec             spec;
             std::vector<ExternalServiceSlot> external_services;
             spec.reload_on_ticked = cases.reload_on_ticked;
+            spec.warm_branches    = cases.warm_branches;
             spec.branches.reserve(cases.cases.size());
             for (const SwitchCase &entry : cases.cases)
             {
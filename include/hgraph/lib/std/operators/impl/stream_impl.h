@@ -9,6 +9,7 @@
 #include <hgraph/lib/std/operators/control.h>       // if_then_else (rolling_average)
 #include <hgraph/lib/std/operators/conversion.h>    // const_ / default_ / cast_ (rolling_average)
 #include <hgraph/lib/std/operators/impl/tsl_itemwise_impl.h>
+#include <hgraph/lib/std/window_kernels.h>
 #include <hgraph/types/operator_dispatch.h>
 #include <hgraph/types/metadata/type_realization.h>
 #include <hgraph/types/primitive_types.h>
@@ -230,9 +231,17 @@ namespace hgraph::stdlib
             }
         };
 
+        [[nodiscard]] inline bool numeric_tsw_element(const TSValueTypeMetaData *schema)
+        {
+            const auto *element = schema->value_schema->element_type;
+            return element == scalar_descriptor<Int>::value_meta() ||
+                   element == scalar_descriptor<Float>::value_meta();
+        }
+
         /** min_/max_ over a TSW: full-window recompute, fully ERASED via
             Value::compare. Recompute EMITS every window tick (no dedup: a
-            sliding window re-ticks the same extremum as it slides). */
+            sliding window re-ticks the same extremum as it slides). Int and
+            Float windows select tsw_numeric_extremum_impl instead. */
         template <bool Min>
         struct tsw_extremum_impl
         {
@@ -240,7 +249,8 @@ namespace hgraph::stdlib
 
             static bool requires_(const ResolutionMap &, OperatorCallContext context)
             {
-                return time_series_arg_matches<AnyTSW>(context, 0);
+                const auto *schema = time_series_schema_at_as<AnyTSW>(context, 0);
+                return schema != nullptr && !numeric_tsw_element(schema);
             }
 
             static void resolve_default_types(ResolutionMap &resolution, OperatorCallContext context)
@@ -275,6 +285,45 @@ namespace hgraph::stdlib
             }
         };
 
+        /** min_/max_ over an Int or Float TSW: the window kernels over its
+            contiguous runs, with the same NaN and tie behaviour as the
+            erased recompute. */
+        template <bool Min, typename T>
+        struct tsw_numeric_extremum_impl
+        {
+            static constexpr auto name = Min ? (std::same_as<T, Int> ? "min_tsw_int" : "min_tsw_float")
+                                             : (std::same_as<T, Int> ? "max_tsw_int" : "max_tsw_float");
+
+            [[nodiscard]] static bool matches(OperatorCallContext context)
+            {
+                const auto *schema = time_series_schema_at_as<AnyTSW>(context, 0);
+                return schema != nullptr &&
+                       schema->value_schema->element_type == scalar_descriptor<T>::value_meta();
+            }
+
+            static bool requires_(const ResolutionMap &, OperatorCallContext context) { return matches(context); }
+
+            static void resolve_default_types(ResolutionMap &resolution, OperatorCallContext context)
+            {
+                if (output_bound(resolution)) { return; }
+                if (!matches(context)) { return; }
+                bind_output(resolution, TypeRegistry::instance().ts(scalar_descriptor<T>::value_meta()));
+            }
+
+            static void eval(In<"ts", TsVar<"S">> ts, Out<TsVar<"__out__">> out)
+            {
+                const auto &erased = static_cast<const TSOutputView &>(out);
+                if (!ts.valid()) { return; }
+                const TSWInputView window_input{ts.base().borrowed_ref()};
+                auto window = window_input.data_view();
+                if (!tsw_ready(window)) { return; }
+
+                const T best = window_kernels::extremum<Min>(window.value_spans<T>());
+                auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
+                static_cast<void>(mutation.move_value_from(Value{best}));
+            }
+        };
+
         /** sum_/mean over a NUMERIC TSW. The element type is a TEMPLATE
             parameter selected at node-selection time (requires_ gates on the
             element meta) - the per-tick path never branches on type. */
@@ -283,7 +332,9 @@ namespace hgraph::stdlib
        O(1) retained beyond the TSW's own O(W). The window view exposes the
        evicted element, so an O(1) sufficient-statistics form is possible —
        kept as recompute deliberately: bit-exact results for Float without a
-       compensation scheme, and Int gains nothing measurable at benchmark W. */
+       compensation scheme, and Int gains nothing measurable at benchmark W.
+       The recompute reads the window's contiguous runs directly; Float keeps
+       its left-to-right order, Int uses the (exact) lane-parallel kernel. */
     struct tsw_numeric_aggregate_impl
         {
             static constexpr auto name = Mean ? (std::same_as<T, Int> ? "mean_tsw_int" : "mean_tsw_float")
@@ -316,10 +367,15 @@ namespace hgraph::stdlib
                 auto window = window_input.data_view();
                 if (!tsw_ready(window)) { return; }
 
-                T total{};
-                for (std::size_t index = 0; index < window.size(); ++index)
+                const auto runs = window.value_spans<T>();
+                T          total{};
+                if constexpr (std::same_as<T, Int>) { total = window_kernels::sum(runs); }
+                else
                 {
-                    total += window.at(index).checked_as<T>();
+                    for (const auto &run : runs)
+                    {
+                        for (const T value : run) { total += value; }
+                    }
                 }
                 auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
                 if constexpr (Mean)
@@ -332,7 +388,8 @@ namespace hgraph::stdlib
         };
 
         /** std over a NUMERIC TSW. The no-ddof overload uses the population
-            divisor; the explicit overload uses N - ddof. */
+            divisor; the explicit overload uses N - ddof. Both reduce the
+            window's contiguous runs with the two-pass variance kernel. */
         template <typename T>
         struct tsw_std_impl
         {
@@ -357,7 +414,7 @@ namespace hgraph::stdlib
 
             static void eval_with_ddof(
                 const In<"ts", TsVar<"S">> &ts, Int ddof,
-                const Out<TsVar<"__out__">> &out)
+                const Out<TsVar<"__out__">> &out, bool root = true)
             {
                 const auto &erased = static_cast<const TSOutputView &>(out);
                 if (!ts.valid()) { return; }
@@ -365,28 +422,10 @@ namespace hgraph::stdlib
                 auto window = window_input.data_view();
                 if (!tsw_ready(window)) { return; }
 
-                const auto size = window.size();
-                Float      total{};
-                for (std::size_t index = 0; index < size; ++index)
-                {
-                    total += static_cast<Float>(window.at(index).checked_as<T>());
-                }
-                const Float mean_value = total / static_cast<Float>(size);
-                Float       squares{};
-                for (std::size_t index = 0; index < size; ++index)
-                {
-                    const Float delta = static_cast<Float>(window.at(index).checked_as<T>()) - mean_value;
-                    squares += delta * delta;
-                }
-                const Float divisor =
-                    static_cast<Float>(size) - static_cast<Float>(ddof);
-                const Float variance =
-                    divisor > 0.0
-                        ? squares / divisor
-                        : std::numeric_limits<Float>::quiet_NaN();
+                const Float variance = window_kernels::variance(window.value_spans<T>(), ddof);
                 auto mutation = erased.data_view().begin_mutation(erased.evaluation_time());
                 static_cast<void>(mutation.move_value_from(
-                    Value{std::sqrt(variance)}));
+                    Value{root ? std::sqrt(variance) : variance}));
             }
 
             static void eval(In<"ts", TsVar<"S">> ts,
@@ -410,6 +449,19 @@ namespace hgraph::stdlib
             }
         };
 
+        /** var over a NUMERIC TSW: the population variance whose root the
+            no-ddof std overload reports. */
+        template <typename T>
+        struct tsw_var_impl : tsw_std_impl<T>
+        {
+            static constexpr auto name = std::same_as<T, Int> ? "var_tsw_int" : "var_tsw_float";
+
+            static void eval(In<"ts", TsVar<"S">> ts, Out<TsVar<"__out__">> out)
+            {
+                tsw_std_impl<T>::eval_with_ddof(ts, 0, out, false);
+            }
+        };
+
         /** min_/max_ over a TSW with a default while the window is below its
             minimum period (hgraph's default_value kwarg; a separate variant -
             the extremum_tss_default pattern). */
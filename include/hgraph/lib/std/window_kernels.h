@@ -0,0 +1,289 @@
+#ifndef HGRAPH_LIB_STD_WINDOW_KERNELS_H
+#define HGRAPH_LIB_STD_WINDOW_KERNELS_H
+
+#include <hgraph/types/primitive_types.h>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HGRAPH_WINDOW_KERNELS_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HGRAPH_WINDOW_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * Reductions over the contiguous runs of a numeric ``TSW``
+ * (``TSWDataView::value_spans``).
+ *
+ * Float sums and squared deviations run four lanes wide (two SSE2 or NEON
+ * registers, or four scalar accumulators elsewhere), so their rounding can
+ * differ from a left-to-right sum in the last places. Float extrema keep the
+ * left-to-right semantics of the erased ``Value::compare`` recompute: a NaN
+ * oldest element is the result, and any later NaN never wins. Int sums wrap;
+ * Int extrema and Int-to-Float conversion are plain loops the compiler
+ * vectorises where the target has 64-bit integer compares.
+ */
+namespace hgraph::stdlib::window_kernels
+{
+    /** The window as at most two contiguous runs, oldest first. */
+    template <typename T> using Runs = std::array<std::span<const T>, 2>;
+
+    namespace detail
+    {
+        inline constexpr std::size_t unroll = 4;
+
+        [[nodiscard]] inline Float sum(std::span<const Float> values) noexcept
+        {
+            const Float      *data  = values.data();
+            const std::size_t size  = values.size();
+            std::size_t       index = 0;
+#if HGRAPH_WINDOW_KERNELS_SSE2
+            __m128d low  = _mm_setzero_pd();
+            __m128d high = _mm_setzero_pd();
+            for (; index + unroll <= size; index += unroll)
+            {
+                low  = _mm_add_pd(low, _mm_loadu_pd(data + index));
+                high = _mm_add_pd(high, _mm_loadu_pd(data + index + 2));
+            }
+            const __m128d lanes = _mm_add_pd(low, high);
+            Float         total = _mm_cvtsd_f64(_mm_add_sd(lanes, _mm_unpackhi_pd(lanes, lanes)));
+#elif HGRAPH_WINDOW_KERNELS_NEON
+            float64x2_t low  = vdupq_n_f64(0.0);
+            float64x2_t high = vdupq_n_f64(0.0);
+            for (; index + unroll <= size; index += unroll)
+            {
+                low  = vaddq_f64(low, vld1q_f64(data + index));
+                high = vaddq_f64(high, vld1q_f64(data + index + 2));
+            }
+            Float total = vaddvq_f64(vaddq_f64(low, high));
+#else
+            Float lanes[unroll]{};
+            for (; index + unroll <= size; index += unroll)
+            {
+                for (std::size_t lane = 0; lane < unroll; ++lane) { lanes[lane] += data[index + lane]; }
+            }
+            Float total = (lanes[0] + lanes[2]) + (lanes[1] + lanes[3]);
+#endif
+            for (; index < size; ++index) { total += data[index]; }
+            return total;
+        }
+
+        [[nodiscard]] inline Float squared_deviation(std::span<const Float> values, Float mean) noexcept
+        {
+            const Float      *data  = values.data();
+            const std::size_t size  = values.size();
+            std::size_t       index = 0;
+#if HGRAPH_WINDOW_KERNELS_SSE2
+            const __m128d centre = _mm_set1_pd(mean);
+            __m128d       low    = _mm_setzero_pd();
+            __m128d       high   = _mm_setzero_pd();
+            for (; index + unroll <= size; index += unroll)
+            {
+                const __m128d first  = _mm_sub_pd(_mm_loadu_pd(data + index), centre);
+                const __m128d second = _mm_sub_pd(_mm_loadu_pd(data + index + 2), centre);
+                low  = _mm_add_pd(low, _mm_mul_pd(first, first));
+                high = _mm_add_pd(high, _mm_mul_pd(second, second));
+            }
+            const __m128d lanes = _mm_add_pd(low, high);
+            Float         total = _mm_cvtsd_f64(_mm_add_sd(lanes, _mm_unpackhi_pd(lanes, lanes)));
+#elif HGRAPH_WINDOW_KERNELS_NEON
+            const float64x2_t centre = vdupq_n_f64(mean);
+            float64x2_t       low    = vdupq_n_f64(0.0);
+            float64x2_t       high   = vdupq_n_f64(0.0);
+            for (; index + unroll <= size; index += unroll)
+            {
+                const float64x2_t first  = vsubq_f64(vld1q_f64(data + index), centre);
+                const float64x2_t second = vsubq_f64(vld1q_f64(data + index + 2), centre);
+                low  = vaddq_f64(low, vmulq_f64(first, first));
+                high = vaddq_f64(high, vmulq_f64(second, second));
+            }
+            Float total = vaddvq_f64(vaddq_f64(low, high));
+#else
+            Float lanes[unroll]{};
+            for (; index + unroll <= size; index += unroll)
+            {
+                for (std::size_t lane = 0; lane < unroll; ++lane)
+                {
+                    const Float delta = data[index + lane] - mean;
+                    lanes[lane] += delta * delta;
+                }
+            }
+            Float total = (lanes[0] + lanes[2]) + (lanes[1] + lanes[3]);
+#endif
+            for (; index < size; ++index)
+            {
+                const Float delta = data[index] - mean;
+                total += delta * delta;
+            }
+            return total;
+        }
+
+        [[nodiscard]] inline Int sum(std::span<const Int> values) noexcept
+        {
+            std::uint64_t total = 0;
+            for (const Int value : values) { total += static_cast<std::uint64_t>(value); }
+            return std::bit_cast<Int>(total);
+        }
+
+        [[nodiscard]] inline Float float_sum(std::span<const Int> values) noexcept
+        {
+            Float lanes[unroll]{};
+            std::size_t index = 0;
+            for (; index + unroll <= values.size(); index += unroll)
+            {
+                for (std::size_t lane = 0; lane < unroll; ++lane)
+                {
+                    lanes[lane] += static_cast<Float>(values[index + lane]);
+                }
+            }
+            Float total = (lanes[0] + lanes[2]) + (lanes[1] + lanes[3]);
+            for (; index < values.size(); ++index) { total += static_cast<Float>(values[index]); }
+            return total;
+        }
+
+        [[nodiscard]] inline Float squared_deviation(std::span<const Int> values, Float mean) noexcept
+        {
+            Float lanes[unroll]{};
+            std::size_t index = 0;
+            for (; index + unroll <= values.size(); index += unroll)
+            {
+                for (std::size_t lane = 0; lane < unroll; ++lane)
+                {
+                    const Float delta = static_cast<Float>(values[index + lane]) - mean;
+                    lanes[lane] += delta * delta;
+                }
+            }
+            Float total = (lanes[0] + lanes[2]) + (lanes[1] + lanes[3]);
+            for (; index < values.size(); ++index)
+            {
+                const Float delta = static_cast<Float>(values[index]) - mean;
+                total += delta * delta;
+            }
+            return total;
+        }
+
+        /** Fold ``values`` into ``best`` (never NaN), keeping the earlier of
+            equal values and skipping NaN elements. */
+        template <bool Min> [[nodiscard]] inline Float extremum(std::span<const Float> values, Float best) noexcept
+        {
+            const Float      *data  = values.data();
+            const std::size_t size  = values.size();
+            std::size_t       index = 0;
+#if HGRAPH_WINDOW_KERNELS_SSE2
+            // MINPD/MAXPD return the second operand on a tie or a NaN, which
+            // is exactly "replace only on a strict improvement".
+            __m128d low  = _mm_set1_pd(best);
+            __m128d high = low;
+            for (; index + unroll <= size; index += unroll)
+            {
+                const __m128d first  = _mm_loadu_pd(data + index);
+                const __m128d second = _mm_loadu_pd(data + index + 2);
+                low  = Min ? _mm_min_pd(first, low) : _mm_max_pd(first, low);
+                high = Min ? _mm_min_pd(second, high) : _mm_max_pd(second, high);
+            }
+            alignas(16) Float lanes[unroll];
+            _mm_store_pd(lanes, low);
+            _mm_store_pd(lanes + 2, high);
+#elif HGRAPH_WINDOW_KERNELS_NEON
+            float64x2_t low  = vdupq_n_f64(best);
+            float64x2_t high = low;
+            for (; index + unroll <= size; index += unroll)
+            {
+                const float64x2_t first  = vld1q_f64(data + index);
+                const float64x2_t second = vld1q_f64(data + index + 2);
+                low  = vbslq_f64(Min ? vcltq_f64(first, low) : vcgtq_f64(first, low), first, low);
+                high = vbslq_f64(Min ? vcltq_f64(second, high) : vcgtq_f64(second, high), second, high);
+            }
+            Float lanes[unroll];
+            vst1q_f64(lanes, low);
+            vst1q_f64(lanes + 2, high);
+#else
+            Float lanes[unroll]{best, best, best, best};
+            for (; index + unroll <= size; index += unroll)
+            {
+                for (std::size_t lane = 0; lane < unroll; ++lane)
+                {
+                    const Float value = data[index + lane];
+                    if (Min ? value < lanes[lane] : value > lanes[lane]) { lanes[lane] = value; }
+                }
+            }
+#endif
+            for (const Float lane : lanes)
+            {
+                if (Min ? lane < best : lane > best) { best = lane; }
+            }
+            for (; index < size; ++index)
+            {
+                const Float value = data[index];
+                if (Min ? value < best : value > best) { best = value; }
+            }
+            return best;
+        }
+
+        template <bool Min> [[nodiscard]] inline Int extremum(std::span<const Int> values, Int best) noexcept
+        {
+            for (const Int value : values) { best = Min ? (value < best ? value : best) : (value > best ? value : best); }
+            return best;
+        }
+    }  // namespace detail
+
+    template <typename T> [[nodiscard]] inline std::size_t count(const Runs<T> &runs) noexcept
+    {
+        return runs[0].size() + runs[1].size();
+    }
+
+    /** Sum of every element. */
+    template <typename T> [[nodiscard]] inline T sum(const Runs<T> &runs) noexcept
+    {
+        return detail::sum(runs[0]) + detail::sum(runs[1]);
+    }
+
+    /** Arithmetic mean; NaN for an empty window. */
+    template <typename T> [[nodiscard]] inline Float mean(const Runs<T> &runs) noexcept
+    {
+        const std::size_t size = count(runs);
+        if (size == 0) { return std::numeric_limits<Float>::quiet_NaN(); }
+        return static_cast<Float>(sum(runs)) / static_cast<Float>(size);
+    }
+
+    /** Smallest (``Min``) or largest element of a non-empty window. */
+    template <bool Min, typename T> [[nodiscard]] inline T extremum(const Runs<T> &runs) noexcept
+    {
+        const T first = runs[0].empty() ? runs[1].front() : runs[0].front();
+        if constexpr (std::same_as<T, Float>)
+        {
+            if (std::isnan(first)) { return first; }
+        }
+        return detail::extremum<Min>(runs[1], detail::extremum<Min>(runs[0], first));
+    }
+
+    template <typename T> [[nodiscard]] inline T min(const Runs<T> &runs) noexcept { return extremum<true>(runs); }
+
+    template <typename T> [[nodiscard]] inline T max(const Runs<T> &runs) noexcept { return extremum<false>(runs); }
+
+    /** Two-pass variance with divisor ``N - ddof``: NaN when that is not
+        positive. The deviations are taken from the computed mean, avoiding
+        the cancellation of a sum-of-squares form. */
+    template <typename T> [[nodiscard]] inline Float variance(const Runs<T> &runs, Int ddof = 0) noexcept
+    {
+        const std::size_t size    = count(runs);
+        const Float       divisor = static_cast<Float>(size) - static_cast<Float>(ddof);
+        if (size == 0 || !(divisor > 0.0)) { return std::numeric_limits<Float>::quiet_NaN(); }
+        Float total;
+        if constexpr (std::same_as<T, Int>) { total = detail::float_sum(runs[0]) + detail::float_sum(runs[1]); }
+        else { total = detail::sum(runs[0]) + detail::sum(runs[1]); }
+        const Float centre = total / static_cast<Float>(size);
+        return (detail::squared_deviation(runs[0], centre) + detail::squared_deviation(runs[1], centre)) / divisor;
+    }
+}  // namespace hgraph::stdlib::window_kernels
+
+#endif  // HGRAPH_LIB_STD_WINDOW_KERNELS_H
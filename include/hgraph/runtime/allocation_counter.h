@@ -0,0 +1,47 @@
+#ifndef HGRAPH_RUNTIME_ALLOCATION_COUNTER_H
+#define HGRAPH_RUNTIME_ALLOCATION_COUNTER_H
+
+#include <hgraph/hgraph_export.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Monotonic per-thread allocation counters.
+ *
+ * The library never replaces the global allocator itself. An executable
+ * opts in by including ``hgraph/runtime/allocation_hooks.h`` in exactly
+ * one translation unit; its replacement ``operator new`` family calls
+ * ``count_thread_allocation``. Readers take two ``thread_allocation_count``
+ * readings and subtract, as the evaluation profiler does around each node
+ * evaluation. Without the hooks every reading is zero, and the profiler
+ * refuses to count.
+ */
+namespace hgraph
+{
+    /** Heap allocations counted on one thread: calls and requested bytes. */
+    struct AllocationCount
+    {
+        std::uint64_t allocations{0};
+        std::uint64_t bytes{0};
+
+        [[nodiscard]] friend AllocationCount operator-(AllocationCount lhs, AllocationCount rhs) noexcept
+        {
+            return AllocationCount{lhs.allocations - rhs.allocations, lhs.bytes - rhs.bytes};
+        }
+    };
+
+    /** Count one allocation of ``bytes`` on the calling thread. */
+    HGRAPH_EXPORT void count_thread_allocation(std::size_t bytes) noexcept;
+
+    /** The calling thread's counters since it started. */
+    [[nodiscard]] HGRAPH_EXPORT AllocationCount thread_allocation_count() noexcept;
+
+    /** Record that replacement allocation functions are counting. */
+    HGRAPH_EXPORT void mark_allocation_counting_installed() noexcept;
+
+    /** Whether an executable installed ``allocation_hooks.h``. */
+    [[nodiscard]] HGRAPH_EXPORT bool allocation_counting_installed() noexcept;
+}  // namespace hgraph
+
+#endif  // HGRAPH_RUNTIME_ALLOCATION_COUNTER_H
@@ -0,0 +1,139 @@
+#ifndef HGRAPH_RUNTIME_ALLOCATION_HOOKS_H
+#define HGRAPH_RUNTIME_ALLOCATION_HOOKS_H
+
+/**
+ * Counting replacements for the global ``operator new`` and ``operator
+ * delete`` families.
+ *
+ * Include this header in exactly one translation unit of an executable to
+ * feed ``thread_allocation_count`` (and through it the evaluation
+ * profiler's per-node allocation figures). Replacement allocation functions
+ * are program-wide, so a shared library, a Python extension, or a second
+ * translation unit must never include it, which is also why a Python
+ * process cannot count allocations. Storage comes from ``malloc`` and
+ * ``posix_memalign`` (``_aligned_malloc`` on MSVC). The
+ * ``hgraph_type_erasure_perf`` harness and ``hgraph_allocation_hooks_test``
+ * install these hooks.
+ */
+
+#include <hgraph/runtime/allocation_counter.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    [[nodiscard]] void *hgraph_counted_allocate(std::size_t size)
+    {
+        hgraph::count_thread_allocation(size);
+        if (void *memory = std::malloc(std::max<std::size_t>(size, 1))) { return memory; }
+        throw std::bad_alloc{};
+    }
+
+    [[nodiscard]] void *hgraph_counted_allocate(std::size_t size, std::align_val_t alignment)
+    {
+        hgraph::count_thread_allocation(size);
+        const std::size_t actual_size = std::max<std::size_t>(size, 1);
+#if defined(_MSC_VER)
+        if (void *memory = _aligned_malloc(actual_size, static_cast<std::size_t>(alignment))) { return memory; }
+#else
+        void *memory = nullptr;
+        if (posix_memalign(&memory, static_cast<std::size_t>(alignment), actual_size) == 0) { return memory; }
+#endif
+        throw std::bad_alloc{};
+    }
+
+    void hgraph_counted_free_aligned(void *memory) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    const bool hgraph_allocation_counting_marked = [] {
+        hgraph::mark_allocation_counting_installed();
+        return true;
+    }();
+}  // namespace
+
+void *operator new(std::size_t size) { return hgraph_counted_allocate(size); }
+void *operator new[](std::size_t size) { return hgraph_counted_allocate(size); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return hgraph_counted_allocate(size, alignment); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return hgraph_counted_allocate(size, alignment); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return hgraph_counted_allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return hgraph_counted_allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return hgraph_counted_allocate(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return hgraph_counted_allocate(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { hgraph_counted_free_aligned(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { hgraph_counted_free_aligned(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept { hgraph_counted_free_aligned(memory); }
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept { hgraph_counted_free_aligned(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    hgraph_counted_free_aligned(memory);
+}
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    hgraph_counted_free_aligned(memory);
+}
+
+#endif  // HGRAPH_RUNTIME_ALLOCATION_HOOKS_H
@@ -2,16 +2,68 @@
 #define HGRAPH_RUNTIME_EVALUATION_PROFILER_H
 
 #include <hgraph/hgraph_export.h>
+#include <hgraph/runtime/allocation_counter.h>
 #include <hgraph/runtime/lifecycle_observer.h>
 #include <hgraph/util/date_time.h>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace hgraph {
+/**
+ * Fixed-memory latency distribution at nanosecond resolution.
+ *
+ * Buckets are log-linear, as in an HDR histogram: every power-of-two range
+ * splits into ``sub_buckets`` equal buckets, so a reported quantile is within
+ * one sixteenth of the samples it stands for. Samples of ``max_trackable`` or
+ * more count in the last bucket; ``max()`` stays exact. Recording is a few
+ * integer operations and never allocates.
+ */
+class HGRAPH_EXPORT LatencyHistogram {
+public:
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr std::size_t sub_bucket_bits = 4;
+  static constexpr std::size_t sub_buckets = std::size_t{1} << sub_bucket_bits;
+  /** Exponent of the first power of two that is not tracked (about 18 min). */
+  static constexpr std::size_t max_exponent = 40;
+  static constexpr std::size_t bucket_count =
+      sub_buckets * (max_exponent - sub_bucket_bits + 1);
+  static constexpr Duration max_trackable{std::int64_t{1} << max_exponent};
+
+  void record(Duration value) noexcept;
+  void merge(const LatencyHistogram &other) noexcept;
+
+  [[nodiscard]] std::uint64_t count() const noexcept { return count_; }
+  [[nodiscard]] Duration max() const noexcept { return max_; }
+
+  /** Upper bound of the bucket holding the ``q``-th sample, capped at
+      ``max()``; zero when empty. ``q`` is clamped to ``[0, 1]``. */
+  [[nodiscard]] Duration quantile(double q) const noexcept;
+  [[nodiscard]] Duration p50() const noexcept { return quantile(0.5); }
+  [[nodiscard]] Duration p99() const noexcept { return quantile(0.99); }
+  [[nodiscard]] Duration p999() const noexcept { return quantile(0.999); }
+
+  [[nodiscard]] const std::array<std::uint64_t, bucket_count> &
+  counts() const noexcept {
+    return counts_;
+  }
+  /** Smallest and largest nanosecond value counted in ``bucket``. */
+  [[nodiscard]] static Duration bucket_lower_bound(std::size_t bucket) noexcept;
+  [[nodiscard]] static Duration bucket_upper_bound(std::size_t bucket) noexcept;
+
+private:
+  std::array<std::uint64_t, bucket_count> counts_{};
+  std::uint64_t count_{0};
+  Duration max_{0};
+};
+
 /** Aggregate timings for one lifecycle phase of one graph or node. */
 struct HGRAPH_EXPORT EvaluationProfilePhase {
   std::uint64_t count{0};
@@ -19,6 +71,17 @@ struct HGRAPH_EXPORT EvaluationProfilePhase {
   TimeDelta total_time{0};
   TimeDelta max_time{0};
   TimeDelta recent_time{0};
+  /** Per-evaluation distribution; set on the evaluation phase only, and only
+      when the profiler collects histograms. Held out of line and shared
+      between snapshot copies, so a phase without one stays small. */
+  std::shared_ptr<const LatencyHistogram> latency{};
+  /** Heap allocations and requested bytes summed over every evaluation, and
+      the most seen in any one; counted on the evaluation phase only, and
+      only when the profiler counts allocations. */
+  std::uint64_t allocations{0};
+  std::uint64_t allocated_bytes{0};
+  std::uint64_t max_allocations{0};
+  std::uint64_t max_allocated_bytes{0};
 };
 
 /** Owned profile entry. No runtime graph/node pointer escapes into a snapshot.
@@ -41,6 +104,10 @@ struct HGRAPH_EXPORT EvaluationProfileSnapshot {
   TimeDelta scheduling_lag_max{0};
   std::uint64_t scheduling_lag_samples{0};
   double runtime_load{0.0};
+  /** Root evaluation time per cycle; set when collecting histograms. */
+  std::shared_ptr<const LatencyHistogram> cycle_latency{};
+  /** Real-time scheduling lag per cycle; set when collecting histograms. */
+  std::shared_ptr<const LatencyHistogram> scheduling_lag{};
   std::vector<EvaluationProfileEntry> entries{};
 };
 
@@ -52,6 +119,14 @@ struct HGRAPH_EXPORT EvaluationProfilerOptions {
   bool node{true};
   bool graph{true};
   std::size_t recent_window{100};
+  /** Keep latency histograms per evaluated entry and per cycle. Each costs a
+      fixed few kilobytes, reserved when its entry is first registered. */
+  bool histograms{false};
+  /** Count heap allocations made on the evaluating thread between each
+      entry's before and after evaluation callbacks. Needs the counting
+      allocator of ``hgraph/runtime/allocation_hooks.h``: the profiler throws
+      ``std::invalid_argument`` when it is requested without it. */
+  bool allocations{false};
 };
 
 /**
@@ -71,7 +146,9 @@ public:
   explicit EvaluationProfiler(EvaluationProfilerOptions options = {});
   explicit EvaluationProfiler(bool start, bool eval = true, bool stop = true,
                               bool node = true, bool graph = true,
-                              std::size_t recent_window = 100);
+                              std::size_t recent_window = 100,
+                              bool histograms = false,
+                              bool allocations = false);
 
   [[nodiscard]] EvaluationProfileSnapshot snapshot() const;
   void reset();
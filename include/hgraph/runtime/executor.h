@@ -15,6 +15,7 @@
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace spdlog
 {
@@ -44,6 +45,27 @@ namespace hgraph
         RealTime,
     };
 
+    /**
+     * How the real-time run loop waits between cycles for its target time, a
+     * push wake or a stop request.
+     *
+     * Blocking costs a kernel wake-up and context switch per push wake, tens
+     * of microseconds. The spinning strategies poll the wake flags and the
+     * wall clock instead and trade a busy core for single-digit-microsecond
+     * tick-to-evaluate latency.
+     */
+    enum class RealTimeWaitStrategy : std::uint8_t
+    {
+        /** Wait on the run loop's condition variable (the default). */
+        Block,
+        /** Poll until the target, a wake or a stop; never blocks. */
+        Spin,
+        /** Poll for the spin budget, then poll yielding the core between reads. */
+        SpinThenYield,
+        /** Poll for the spin budget, then wait as ``Block`` does. */
+        SpinThenBlock,
+    };
+
     /** Complete root-executor phases that may be wrapped by an embedding
         runtime. Native executors have no wrapper by default. */
     enum class GraphExecutorPhase : std::uint8_t
@@ -143,6 +165,9 @@ namespace hgraph
             const void *context, const void *memory) noexcept = nullptr;
         bool (*cleanup_on_error_impl)(const void *context,
                                       const void *memory) noexcept = nullptr;
+        /** Participants for rank-level parallel root evaluation; 0 or 1 is sequential. */
+        std::size_t (*parallel_evaluation_threads_impl)(const void *context,
+                                                       const void *memory) noexcept = nullptr;
     };
 
     /** Real-time push queue projection over the root graph executor. */
@@ -247,6 +272,8 @@ namespace hgraph
         [[nodiscard]] ErrorCaptureOptions error_capture_options() const noexcept;
         /** Whether a failed run stops the graph before propagating its error. */
         [[nodiscard]] bool cleanup_on_error() const noexcept;
+        /** Participants used to evaluate independent rank levels of the root graph. */
+        [[nodiscard]] std::size_t parallel_evaluation_threads() const noexcept;
 
         /**
          * Run this executor on the calling thread.
@@ -275,6 +302,8 @@ namespace hgraph
 
         GraphExecutorValue() noexcept;
         explicit GraphExecutorValue(const GraphExecutorBuilder &builder);
+        /** Construct from ``builder`` with its start and end times replaced. */
+        GraphExecutorValue(const GraphExecutorBuilder &builder, DateTime start_time, DateTime end_time);
         ~GraphExecutorValue();
 
         GraphExecutorValue(const GraphExecutorValue &) = delete;
@@ -347,6 +376,52 @@ namespace hgraph
          * simulation mode.
          */
         GraphExecutorBuilder &max_wait_slice(TimeDelta slice) noexcept;
+        /**
+         * Select how the real-time run loop waits between cycles (see
+         * ``RealTimeWaitStrategy``). ``spin_budget`` bounds the polling phase
+         * of each wait under ``SpinThenYield`` and ``SpinThenBlock``; a
+         * non-positive budget selects the default of 50 microseconds.
+         * ``Spin`` polls for the whole wait, so an idle graph keeps its core
+         * busy until ``end_time``. Ignored in simulation mode.
+         */
+        GraphExecutorBuilder &wait_strategy(RealTimeWaitStrategy strategy,
+                                            TimeDelta spin_budget = TimeDelta{50}) noexcept;
+        /**
+         * Pin the thread that calls ``run()`` to ``cpus`` for the duration of
+         * a real-time run, restoring its previous affinity when the run
+         * returns. Pairs with a spinning wait strategy to keep the run loop
+         * on an isolated core. Empty (the default) leaves affinity alone.
+         * Supported on Linux and Windows; elsewhere, and for a CPU the
+         * platform cannot address, ``run()`` throws ``std::invalid_argument``.
+         * Ignored in simulation mode.
+         */
+        GraphExecutorBuilder &evaluation_cpus(std::vector<std::size_t> cpus);
+        /**
+         * Opt into parallel evaluation of the root graph. At construction the
+         * root graph's nodes are partitioned into dependency levels (a node's
+         * level is one more than the deepest producer bound to it). Within a
+         * cycle, the due nodes of one level are evaluated concurrently by
+         * ``threads`` participants (the run thread plus ``threads - 1``
+         * workers); levels still complete in order, so every node observes the
+         * same inputs as in sequential evaluation and outputs are
+         * deterministic.
+         *
+         * Only native compute and sink nodes without Python values,
+         * global-state access or a phase-runner requirement run concurrently;
+         * other nodes of a level run afterwards on the run thread in rank
+         * order. Nested graphs evaluate sequentially, as does a root graph
+         * with REF endpoints or pooled compound scalars, and any cycle with
+         * registered lifecycle observers.
+         *
+         * The same pool evaluates the due children of a ``map_`` concurrently
+         * when every child node is an eligible compute, sink or pull-source
+         * node without REF endpoints, and the map is not itself running on a
+         * pool thread. Children write their own output elements; the map then
+         * finalises them in key-slot order. Native node callbacks that run
+         * concurrently must not share mutable state outside their own node
+         * storage. ``0`` or ``1`` (the default) disables the mode.
+         */
+        GraphExecutorBuilder &parallel_evaluation(std::size_t threads) noexcept;
         /** Register a lifecycle observer for this executor's run (see ``LifecycleObserver``). */
         GraphExecutorBuilder &add_lifecycle_observer(LifecycleObserver *observer);
 
@@ -362,10 +437,21 @@ namespace hgraph
         [[nodiscard]] const GraphExecutorPhaseRunner &phase_runner() const noexcept;
         [[nodiscard]] std::uint32_t max_consecutive_immediate_cycles() const noexcept;
         [[nodiscard]] TimeDelta max_wait_slice() const noexcept;
+        [[nodiscard]] RealTimeWaitStrategy wait_strategy() const noexcept;
+        [[nodiscard]] TimeDelta spin_budget() const noexcept;
+        [[nodiscard]] const std::vector<std::size_t> &evaluation_cpus() const noexcept;
+        [[nodiscard]] std::size_t parallel_evaluation_threads() const noexcept;
         [[nodiscard]] const std::vector<LifecycleObserver *> &lifecycle_observers() const noexcept;
         [[nodiscard]] GraphTypeRef graph_type() const;
         [[nodiscard]] ExecutorTypeRef type() const;
         [[nodiscard]] GraphExecutorValue make_executor() const;
+        /**
+         * Make an executor that runs from ``start_time`` to ``end_time``
+         * instead of the configured times, without copying this recipe.
+         * Repeated runs of one wiring over different intervals share its
+         * graph builder and compiled type records.
+         */
+        [[nodiscard]] GraphExecutorValue make_executor(DateTime start_time, DateTime end_time) const;
 
       private:
         friend class GraphExecutorValue;
@@ -383,6 +469,10 @@ namespace hgraph
         GraphExecutorPhaseRunner        phase_runner_{};
         std::uint32_t                   max_consecutive_immediate_cycles_{0};
         TimeDelta                       max_wait_slice_{10'000'000};
+        RealTimeWaitStrategy            wait_strategy_{RealTimeWaitStrategy::Block};
+        TimeDelta                       spin_budget_{50};
+        std::vector<std::size_t>        evaluation_cpus_{};
+        std::size_t                     parallel_evaluation_threads_{0};
         std::vector<LifecycleObserver *> lifecycle_observers_{};
         mutable ExecutorTypeRef          type_{};
     };
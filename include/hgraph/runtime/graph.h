@@ -177,6 +177,9 @@ struct HGRAPH_EXPORT GraphEdge
         /** Cached non-null passive emission policy for the run logger. */
         const LoggerOps *(*logger_ops_impl)(const void *context,
                                             const void *memory) noexcept = nullptr;
+        /** Cached allocator for nested-graph storage (the root's arena or the default). */
+        const MemoryUtils::AllocatorOps *(*storage_allocator_impl)(const void *context,
+                                                                   const void *memory) noexcept = nullptr;
     };
 
     /** Borrowed type-erased view over graph runtime storage. */
@@ -250,6 +253,13 @@ struct HGRAPH_EXPORT GraphEdge
         /** Borrowed executor-owned logger, cached by root and nested graphs. */
         [[nodiscard]] spdlog::logger *logger() const noexcept;
         [[nodiscard]] const LoggerOps *logger_ops() const noexcept;
+        /**
+         * Allocator for storage owned on behalf of nested graphs (keyed child
+         * slots, heap-placed child graphs). Root graphs built with
+         * ``GraphBuilder::storage_arena`` return their arena and every nested
+         * graph below returns its root's; otherwise the default allocator.
+         */
+        [[nodiscard]] const MemoryUtils::AllocatorOps &storage_allocator() const noexcept;
         /** Closed Bundle hierarchy snapshot used by this graph instance. */
         [[nodiscard]] const TypeRealizationSnapshot *type_realization() const noexcept;
         /** Root-owned graph-local storage shared by all nested graphs. */
@@ -362,6 +372,14 @@ struct HGRAPH_EXPORT GraphEdge
 
         void schedule_node(std::size_t node_index, DateTime when);
 
+        /**
+         * Destroy the node storage of a stopped nested graph held in
+         * caller-owned storage, keeping its header and memory. A cleared graph
+         * may only be destroyed or rebuilt by ``GraphBuilder::reset_nested_graph``.
+         * Returns false, leaving the graph untouched, for any other graph.
+         */
+        [[nodiscard]] bool clear_nodes() noexcept;
+
       private:
         GraphValue(const GraphBuilder &builder, NodePtr parent_node,
                    void *external_memory, MemoryUtils::StorageLayout available_layout);
@@ -407,6 +425,17 @@ struct HGRAPH_EXPORT GraphEdge
         /** The trait store (a value-layer ``Map<string, Any>``, like ``GlobalState``). */
         [[nodiscard]] GlobalStateView traits() noexcept;
 
+        /**
+         * Give each root graph made by this builder a ``StorageArena`` with
+         * ``chunk_bytes`` chunks (0 disables, the default). Nested-graph
+         * storage anywhere below the root — keyed child slots and
+         * heap-placed child graphs — is then carved from the arena, keeping
+         * it contiguous, and released in one step with the root graph.
+         * Ignored when the builder is used for nested graphs.
+         */
+        GraphBuilder &storage_arena(std::size_t chunk_bytes);
+        [[nodiscard]] std::size_t storage_arena() const noexcept;
+
         [[nodiscard]] std::string_view label() const noexcept;
         [[nodiscard]] std::size_t node_count() const noexcept;
         [[nodiscard]] const std::vector<NodeBuilder> &nodes() const noexcept;
@@ -426,6 +455,15 @@ struct HGRAPH_EXPORT GraphEdge
         [[nodiscard]] GraphValue make_nested_graph(NodePtr parent_node,
                                                    void *external_memory,
                                                    MemoryUtils::StorageLayout available_layout) const;
+        /**
+         * Re-initialise a stopped (or cleared, see ``GraphValue::clear_nodes``)
+         * nested graph made by this builder in caller-owned storage, in place.
+         * Its node storage is constructed afresh and its edges bound, so it
+         * behaves as a newly made graph under the same parent; the graph
+         * header and memory are kept. If the rebuild throws, ``graph`` is
+         * left empty.
+         */
+        void reset_nested_graph(GraphValue &graph) const;
 
       private:
         friend class GraphValue;
@@ -437,6 +475,7 @@ struct HGRAPH_EXPORT GraphEdge
         std::vector<GraphEdge>        edges_{};
         GlobalState                   global_state_{};
         GlobalState                   traits_{};   // trait store: same value-layer Map<string, Any> shape
+        std::size_t                   storage_arena_chunk_bytes_{0};
         mutable GraphTypeRef          root_type_{};
         mutable GraphTypeRef          nested_type_{};
         mutable bool                  types_compiled_{false};
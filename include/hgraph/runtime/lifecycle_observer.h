@@ -291,20 +291,31 @@ namespace hgraph
         }
 
       private:
+        /**
+         * Tracks re-entrant notification so removals compact afterwards. An
+         * empty list is left untouched, which keeps notification free of
+         * shared writes for graphs evaluated on several threads.
+         */
         struct NotifyGuard
         {
-            explicit NotifyGuard(const LifecycleObserverList &owner) noexcept : owner(owner) { ++owner.m_notify_depth; }
+            explicit NotifyGuard(const LifecycleObserverList &owner) noexcept
+                : owner(owner), active(!owner.m_observers.empty())
+            {
+                if (active) { ++owner.m_notify_depth; }
+            }
 
             NotifyGuard(const NotifyGuard &) = delete;
             NotifyGuard &operator=(const NotifyGuard &) = delete;
 
             ~NotifyGuard() noexcept
             {
+                if (!active) { return; }
                 --owner.m_notify_depth;
                 if (owner.m_notify_depth == 0 && owner.m_compact_pending) { owner.compact(); }
             }
 
             const LifecycleObserverList &owner;
+            bool                         active;
         };
 
         void compact() const noexcept
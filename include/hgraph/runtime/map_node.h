@@ -8,10 +8,19 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <string_view>
 #include <vector>
 
 namespace hgraph
 {
+    /**
+     * Graph trait (an ``Int``) opting the ``map_`` and ``mesh_`` nodes below
+     * it into child-graph recycling: up to that many erased child graphs per
+     * node keep their memory and are rebuilt in place for the next key that
+     * lands on their slot. Absent or ``0`` destroys children on erase.
+     */
+    inline constexpr std::string_view RECYCLED_CHILD_GRAPHS_TRAIT = "recycled_child_graphs";
+
     /** How one child boundary argument of a ``map_`` child graph is sourced. */
     enum class MapArgSourceKind : std::uint8_t
     {
@@ -78,6 +87,10 @@ namespace hgraph
         [[nodiscard]] std::size_t     child_graph_count() const noexcept;
         /** True when every constructed child graph resides in its stable entry slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
+        /** Erased child graphs parked for reuse (see ``RECYCLED_CHILD_GRAPHS_TRAIT``). */
+        [[nodiscard]] std::size_t     parked_child_graph_count() const noexcept;
+        /** Child graphs rebuilt from a parked graph rather than newly constructed. */
+        [[nodiscard]] std::size_t     recycled_child_graph_count() const noexcept;
 
         /** Internal (map_node implementation) — the registered context / storage. */
         [[nodiscard]] const void *internal_context() const noexcept { return context_; }
@@ -59,6 +59,10 @@ namespace hgraph
         [[nodiscard]] std::size_t     child_graph_count() const noexcept;
         /** True when every constructed instance graph resides in its stable key slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
+        /** Erased instance graphs parked for reuse (see ``RECYCLED_CHILD_GRAPHS_TRAIT``). */
+        [[nodiscard]] std::size_t     parked_child_graph_count() const noexcept;
+        /** Instance graphs rebuilt from a parked graph rather than newly constructed. */
+        [[nodiscard]] std::size_t     recycled_child_graph_count() const noexcept;
 
         /**
          * The key of the instance whose child graph is currently being evaluated.
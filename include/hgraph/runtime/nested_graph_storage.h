@@ -2,6 +2,7 @@
 #define HGRAPH_RUNTIME_NESTED_GRAPH_STORAGE_H
 
 #include <hgraph/types/metadata/debug_descriptor.h>
+#include <hgraph/types/utils/slot_bitmap.h>
 #include <hgraph/types/utils/stable_slot_store.h>
 
 #include <algorithm>
@@ -22,6 +23,14 @@ namespace hgraph
      * existing slots remain stable. Entry destruction owns the GraphValue
      * handle and therefore destroys the externally-placed graph before the raw
      * slot memory is released.
+     *
+     * With a recycle limit, up to that many released entries are parked
+     * instead of destroyed: the graph's node storage is cleared, while the
+     * entry and the graph header stay constructed and the slot reads as empty.
+     * ``recycle_at`` rebuilds a parked slot's graph in place for the next
+     * entry built in that slot. Graph memory is addressed by slot,
+     * so a parked graph can only serve its own slot; key sets reuse their most
+     * recently freed slot first, which is what key churn hits.
      */
     template <typename Entry>
     class InPlaceGraphSlotStore
@@ -51,6 +60,10 @@ namespace hgraph
             swap(slot_layout_, other.slot_layout_);
             swap(graph_offset_, other.graph_offset_);
             swap(bound_, other.bound_);
+            swap(parked_, other.parked_);
+            swap(parked_count_, other.parked_count_);
+            swap(recycle_limit_, other.recycle_limit_);
+            swap(recycled_, other.recycled_);
         }
 
         void bind_graph_layout(MemoryUtils::StorageLayout graph_layout)
@@ -94,10 +107,23 @@ namespace hgraph
         [[nodiscard]] MemoryUtils::StorageLayout graph_layout() const noexcept { return graph_layout_; }
         [[nodiscard]] MemoryUtils::StorageLayout slot_layout() const noexcept { return slot_layout_; }
         [[nodiscard]] size_t graph_offset() const noexcept { return graph_offset_; }
-        [[nodiscard]] bool has_entries() const noexcept { return storage_.constructed_count() != 0; }
+        [[nodiscard]] bool has_entries() const noexcept { return entry_count() != 0; }
         [[nodiscard]] size_t entry_count() const noexcept
         {
-            return storage_.constructed_count();
+            return storage_.constructed_count() - parked_count_;
+        }
+        [[nodiscard]] size_t parked_count() const noexcept { return parked_count_; }
+        [[nodiscard]] size_t parked_bytes() const noexcept { return parked_count_ * slot_layout_.size; }
+        [[nodiscard]] size_t recycle_limit() const noexcept { return recycle_limit_; }
+        /** Entries whose graph came from a parked entry. */
+        [[nodiscard]] size_t recycled_count() const noexcept { return recycled_; }
+
+        /** Park at most ``limit`` released entries (``0``, the default, parks none). */
+        void set_recycle_limit(size_t limit)
+        {
+            if (limit != 0) { parked_.resize(std::max(parked_.size(), slot_capacity())); }
+            recycle_limit_ = limit;
+            while (parked_count_ > recycle_limit_) { destroy_at(first_parked()); }
         }
         [[nodiscard]] size_t live_bytes() const noexcept
         {
@@ -112,12 +138,36 @@ namespace hgraph
         {
             require_bound();
             if (capacity <= storage_.slot_capacity()) { return; }
+            if (recycle_limit_ != 0) { parked_.resize(capacity); }
             storage_.reserve_to(capacity);
         }
 
         [[nodiscard]] bool has_entry(size_t slot) const noexcept
         {
-            return storage_.constructed(slot);
+            return storage_.constructed(slot) && !parked_.test(slot);
+        }
+
+        /** The entry parked in ``slot``, if any. Its graph's nodes are cleared. */
+        [[nodiscard]] Entry *parked_at(size_t slot) noexcept
+        {
+            return parked_.test(slot) ? MemoryUtils::cast<Entry>(storage_.slot_memory(slot)) : nullptr;
+        }
+
+        /**
+         * Release the entry in ``slot``: park it while under the recycle limit
+         * and its graph is stopped, else destroy it.
+         */
+        void park_at(size_t slot) noexcept
+        {
+            Entry *entry = entry_at(slot);
+            if (entry == nullptr) { return; }
+            if (parked_count_ >= recycle_limit_ || slot >= parked_.size() || !entry->graph.clear_nodes())
+            {
+                destroy_at(slot);
+                return;
+            }
+            parked_.set(slot);
+            ++parked_count_;
         }
 
         [[nodiscard]] Entry *entry_at(size_t slot) noexcept
@@ -133,6 +183,7 @@ namespace hgraph
         template <typename... Args>
         Entry &construct_at(size_t slot, Args &&...args)
         {
+            destroy_parked_at(slot);
             require_available_slot(slot);
             Entry *entry = MemoryUtils::cast<Entry>(storage_.slot_memory(slot));
             std::construct_at(entry, std::forward<Args>(args)...);
@@ -140,8 +191,32 @@ namespace hgraph
             return *entry;
         }
 
+        /**
+         * Construct a new entry in ``slot``. When an entry is parked there,
+         * its graph is rebuilt through ``builder.reset_nested_graph`` and moved
+         * into the new entry's ``graph`` member, and the parked entry itself is
+         * destroyed. Otherwise the new entry's graph is left empty.
+         */
+        template <typename Builder, typename... Args>
+        Entry &recycle_at(size_t slot, const Builder &builder, Args &&...args)
+        {
+            Entry *parked = parked_at(slot);
+            if (parked == nullptr || !parked->graph.has_value())
+            {
+                return construct_at(slot, std::forward<Args>(args)...);
+            }
+            builder.reset_nested_graph(parked->graph);
+            auto graph = std::move(parked->graph);
+            destroy_parked_at(slot);
+            Entry &entry = construct_at(slot, std::forward<Args>(args)...);
+            entry.graph = std::move(graph);
+            ++recycled_;
+            return entry;
+        }
+
         void destroy_at(size_t slot) noexcept
         {
+            destroy_parked_at(slot);
             Entry *entry = entry_at(slot);
             if (entry == nullptr) { return; }
             std::destroy_at(entry);
@@ -214,6 +289,28 @@ namespace hgraph
         MemoryUtils::StorageLayout    slot_layout_{};
         size_t                        graph_offset_{0};
         bool                          bound_{false};
+        SlotBitmap                    parked_{};
+        size_t                        parked_count_{0};
+        size_t                        recycle_limit_{0};
+        size_t                        recycled_{0};
+
+        void destroy_parked_at(size_t slot) noexcept
+        {
+            if (!parked_.test(slot)) { return; }
+            parked_.reset(slot);
+            --parked_count_;
+            std::destroy_at(MemoryUtils::cast<Entry>(storage_.slot_memory(slot)));
+            storage_.mark_free(slot);
+        }
+
+        [[nodiscard]] size_t first_parked() const noexcept
+        {
+            for (size_t slot = 0; slot < parked_.size(); ++slot)
+            {
+                if (parked_.test(slot)) { return slot; }
+            }
+            return parked_.size();
+        }
 
         [[nodiscard]] static size_t checked_align_to(size_t offset, size_t alignment)
         {
@@ -40,7 +40,7 @@ namespace hgraph
     class GraphBuilder;
     class NodeBuilder;
     class NodeValue;
-    struct NodeSchedulerState;
+    class NodeSchedulerState;
     struct ResolutionMap;  // type_resolution.h — generic-node wiring resolution
 
     /** Runtime node category used by graph construction and evaluation. */
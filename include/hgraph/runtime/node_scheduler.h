@@ -7,31 +7,95 @@
 #include <hgraph/util/date_time.h>
 
 #include <algorithm>
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
-#include <set>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <utility>
+#include <vector>
 
 namespace hgraph
 {
     /**
      * Persistent per-node scheduler **state** — the small footprint stored on a
-     * node that declares a ``NodeScheduler``. It holds the set of pending
-     * ``(time, tag)`` events (ordered by time then tag) and the ``tag -> time``
-     * index used to replace/cancel tagged schedules. A node that never schedules
+     * node that declares a ``NodeScheduler``. It holds the pending ``(time,
+     * tag)`` events, ordered by time then tag name, with at most one event per
+     * tag and at most one untagged event per time. A node that never schedules
      * stores nothing (the slot exists only when ``uses_scheduler`` is set).
      *
+     * Storage is flat and reused. Events sit in one vector sorted latest-first,
+     * so the next event pops from the back. Each tag name is interned once into
+     * a slot that outlives its event, so re-arming a throttle or heartbeat tag
+     * is a lookup and a move within the vector. Once the vectors have grown to
+     * the node's peak, scheduling and cancelling do not allocate. An idle slot
+     * is recycled for a new name, which bounds the slots to the peak number of
+     * concurrently pending tags.
+     *
      * Behaviour lives on the :cpp:class:`NodeScheduler` view, constructed on
      * demand when the scheduler is injected — the value/view split keeps the node
      * memory minimal and the graph/node-index/now context out of storage.
      */
-    struct HGRAPH_EXPORT NodeSchedulerState
+    class HGRAPH_EXPORT NodeSchedulerState
     {
-        std::set<std::pair<DateTime, std::string>> events{};
-        std::map<std::string, DateTime>            tags{};
+      public:
+        [[nodiscard]] bool empty() const noexcept { return events_.empty(); }
+        [[nodiscard]] std::size_t size() const noexcept { return events_.size(); }
+
+        /** Earliest pending time; ``MIN_DT`` when empty. */
+        [[nodiscard]] DateTime next_time() const noexcept
+        {
+            return events_.empty() ? MIN_DT : events_.back().when;
+        }
+
+        /** Time pending under ``tag``, if any. */
+        [[nodiscard]] std::optional<DateTime> tag_time(std::string_view tag) const noexcept;
+
+        /** Add an event; an empty ``tag`` is untagged. A tagged event replaces
+            the tag's pending one. */
+        void schedule(DateTime when, std::string_view tag);
+
+        /** Remove ``tag``'s pending event and return its time. */
+        std::optional<DateTime> cancel(std::string_view tag) noexcept;
+
+        /** Remove the earliest event; no-op when empty. */
+        void cancel_next() noexcept;
+
+        /** Remove every event whose time is at or before ``until``. */
+        void consume_until(DateTime until) noexcept;
+
+        /** Remove every event; interned tag slots are kept for reuse. */
+        void clear() noexcept;
+
+      private:
+        static constexpr std::uint32_t untagged = UINT32_MAX;
+
+        struct Event
+        {
+            DateTime      when;
+            std::uint32_t tag;
+        };
+
+        struct TagSlot
+        {
+            std::string name{};
+            DateTime    when{MIN_DT};
+            bool        pending{false};
+        };
+
+        [[nodiscard]] bool orders_after(const Event &lhs, const Event &rhs) const noexcept;
+        [[nodiscard]] std::vector<Event>::iterator find_event(const Event &event) noexcept;
+        [[nodiscard]] std::uint32_t find_tag(std::string_view tag) const noexcept;
+        [[nodiscard]] std::uint32_t intern_tag(std::string_view tag);
+        void release(std::uint32_t tag) noexcept;
+
+        /** Pending events, latest first. */
+        std::vector<Event>         events_{};
+        /** Interned tags, addressed by the id an event carries. */
+        std::vector<TagSlot>       tags_{};
+        /** Tag ids sorted by name. */
+        std::vector<std::uint32_t> tags_by_name_{};
+        std::size_t                idle_tags_{0};
     };
 
     /**
@@ -119,13 +183,13 @@ namespace hgraph
         /** Earliest pending time, or ``MIN_DT`` when nothing is scheduled. */
         [[nodiscard]] DateTime next_scheduled_time() const noexcept
         {
-            return (state_ != nullptr && !state_->events.empty()) ? state_->events.begin()->first : MIN_DT;
+            return state_ != nullptr ? state_->next_time() : MIN_DT;
         }
 
         /** Whether any events are pending. */
         [[nodiscard]] bool is_scheduled() const noexcept
         {
-            return state_ != nullptr && !state_->events.empty();
+            return state_ != nullptr && !state_->empty();
         }
 
         /**
@@ -137,36 +201,33 @@ namespace hgraph
          */
         [[nodiscard]] bool is_scheduled_now() const noexcept
         {
-            return state_ != nullptr && !state_->events.empty() && state_->events.begin()->first == now_;
+            return state_ != nullptr && !state_->empty() && state_->next_time() == now_;
         }
 
         /** Whether a schedule is registered under ``tag``. */
         [[nodiscard]] bool has_tag(std::string_view tag) const
         {
-            return state_ != nullptr && state_->tags.contains(std::string{tag});
+            return state_ != nullptr && state_->tag_time(tag).has_value();
         }
 
         /** Time registered under ``tag``, or ``default_time`` when absent. */
         [[nodiscard]] DateTime tag_time(std::string_view tag, DateTime default_time = MIN_DT) const
         {
             if (state_ == nullptr) { return default_time; }
-            const auto it = state_->tags.find(std::string{tag});
-            return it != state_->tags.end() ? it->second : default_time;
+            return state_->tag_time(tag).value_or(default_time);
         }
 
         /** Whether ``tag``'s schedule is due in the current cycle. */
-        [[nodiscard]] bool tag_is_scheduled_now(std::string_view tag) const { return has_tag(tag) && tag_time(tag) == now_; }
+        [[nodiscard]] bool tag_is_scheduled_now(std::string_view tag) const
+        {
+            return state_ != nullptr && state_->tag_time(tag) == now_;
+        }
 
         /** Remove ``tag``'s event and return its time, or ``default_time`` when absent. */
         DateTime pop_tag(std::string_view tag, DateTime default_time = MIN_DT) const
         {
             require_state("pop_tag");
-            const auto it = state_->tags.find(std::string{tag});
-            if (it == state_->tags.end()) { return default_time; }
-            const DateTime when = it->second;
-            state_->events.erase({when, it->first});
-            state_->tags.erase(it);
-            return when;
+            return state_->cancel(tag).value_or(default_time);
         }
 
         /**
@@ -180,7 +241,7 @@ namespace hgraph
          * Python guard for started nodes, while preserving the start-cycle
          * ``schedule(now())`` source pattern before the node has started.
          */
-        void schedule(DateTime when, std::optional<std::string> tag = std::nullopt,
+        void schedule(DateTime when, std::optional<std::string_view> tag = std::nullopt,
                       bool on_wall_clock = false) const
         {
             require_state("schedule");
@@ -207,59 +268,39 @@ namespace hgraph
                 when = reference_now;
             }
 
-            const bool        tagged    = tag.has_value() && !tag->empty();
-            const std::string tag_value = tagged ? *tag : std::string{};
-
-            if (tagged)
-            {
-                if (const auto it = state_->tags.find(tag_value); it != state_->tags.end())
-                {
-                    state_->events.erase({it->second, tag_value});  // replace existing tagged event
-                }
-            }
-
-            const DateTime prev_first = state_->events.empty() ? MAX_DT : state_->events.begin()->first;
-            if (tagged) { state_->tags[tag_value] = when; }  // only tagged events are indexed
-            state_->events.insert({when, tag_value});
-            const DateTime next = state_->events.begin()->first;
+            const DateTime prev_first = state_->empty() ? MAX_DT : state_->next_time();
+            state_->schedule(when, tag.value_or(std::string_view{}));
+            const DateTime next = state_->next_time();
             if (graph_ != nullptr && next < prev_first) { graph_->schedule_node(node_index_, next); }
         }
 
         /** Schedule the node ``delta`` after the current evaluation time. */
-        void schedule(TimeDelta delta, std::optional<std::string> tag = std::nullopt,
+        void schedule(TimeDelta delta, std::optional<std::string_view> tag = std::nullopt,
                       bool on_wall_clock = false) const
         {
             require_state("schedule");
-            schedule(scheduling_reference_time(on_wall_clock) + delta, std::move(tag), on_wall_clock);
+            schedule(scheduling_reference_time(on_wall_clock) + delta, tag, on_wall_clock);
         }
 
         /** Cancel the event registered under ``tag`` (no-op if absent). */
-        void un_schedule(const std::string &tag) const
+        void un_schedule(std::string_view tag) const
         {
             require_state("un_schedule");
-            if (const auto it = state_->tags.find(tag); it != state_->tags.end())
-            {
-                state_->events.erase({it->second, it->first});
-                state_->tags.erase(it);
-            }
+            static_cast<void>(state_->cancel(tag));
         }
 
         /** Cancel the next (earliest) pending event. */
         void un_schedule() const
         {
             require_state("un_schedule");
-            if (state_->events.empty()) { return; }
-            const auto ev = *state_->events.begin();
-            state_->events.erase(state_->events.begin());
-            state_->tags.erase(ev.second);
+            state_->cancel_next();
         }
 
         /** Remove all pending events. */
         void reset() const
         {
             require_state("reset");
-            state_->events.clear();
-            state_->tags.clear();
+            state_->clear();
         }
 
         /**
@@ -273,15 +314,10 @@ namespace hgraph
         void advance() const
         {
             if (state_ == nullptr) { return; }
-            while (!state_->events.empty() && state_->events.begin()->first <= now_)
-            {
-                const std::string &tag = state_->events.begin()->second;
-                if (!tag.empty()) { state_->tags.erase(tag); }  // only tagged events are indexed
-                state_->events.erase(state_->events.begin());
-            }
-            if (graph_ != nullptr && !state_->events.empty())
+            state_->consume_until(now_);
+            if (graph_ != nullptr && !state_->empty())
             {
-                graph_->schedule_node(node_index_, state_->events.begin()->first);
+                graph_->schedule_node(node_index_, state_->next_time());
             }
         }
 
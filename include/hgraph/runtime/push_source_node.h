@@ -172,6 +172,24 @@ namespace hgraph
     [[nodiscard]] HGRAPH_EXPORT PushSourcePolicy make_push_source_conflating_policy(
         const TSValueTypeMetaData &output_schema);
 
+    /**
+     * Queue and burst policies backed by a bounded lock-free ring rather than
+     * a mutex-guarded deque, for sources fed by many producer threads.
+     *
+     * ``capacity`` Value slots (rounded up to a power of two, at least two)
+     * are allocated
+     * when the node starts and reused for every send, so admission costs one
+     * compare-and-swap and no allocation. Delivery order and the
+     * ``try_send`` / ``send_blocking`` contract match the mutex policies. A
+     * producer blocked on a full ring sleeps until the graph thread frees a
+     * slot. ``capacity`` must be non-zero: the ring is always bounded.
+     */
+    [[nodiscard]] HGRAPH_EXPORT PushSourcePolicy make_push_source_ring_queue_policy(
+        const TSValueTypeMetaData &output_schema, std::size_t capacity);
+
+    [[nodiscard]] HGRAPH_EXPORT PushSourcePolicy make_push_source_ring_burst_policy(
+        const TSValueTypeMetaData &output_schema, std::size_t capacity);
+
     /**
      * Build a root push-source node for ``output_schema``.
      *
@@ -31,6 +31,13 @@ namespace hgraph
          * same graph leave identical deltas here.
          */
         std::uint64_t type_system_lock_acquisitions{0};
+        /** Call signatures the operator registry currently remembers a
+            selection for (see hgraph::OperatorRegistry::resolve). */
+        std::size_t operator_resolution_cache_entries{0};
+        /** Process-lifetime cacheable resolutions served from, and missing,
+            that cache. Repeating an equivalent wiring moves only the hits. */
+        std::uint64_t operator_resolution_cache_hits{0};
+        std::uint64_t operator_resolution_cache_misses{0};
 
         [[nodiscard]] constexpr bool operator==(
             const RuntimeRegistrySnapshot &) const noexcept = default;
@@ -0,0 +1,114 @@
+#ifndef HGRAPH_RUNTIME_SWEEP_RUNNER_H
+#define HGRAPH_RUNTIME_SWEEP_RUNNER_H
+
+#include <hgraph/runtime/executor.h>
+#include <hgraph/runtime/global_state.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hgraph
+{
+    namespace runtime_detail
+    {
+        class EvaluationThreadPool;
+    }
+
+    /** One run of a parameter sweep. */
+    struct HGRAPH_EXPORT SweepRun
+    {
+        /** Replaces the builder's start time when set. */
+        std::optional<DateTime> start_time{};
+        /** Replaces the builder's end time when set. */
+        std::optional<DateTime> end_time{};
+        /**
+         * Entries set over the wiring-time global state before the run
+         * starts: the run's scalar overrides. Nodes that read their
+         * parameters from ``GlobalStateView`` see these values.
+         */
+        std::vector<std::pair<std::string, Value>> global_state{};
+    };
+
+    /** Outcome of one sweep run, at the index of its ``SweepRun``. */
+    struct HGRAPH_EXPORT SweepResult
+    {
+        /** The run's global state as it stood when the run returned. */
+        GlobalState global_state{};
+        /** What the collector returned; empty without a collector. */
+        Value value{};
+        /** The run's failure, or null when it completed. */
+        std::exception_ptr error{};
+
+        [[nodiscard]] bool ok() const noexcept { return error == nullptr; }
+    };
+
+    /**
+     * Reads a result from a finished run on the thread that ran it, before
+     * its executor is destroyed. Called only for runs that completed.
+     */
+    using SweepCollector = std::function<Value(std::size_t run, const GraphExecutorView &executor)>;
+
+    /**
+     * Runs one wired simulation many times, concurrently.
+     *
+     * The runner keeps a single ``GraphExecutorBuilder`` and compiles its
+     * graph and executor type records once, when it is constructed. Each run
+     * gets its own ``GraphExecutorValue`` made from that builder, with its
+     * own start and end times and its own copy of the global state. Runs are
+     * shared out over a bounded pool of ``threads`` participants (the calling
+     * thread and ``threads - 1`` workers). At most that many executors are
+     * alive at once, and each is destroyed as soon as its result is read.
+     *
+     * Runs are isolated from each other as distinct executors are. Native
+     * callbacks shared through the builder must not keep mutable state of
+     * their own, as several runs execute them at once. Executors are
+     * constructed one at a time; only the runs overlap.
+     *
+     * A run evaluates its graph sequentially: the builder's
+     * ``parallel_evaluation`` setting is cleared, as parallelism comes from
+     * the runs. Each run's thread acts as that executor's run thread, so
+     * nested graphs schedule and reconcile as they do in a standalone run.
+     * A run that throws records its error in its ``SweepResult``
+     * and the other runs continue.
+     */
+    class HGRAPH_EXPORT SweepRunner
+    {
+      public:
+        /**
+         * ``builder`` must be in simulation mode. ``threads`` of ``0``
+         * selects the hardware concurrency.
+         */
+        explicit SweepRunner(GraphExecutorBuilder builder, std::size_t threads = 0);
+        ~SweepRunner();
+
+        SweepRunner(const SweepRunner &)            = delete;
+        SweepRunner &operator=(const SweepRunner &) = delete;
+        SweepRunner(SweepRunner &&)                 = delete;
+        SweepRunner &operator=(SweepRunner &&)      = delete;
+
+        [[nodiscard]] const GraphExecutorBuilder &builder() const noexcept { return builder_; }
+        /** Participants running sweeps, including the calling thread. */
+        [[nodiscard]] std::size_t threads() const noexcept;
+
+        /**
+         * Execute every run and wait for all of them. The result at index
+         * ``i`` belongs to ``runs[i]``. Drive a runner from one thread at a
+         * time.
+         */
+        [[nodiscard]] std::vector<SweepResult> run(std::span<const SweepRun> runs,
+                                                   const SweepCollector &collect = {});
+
+      private:
+        GraphExecutorBuilder                                   builder_;
+        std::unique_ptr<runtime_detail::EvaluationThreadPool> pool_;
+    };
+}  // namespace hgraph
+
+#endif  // HGRAPH_RUNTIME_SWEEP_RUNNER_H
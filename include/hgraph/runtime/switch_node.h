@@ -35,6 +35,16 @@ namespace hgraph
          * instead of re-homing that terminal onto switch-owned storage.
          */
         bool output_forwards_to_child_terminal{false};
+        /**
+         * Number of stopped branch graphs kept constructed, least recently
+         * used evicted first. Switching back to a kept branch restarts its
+         * graph instead of building a new one: node state and output values
+         * carry over from when it was stopped, and the boundary is rebound and
+         * sampled as for a new branch. Each kept graph occupies its own fixed
+         * slot in the node's storage. ``0`` (the default) builds every branch
+         * afresh.
+         */
+        std::size_t warm_branches{0};
     };
 
     /**
@@ -51,8 +61,17 @@ namespace hgraph
         [[nodiscard]] bool            has_active_branch() const noexcept;
         [[nodiscard]] GraphValue     &active_graph_value() const noexcept;
         [[nodiscard]] const Value    &active_key() const noexcept;
-        /** Number of constructed active/previous branch graphs in the two fixed slots. */
+        /** Number of constructed branch graphs: active, previous and warm. */
         [[nodiscard]] std::size_t     stored_graph_count() const noexcept;
+        /** Stopped branch graphs kept for restart, and the bound on them. */
+        [[nodiscard]] std::size_t     warm_graph_count() const noexcept;
+        [[nodiscard]] std::size_t     warm_graph_capacity() const noexcept;
+        /** Bytes held by the warm graphs: their graph storage, in place or
+            not, and their nodes' dynamic storage. ``storage_metrics`` reports
+            the part outside the node's static bytes as dynamic bytes. */
+        [[nodiscard]] std::size_t     warm_graph_bytes() const noexcept;
+        /** Branch activations served by restarting a warm graph. */
+        [[nodiscard]] std::size_t     warm_restart_count() const noexcept;
         /** True when every constructed branch graph resides in its fixed node-storage slot. */
         [[nodiscard]] bool            child_graphs_use_in_place_storage() const noexcept;
 
@@ -74,7 +93,9 @@ namespace hgraph
      * tick with ``reload_on_ticked``) the inactive slot is reused for the new
      * branch and the old active child is stopped. That stopped child remains in
      * the previous slot until the following switch, when its destructor runs
-     * before the slot is reused. The switch node normally owns one fixed output
+     * before the slot is reused. With ``warm_branches`` the node has that many
+     * more slots, and stopped children stay there for restart instead (see
+     * ``SwitchNodeSpec::warm_branches``). The switch node normally owns one fixed output
      * and branches write into it directly. If a branch terminal already owns a
      * forwarding or structural endpoint, the switch preserves that topology and
      * its output forwards to the active terminal instead. A VALUE branch under a
@@ -17,11 +17,13 @@
 #include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
@@ -393,6 +395,16 @@ namespace hgraph
         using OperatorResolutionError::OperatorResolutionError;
     };
 
+    /** Counters of the registry's overload-resolution cache. ``hits`` and
+        ``misses`` count cacheable ``resolve`` calls for the process lifetime;
+        ``entries`` is the current cache population. */
+    struct OperatorResolutionCacheStats
+    {
+        std::size_t   entries{0};
+        std::uint64_t hits{0};
+        std::uint64_t misses{0};
+    };
+
     /**
      * Process-wide registry of operator overloads (singleton). Wiring is
      * single-threaded, so this registry itself takes no locks; build-time
@@ -445,7 +457,24 @@ namespace hgraph
         /** Apply every installer not applied since the last reset. */
         void run_installers();
 
-        /** Select the unique best candidate, with the normalised call it accepted. */
+        /**
+         * Select the unique best candidate, with the normalised call it accepted.
+         *
+         * Selections are memoised on the call's canonical signature: operator
+         * name, per-argument kind, keyword name, time-series schema or scalar
+         * schema and value, plus the output constraint and size hints. A hit
+         * re-normalises and re-matches only the remembered winner, so its
+         * resolution map, defaults and ``requires_`` check are always fresh;
+         * should the winner no longer match, the call resolves in full.
+         *
+         * A selection is remembered only when every rejected candidate failed
+         * on its signature alone. Rejections by a default-type resolver or a
+         * ``requires_`` predicate may depend on wiring state outside the key,
+         * so such calls always resolve in full, as do calls with an initial
+         * resolution, a packed variadic tail, an unhashable scalar, or wiring
+         * observers attached. ``register_overload`` and ``reset`` empty the
+         * cache.
+         */
         [[nodiscard]] ResolvedOperatorCall resolve(
             std::string_view name,
             std::span<const WiringArg> args,
@@ -489,6 +518,8 @@ namespace hgraph
                                            const TSValueTypeMetaData *expected_output = nullptr,
                                            GlobalStateView global_state = {}) const;
 
+        [[nodiscard]] OperatorResolutionCacheStats resolution_cache_stats() const noexcept;
+
         /** Every registered operator name (sorted) — discovery for the Python bridge. */
         [[nodiscard]] std::vector<std::string> registered_names() const;
 
@@ -555,7 +586,64 @@ namespace hgraph
             bool                  running{false};
         };
 
+        /** One argument of a remembered call signature. */
+        struct ResolutionKeyArg
+        {
+            WiringArg::Kind            kind{WiringArg::Kind::TimeSeries};
+            std::string                name{};
+            const TSValueTypeMetaData *ts_schema{nullptr};
+            const ValueTypeMetaData   *scalar_meta{nullptr};
+            Value                      scalar_value{};
+        };
+
+        struct ResolutionKey
+        {
+            std::string                   name{};
+            std::vector<ResolutionKeyArg> args{};
+            std::vector<std::size_t>      size_hints{};
+            const TSValueTypeMetaData    *expected_output{nullptr};
+            std::optional<bool>           output_required{};
+            std::size_t                   hash{0};
+        };
+
+        /** A ``resolve`` call viewed as a key, for lookups that copy nothing. */
+        struct ResolutionCall
+        {
+            std::string_view             name{};
+            std::span<const WiringArg>   args{};
+            std::span<const std::size_t> size_hints{};
+            const TSValueTypeMetaData   *expected_output{nullptr};
+            std::optional<bool>          output_required{};
+            std::size_t                  hash{0};
+        };
+
+        struct ResolutionKeyHash
+        {
+            using is_transparent = void;
+            [[nodiscard]] std::size_t operator()(const ResolutionKey &key) const noexcept { return key.hash; }
+            [[nodiscard]] std::size_t operator()(const ResolutionCall &call) const noexcept { return call.hash; }
+        };
+
+        struct ResolutionKeyEqual
+        {
+            using is_transparent = void;
+            [[nodiscard]] bool operator()(const ResolutionKey &lhs, const ResolutionKey &rhs) const;
+            [[nodiscard]] bool operator()(const ResolutionCall &lhs, const ResolutionKey &rhs) const;
+            [[nodiscard]] bool operator()(const ResolutionKey &lhs, const ResolutionCall &rhs) const
+            {
+                return (*this)(rhs, lhs);
+            }
+        };
+
+        /** Bound on remembered signatures; the cache empties when it is reached. */
+        static constexpr std::size_t max_resolution_cache_entries = 1U << 16U;
+
         std::unordered_map<std::string, std::vector<OperatorImpl>> overloads_{};
+        /** Signature -> index of the winner in ``overloads_[name]``. */
+        mutable std::unordered_map<ResolutionKey, std::size_t, ResolutionKeyHash, ResolutionKeyEqual>
+                                                                   resolution_cache_{};
+        mutable std::uint64_t                                      resolution_cache_hits_{0};
+        mutable std::uint64_t                                      resolution_cache_misses_{0};
         std::vector<MeshScope>                                     mesh_scopes_{};
         std::vector<ContextScopeEntry>                             context_scopes_{};
         std::vector<Installer>                                     installers_{};
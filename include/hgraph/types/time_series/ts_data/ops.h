@@ -115,6 +115,7 @@ namespace hgraph
         [[nodiscard]] HGRAPH_EXPORT bool missing_window_full(const void *, const void *);
         HGRAPH_EXPORT void missing_window_push(const void *, void *, const ValueView &, DateTime);
         HGRAPH_EXPORT void missing_window_clear(const void *, void *, DateTime);
+        [[nodiscard]] HGRAPH_EXPORT TSWSegments missing_window_segments(const void *, const void *);
 
         [[nodiscard]] Value empty_delta_atomic(const TSRoleTypeRef &binding);
         [[nodiscard]] Value empty_delta_tss(const TSRoleTypeRef &binding);
@@ -474,6 +475,10 @@ namespace hgraph
                           DateTime modified_time) = &ts_data_detail::missing_window_push;
         void (*clear_impl)(const void *context, void *memory,
                            DateTime modified_time) = &ts_data_detail::missing_window_clear;
+        // The occupied slots as at most two contiguous runs, so numeric
+        // reductions can stream the ring without a view per element.
+        TSWSegments (*segments_impl)(const void *context,
+                                     const void *memory) = &ts_data_detail::missing_window_segments;
         // Optional capabilities: null means the strategy does not track the
         // fact, and the window views degrade gracefully (no cleared/evicted
         // reporting). Same null-slot idiom as ValueOps optional hooks.
@@ -12,6 +12,7 @@
 #include <hgraph/util/tagged_ptr.h>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -205,6 +206,31 @@ namespace hgraph
     static_assert(sizeof(TSParentLink) <= sizeof(void *) * 3,
                   "TSParentLink should remain a compact three-word navigation handle");
 
+    /**
+     * Serialises TSData notification on the threads of a concurrent keyed
+     * child evaluation (``map_`` under ``GraphExecutorBuilder::
+     * parallel_evaluation``). Sibling child graphs write elements of one
+     * shared parent output, so while a scope is installed on a thread every
+     * observer notification, parent bubble-up and observer-set change it
+     * starts runs under ``mutex``. The lock is taken by the outermost such
+     * operation only; callbacks re-entered beneath it do not lock again.
+     */
+    class HGRAPH_EXPORT TSNotificationLockScope
+    {
+      public:
+        explicit TSNotificationLockScope(std::mutex &mutex) noexcept;
+        ~TSNotificationLockScope() noexcept;
+
+        TSNotificationLockScope(const TSNotificationLockScope &)            = delete;
+        TSNotificationLockScope &operator=(const TSNotificationLockScope &) = delete;
+
+        /** True when this thread must take the lock before notifying. */
+        [[nodiscard]] static bool active() noexcept;
+
+      private:
+        std::mutex *previous_{nullptr};
+    };
+
     /**
      * Compact per-level observer set for TSData modification notifications.
      *
@@ -254,6 +280,11 @@ namespace hgraph
         void notify(DateTime modified_time) const
         {
             if (!observers_) { return; }
+            if (TSNotificationLockScope::active()) [[unlikely]]
+            {
+                notify_locked(modified_time);
+                return;
+            }
             if (auto *entry = observers_.get<Notifiable>(); entry != nullptr)
             {
                 entry->notify(modified_time);
@@ -283,6 +314,7 @@ namespace hgraph
         void set_many(ObserverList *observers) noexcept;
         void compact_many(ObserverList &observers) noexcept;
         void notify_many(DateTime modified_time) const;
+        void notify_locked(DateTime modified_time) const;
 
         ObserverStorage observers_{};
     };
@@ -443,6 +475,21 @@ namespace hgraph
         TimeDelta     time_range{};
         TimeDelta     min_time_range{};
     };
+
+    /**
+     * The occupied slots of a window as at most two contiguous runs, oldest
+     * first. Run 0 starts at the oldest element; run 1, when non-empty, is
+     * the part that wrapped to the start of the ring. Elements are
+     * ``value_stride`` bytes apart and times are packed ``DateTime``. The
+     * pointers borrow the window's storage until its next mutation.
+     */
+    struct TSWSegments
+    {
+        const std::byte *values[2]{nullptr, nullptr};
+        const DateTime  *times[2]{nullptr, nullptr};
+        std::size_t      sizes[2]{0, 0};
+        std::size_t      value_stride{0};
+    };
 }  // namespace hgraph
 
 #endif  // HGRAPH_CPP_TS_DATA_TYPES_H
@@ -4,7 +4,10 @@
 #include <hgraph/types/time_series/ts_data/base_view.h>
 #include <hgraph/types/value/value_range.h>
 #include <hgraph/util/date_time.h>
+#include <array>
 #include <cstddef>
+#include <span>
+#include <stdexcept>
 
 namespace hgraph
 {
@@ -82,6 +85,27 @@ namespace hgraph
         [[nodiscard]] Range<ValueView>::iterator begin() const;
         [[nodiscard]] Range<ValueView>::iterator end() const;
 
+        /** The occupied slots as at most two contiguous runs, oldest first.
+            Borrowed until the window is next mutated. */
+        [[nodiscard]] TSWSegments segments() const;
+
+        /** Typed spans over the element runs. ``T`` must be the window's
+            element type; node selection checks the schema, this only checks
+            that the storage stride matches. */
+        template <typename T> [[nodiscard]] std::array<std::span<const T>, 2> value_spans() const
+        {
+            const TSWSegments runs = segments();
+            if (runs.value_stride != sizeof(T))
+            {
+                throw std::logic_error("TSWDataView::value_spans: element stride does not match the requested type");
+            }
+            return {std::span<const T>{reinterpret_cast<const T *>(runs.values[0]), runs.sizes[0]},
+                    std::span<const T>{reinterpret_cast<const T *>(runs.values[1]), runs.sizes[1]}};
+        }
+
+        /** Spans over the element times, oldest first. */
+        [[nodiscard]] std::array<std::span<const DateTime>, 2> time_spans() const;
+
         /** Begin a mutation view over this window. */
         [[nodiscard]] TSWDataMutationView begin_mutation(DateTime evaluation_time) const;
 
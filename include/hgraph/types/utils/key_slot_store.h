@@ -1,7 +1,9 @@
 #ifndef HGRAPH_CPP_ROOT_V2_KEY_SLOT_STORE_H
 #define HGRAPH_CPP_ROOT_V2_KEY_SLOT_STORE_H
 
+#include <hgraph/util/date_time.h>
 #include <hgraph/util/scope.h>
+#include <hgraph/types/primitive_types.h>
 #include <hgraph/types/utils/slot_observer.h>
 #include <hgraph/types/utils/stable_slot_store.h>
 #include <hgraph/types/value/value_view.h>
@@ -10,6 +12,7 @@
 #include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <span>
@@ -90,6 +93,79 @@ namespace hgraph
         };
     }
 
+    /**
+     * Key types whose hash and equality a ``KeySlotStore`` calls inline
+     * rather than through its ``KeySlotStoreOps``. Selected once, when the
+     * store is bound; ``Erased`` keeps the function-pointer path.
+     */
+    enum class KeySlotKeyKind : std::uint8_t
+    {
+        Erased,
+        Int,
+        Float,
+        Str,
+        Bytes,
+        Date,
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        [[nodiscard]] bool key_ops_are(const KeySlotStoreOps &ops) noexcept {
+            return ops.hash == &typed_key_hash<T> && ops.equal == &typed_key_equal<T>;
+        }
+
+        /** The inline kind for ops built by ``key_slot_store_ops_for<T>()``. */
+        [[nodiscard]] inline KeySlotKeyKind key_slot_key_kind(const KeySlotStoreOps &ops) noexcept {
+            if (key_ops_are<Int>(ops)) { return KeySlotKeyKind::Int; }
+            if (key_ops_are<Float>(ops)) { return KeySlotKeyKind::Float; }
+            if (key_ops_are<Str>(ops)) { return KeySlotKeyKind::Str; }
+            if (key_ops_are<Bytes>(ops)) { return KeySlotKeyKind::Bytes; }
+            if (key_ops_are<Date>(ops)) { return KeySlotKeyKind::Date; }
+            return KeySlotKeyKind::Erased;
+        }
+
+        /** The inline kind for a binding whose ops are the canonical scalar ops. */
+        [[nodiscard]] inline KeySlotKeyKind key_slot_key_kind(const ValueOps *ops) noexcept {
+            if (ops == &ops_for<Int>()) { return KeySlotKeyKind::Int; }
+            if (ops == &ops_for<Float>()) { return KeySlotKeyKind::Float; }
+            if (ops == &ops_for<Str>()) { return KeySlotKeyKind::Str; }
+            if (ops == &ops_for<Bytes>()) { return KeySlotKeyKind::Bytes; }
+            if (ops == &ops_for<Date>()) { return KeySlotKeyKind::Date; }
+            return KeySlotKeyKind::Erased;
+        }
+
+        [[nodiscard]] inline size_t value_ops_key_hash(const void *key, const void *context) {
+            return static_cast<const ValueOps *>(context)->hash(key);
+        }
+
+        [[nodiscard]] inline bool value_ops_key_equal(const void *lhs, const void *rhs, const void *context) {
+            return static_cast<const ValueOps *>(context)->equals(lhs, rhs);
+        }
+    }  // namespace detail
+
+    /**
+     * Build ``KeySlotStoreOps`` for keys bound by ``binding``. The canonical
+     * scalar kinds of ``KeySlotKeyKind`` get their typed ops, which a store
+     * recognises and calls inline; any other binding forwards to its
+     * ``ValueOps``.
+     */
+    [[nodiscard]] inline KeySlotStoreOps key_slot_store_ops_for(const ValueTypeRef &binding) {
+        switch (detail::key_slot_key_kind(binding.ops())) {
+            case KeySlotKeyKind::Int: return key_slot_store_ops_for<Int>();
+            case KeySlotKeyKind::Float: return key_slot_store_ops_for<Float>();
+            case KeySlotKeyKind::Str: return key_slot_store_ops_for<Str>();
+            case KeySlotKeyKind::Bytes: return key_slot_store_ops_for<Bytes>();
+            case KeySlotKeyKind::Date: return key_slot_store_ops_for<Date>();
+            case KeySlotKeyKind::Erased: break;
+        }
+        return KeySlotStoreOps{
+            .hash    = &detail::value_ops_key_hash,
+            .equal   = &detail::value_ops_key_equal,
+            .context = &binding.ops_ref(),
+        };
+    }
+
     /**
      * Stable slot-backed key storage with delayed erase semantics.
      *
@@ -110,6 +186,11 @@ namespace hgraph
      * does not define mutation epochs; callers such as TSData decide when an
      * epoch rolls over.
      *
+     * Keys of the primitive kinds in ``KeySlotKeyKind`` hash and compare
+     * inline, without the ops indirection. ``Str`` and ``Bytes`` keys also
+     * keep their hash beside the slot, so index growth and erase never rehash
+     * the string.
+     *
      * Example:
      * ```c++
      * KeySlotStore store(MemoryUtils::plan_for<std::int32_t>(), key_slot_store_ops_for<std::int32_t>());
@@ -160,7 +241,8 @@ namespace hgraph
          */
         KeySlotStore(const MemoryUtils::StoragePlan &plan, KeySlotStoreOps ops,
                      const MemoryUtils::AllocatorOps &allocator = MemoryUtils::allocator())
-            : key_storage(plan.layout, allocator), m_key_plan(&plan), m_ops(ops) {
+            : key_storage(plan.layout, allocator), m_key_plan(&plan), m_ops(ops),
+              m_key_kind(detail::key_slot_key_kind(ops)) {
             validate_plan();
             validate_ops();
             rebuild_index();
@@ -168,17 +250,7 @@ namespace hgraph
 
         explicit KeySlotStore(ValueTypeRef binding,
                               const MemoryUtils::AllocatorOps &allocator = MemoryUtils::allocator())
-            : KeySlotStore(
-                  binding.checked_plan(),
-                  KeySlotStoreOps{
-                      .hash = [](const void *key, const void *context) {
-                          return static_cast<const ValueOps *>(context)->hash(key);
-                      },
-                      .equal = [](const void *lhs, const void *rhs, const void *context) {
-                          return static_cast<const ValueOps *>(context)->equals(lhs, rhs);
-                      },
-                      .context = &binding.ops_ref(),
-                  }, allocator) {
+            : KeySlotStore(binding.checked_plan(), key_slot_store_ops_for(binding), allocator) {
             m_value_binding = binding;
         }
 
@@ -197,8 +269,10 @@ namespace hgraph
               m_size(std::exchange(other.m_size, 0)),
               m_pending_erase_count(std::exchange(other.m_pending_erase_count, 0)),
               m_key_plan(std::exchange(other.m_key_plan, nullptr)), m_ops(other.m_ops),
+              m_key_kind(other.m_key_kind),
               m_value_binding(std::exchange(other.m_value_binding, {})),
               m_free_slots(std::move(other.m_free_slots)),
+              m_slot_hashes(std::move(other.m_slot_hashes)),
               m_pending_erase_slots(std::move(other.m_pending_erase_slots)),
               m_index_owner(std::move(other.m_index_owner)),
               m_index(std::move(other.m_index)) {
@@ -216,8 +290,10 @@ namespace hgraph
                 m_pending_erase_count = std::exchange(other.m_pending_erase_count, 0);
                 m_key_plan            = std::exchange(other.m_key_plan, nullptr);
                 m_ops                 = other.m_ops;
+                m_key_kind            = other.m_key_kind;
                 m_value_binding       = std::exchange(other.m_value_binding, {});
                 m_free_slots          = std::move(other.m_free_slots);
+                m_slot_hashes         = std::move(other.m_slot_hashes);
                 m_pending_erase_slots = std::move(other.m_pending_erase_slots);
                 // Destroy the current index while its allocation tracker is still alive.
                 m_index               = std::move(other.m_index);
@@ -241,6 +317,8 @@ namespace hgraph
         [[nodiscard]] const MemoryUtils::StoragePlan  *plan() const noexcept { return m_key_plan; }
         /** Allocator carried through to the underlying ``StableSlotStore``. */
         [[nodiscard]] const MemoryUtils::AllocatorOps &allocator() const noexcept { return key_storage.allocator(); }
+        /** Key kind hashed and compared inline; ``Erased`` when keys go through the ops. */
+        [[nodiscard]] KeySlotKeyKind                   key_kind() const noexcept { return m_key_kind; }
         /** True when at least one slot is awaiting physical erase. */
         [[nodiscard]] bool                             has_pending_erase() const noexcept { return m_pending_erase_count != 0; }
         /** Selected stable-slot index representation. */
@@ -263,6 +341,10 @@ namespace hgraph
             result += observers.dynamic_storage_metrics();
             result += vector_metrics(m_free_slots);
             result += vector_metrics(m_pending_erase_slots);
+            result += DynamicStorageMetrics{
+                .live_bytes     = caches_hashes() ? (m_size + m_pending_erase_count) * sizeof(size_t) : 0,
+                .reserved_bytes = m_slot_hashes.capacity() * sizeof(size_t),
+            };
 
             if (m_index_owner != nullptr)
             {
@@ -404,6 +486,7 @@ namespace hgraph
 
             const size_t old_capacity = slot_capacity();
             key_storage.reserve_to(capacity);
+            if (caches_hashes()) { m_slot_hashes.resize(capacity); }
             m_free_slots.reserve(m_free_slots.size() + capacity - old_capacity);
             m_index->reserve(capacity);
             for (size_t slot = capacity; slot > old_capacity; --slot) { m_free_slots.push_back(slot - 1); }
@@ -464,7 +547,7 @@ namespace hgraph
             key_storage.mark_staged(slot);
             auto rollback = rollback_new_slot(slot);
             rollback_free.release();
-            m_index->insert(slot);
+            index_slot(slot);
             static_cast<void>(key_storage.mark_live(slot));
             ++m_size;
             rollback.release();
@@ -491,7 +574,7 @@ namespace hgraph
             auto rollback = rollback_new_slot(slot);
             rollback_value.release();
             rollback_free.release();
-            m_index->insert(slot);
+            index_slot(slot);
             static_cast<void>(key_storage.mark_live(slot));
             ++m_size;
             rollback.release();
@@ -522,7 +605,7 @@ namespace hgraph
             key_storage.mark_staged(slot);
             auto rollback = rollback_new_slot(slot);
             rollback_free.release();
-            m_index->insert(slot);
+            index_slot(slot);
             static_cast<void>(key_storage.mark_live(slot));
             ++m_size;
             rollback.release();
@@ -675,10 +758,14 @@ namespace hgraph
 
             [[nodiscard]] size_t operator()(const void *key) const {
                 const KeySlotStore *s = store();
-                return s != nullptr ? mix(s->m_ops.hash_key(key)) : 0U;
+                return s != nullptr ? mix(s->hash_key(key)) : 0U;
             }
 
-            [[nodiscard]] size_t operator()(const ValueView &key) const { return mix(key.hash()); }
+            [[nodiscard]] size_t operator()(const ValueView &key) const {
+                const KeySlotStore *s = store();
+                if (s != nullptr && s->inline_view(key)) { return mix(s->hash_key(key.data())); }
+                return mix(key.hash());
+            }
         };
 
         struct IndexEqual
@@ -692,19 +779,23 @@ namespace hgraph
             [[nodiscard]] bool operator()(size_t lhs, size_t rhs) const {
                 if (lhs == rhs) { return true; }
                 const KeySlotStore *s = store();
-                return s != nullptr && s->m_ops.equal_keys(s->key_memory(lhs), s->key_memory(rhs));
+                if (s == nullptr) { return false; }
+                if (s->caches_hashes() && s->m_slot_hashes[lhs] != s->m_slot_hashes[rhs]) { return false; }
+                return s->equal_keys(s->key_memory(lhs), s->key_memory(rhs));
             }
 
             [[nodiscard]] bool operator()(size_t slot, const void *key) const {
                 const KeySlotStore *s = store();
-                return s != nullptr && s->m_ops.equal_keys(s->key_memory(slot), key);
+                return s != nullptr && s->equal_keys(s->key_memory(slot), key);
             }
 
             [[nodiscard]] bool operator()(const void *key, size_t slot) const { return (*this)(slot, key); }
 
             [[nodiscard]] bool operator()(size_t slot, const ValueView &key) const {
                 const KeySlotStore *s = store();
-                return s != nullptr && ValueView{s->m_value_binding, s->key_memory(slot)}.equals(key);
+                if (s == nullptr) { return false; }
+                if (s->inline_view(key)) { return s->equal_keys(s->key_memory(slot), key.data()); }
+                return ValueView{s->m_value_binding, s->key_memory(slot)}.equals(key);
             }
 
             [[nodiscard]] bool operator()(const ValueView &key, size_t slot) const { return (*this)(slot, key); }
@@ -721,7 +812,48 @@ namespace hgraph
             };
         }
 
-        [[nodiscard]] size_t hash_at_slot(size_t slot) const { return m_ops.hash_key(key_memory(slot)); }
+        [[nodiscard]] size_t hash_at_slot(size_t slot) const {
+            return caches_hashes() ? m_slot_hashes[slot] : hash_key(key_memory(slot));
+        }
+
+        [[nodiscard]] bool caches_hashes() const noexcept {
+            return m_key_kind == KeySlotKeyKind::Str || m_key_kind == KeySlotKeyKind::Bytes;
+        }
+
+        /** True when ``key`` holds this store's inline key type directly. */
+        [[nodiscard]] bool inline_view(const ValueView &key) const noexcept {
+            return m_key_kind != KeySlotKeyKind::Erased && key.binding().ops() == m_value_binding.ops();
+        }
+
+        [[nodiscard]] size_t hash_key(const void *key) const {
+            switch (m_key_kind) {
+                case KeySlotKeyKind::Int: return detail::typed_key_hash<Int>(key, nullptr);
+                case KeySlotKeyKind::Float: return detail::typed_key_hash<Float>(key, nullptr);
+                case KeySlotKeyKind::Str: return detail::typed_key_hash<Str>(key, nullptr);
+                case KeySlotKeyKind::Bytes: return detail::typed_key_hash<Bytes>(key, nullptr);
+                case KeySlotKeyKind::Date: return detail::typed_key_hash<Date>(key, nullptr);
+                case KeySlotKeyKind::Erased: break;
+            }
+            return m_ops.hash_key(key);
+        }
+
+        [[nodiscard]] bool equal_keys(const void *lhs, const void *rhs) const {
+            switch (m_key_kind) {
+                case KeySlotKeyKind::Int: return detail::typed_key_equal<Int>(lhs, rhs, nullptr);
+                case KeySlotKeyKind::Float: return detail::typed_key_equal<Float>(lhs, rhs, nullptr);
+                case KeySlotKeyKind::Str: return detail::typed_key_equal<Str>(lhs, rhs, nullptr);
+                case KeySlotKeyKind::Bytes: return detail::typed_key_equal<Bytes>(lhs, rhs, nullptr);
+                case KeySlotKeyKind::Date: return detail::typed_key_equal<Date>(lhs, rhs, nullptr);
+                case KeySlotKeyKind::Erased: break;
+            }
+            return m_ops.equal_keys(lhs, rhs);
+        }
+
+        /** Add a newly constructed slot to the index, caching its hash first when the kind keeps one. */
+        void index_slot(size_t slot) {
+            if (caches_hashes()) { m_slot_hashes[slot] = hash_key(key_storage.slot_memory(slot)); }
+            m_index->insert(slot);
+        }
 
         [[nodiscard]] const MemoryUtils::StoragePlan &require_bound_plan() const {
             if (m_key_plan == nullptr) { throw std::logic_error("KeySlotStore requires a bound storage plan"); }
@@ -786,8 +918,9 @@ namespace hgraph
             if (m_index_owner == nullptr) { m_index_owner = std::make_unique<IndexBackPtr>(); }
             m_index_owner->store = this;
             m_index = make_index();
+            if (caches_hashes()) { m_slot_hashes.resize(slot_capacity()); }
             for (size_t slot = 0; slot < slot_capacity(); ++slot) {
-                if (slot_constructed(slot)) { m_index->insert(slot); }
+                if (slot_constructed(slot)) { index_slot(slot); }
             }
         }
 
@@ -812,8 +945,11 @@ namespace hgraph
         size_t                          m_pending_erase_count{0};
         const MemoryUtils::StoragePlan *m_key_plan{nullptr};
         KeySlotStoreOps                 m_ops{};
+        KeySlotKeyKind                  m_key_kind{KeySlotKeyKind::Erased};
         ValueTypeRef                    m_value_binding{};
         std::vector<size_t>             m_free_slots{};
+        // Per-slot key hashes, kept only for Str and Bytes keys.
+        std::vector<size_t>             m_slot_hashes{};
         std::vector<size_t>             m_pending_erase_slots{};
         std::unique_ptr<IndexBackPtr>   m_index_owner{};
         std::unique_ptr<IndexSet>       m_index{};
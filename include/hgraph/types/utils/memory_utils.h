@@ -487,30 +487,34 @@ namespace hgraph
         /**
          * Type-erased ops table for raw heap allocation and deallocation.
          *
-         * Defaults to the runtime's aligned-new / aligned-delete pair.
-         * Custom allocators provide their own functions and may carry
-         * additional state by capturing it in the function pointers
-         * themselves.
+         * Defaults to the runtime's aligned-new / aligned-delete pair with no
+         * state. Custom allocators (for example ``StorageArena``) point
+         * ``context`` at their state; both hooks receive it as their last
+         * argument, mirroring ``LifecycleOps``. Owners retain the address of
+         * the ops table, so a stateful table must outlive every block it
+         * handed out.
          */
         struct AllocatorOps
         {
-            using allocate_fn   = void *(*)(StorageLayout);
-            using deallocate_fn = void (*)(void *, StorageLayout) noexcept;
+            using allocate_fn   = void *(*)(StorageLayout, void *context);
+            using deallocate_fn = void (*)(void *, StorageLayout, void *context) noexcept;
 
             /** Allocation hook. */
             allocate_fn   allocate{&MemoryUtils::default_allocate};
             /** Deallocation hook. */
             deallocate_fn deallocate{&MemoryUtils::default_deallocate};
+            /** Allocator state passed to both hooks; null for stateless allocators. */
+            void         *context{nullptr};
 
             /** Allocate a block matching ``layout``; throws if no hook is configured. */
             [[nodiscard]] void *allocate_storage(StorageLayout layout) const {
                 if (allocate == nullptr) { throw std::logic_error("MemoryUtils::AllocatorOps is missing an allocation hook"); }
-                return allocate(layout);
+                return allocate(layout, context);
             }
 
             /** Deallocate a block previously returned by ``allocate_storage``. */
             void deallocate_storage(void *memory, StorageLayout layout) const noexcept {
-                if (deallocate != nullptr && memory != nullptr) { deallocate(memory, layout); }
+                if (deallocate != nullptr && memory != nullptr) { deallocate(memory, layout, context); }
             }
         };
 
@@ -1600,12 +1604,12 @@ namespace hgraph
             return (offset + mask) & ~mask;
         }
 
-        [[nodiscard]] static void *default_allocate(StorageLayout layout) {
+        [[nodiscard]] static void *default_allocate(StorageLayout layout, void *) {
             if (!layout.valid()) { throw std::logic_error("MemoryUtils::AllocatorOps requires a valid layout"); }
             return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
         }
 
-        static void default_deallocate(void *memory, StorageLayout layout) noexcept {
+        static void default_deallocate(void *memory, StorageLayout layout, void *) noexcept {
             if (memory != nullptr && layout.valid()) { ::operator delete(memory, std::align_val_t{layout.alignment}); }
         }
 
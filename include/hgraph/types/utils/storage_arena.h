@@ -0,0 +1,85 @@
+#ifndef HGRAPH_TYPES_UTILS_STORAGE_ARENA_H
+#define HGRAPH_TYPES_UTILS_STORAGE_ARENA_H
+
+#include <hgraph/hgraph_export.h>
+#include <hgraph/types/storage_metrics.h>
+#include <hgraph/types/utils/memory_utils.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace hgraph
+{
+    /**
+     * Bump / slab arena exposed through a stateful ``MemoryUtils::AllocatorOps``.
+     *
+     * Small blocks are carved from large chunks with a bump pointer. A freed
+     * block goes onto a per-size-class free list and is handed back out to the
+     * next request of that class, so churn (keyed child graphs coming and
+     * going) reuses memory instead of growing the arena. Blocks larger than
+     * ``large_block_bytes()`` or aligned beyond ``max_slab_alignment`` bypass
+     * the arena and use the default allocator.
+     *
+     * Destroying the arena releases every chunk at once. Owners must have
+     * destroyed their payloads by then; the arena does not run destructors.
+     *
+     * Not thread-safe. A graph binds its arena to nested-graph storage only,
+     * so it allocates and frees only while nested-graph slots are reconciled,
+     * on the run thread. Pool items (rank levels and concurrent ``map_``
+     * children) never do: ``map_`` evaluates children concurrently only when
+     * they hold no nested graph. Debug builds assert this.
+     */
+    class HGRAPH_EXPORT StorageArena
+    {
+      public:
+        static constexpr std::size_t default_chunk_bytes = std::size_t{64} * 1024;
+        static constexpr std::size_t min_chunk_bytes     = std::size_t{4} * 1024;
+        static constexpr std::size_t granule             = 16;
+        static constexpr std::size_t max_slab_alignment  = 64;
+
+        /** ``chunk_bytes`` is raised to ``min_chunk_bytes`` and rounded to a granule. */
+        explicit StorageArena(std::size_t chunk_bytes = default_chunk_bytes);
+        ~StorageArena();
+
+        StorageArena(const StorageArena &)            = delete;
+        StorageArena &operator=(const StorageArena &) = delete;
+        StorageArena(StorageArena &&)                 = delete;
+        StorageArena &operator=(StorageArena &&)      = delete;
+
+        /** Ops table routed to this arena; valid for the arena's lifetime. */
+        [[nodiscard]] const MemoryUtils::AllocatorOps &allocator() const noexcept { return ops_; }
+
+        [[nodiscard]] std::size_t chunk_bytes() const noexcept { return chunk_bytes_; }
+        /** Largest block size served from chunks. */
+        [[nodiscard]] std::size_t large_block_bytes() const noexcept { return chunk_bytes_ / 4; }
+        [[nodiscard]] std::size_t chunk_count() const noexcept { return chunks_.size(); }
+
+        /** Live block bytes and retained chunk (plus large-block) bytes. */
+        [[nodiscard]] DynamicStorageMetrics metrics() const noexcept;
+
+      private:
+        [[nodiscard]] static void *allocate_hook(MemoryUtils::StorageLayout layout, void *context);
+        static void deallocate_hook(void *memory, MemoryUtils::StorageLayout layout, void *context) noexcept;
+
+        [[nodiscard]] bool served_from_chunks(MemoryUtils::StorageLayout layout) const noexcept;
+        [[nodiscard]] void *allocate(MemoryUtils::StorageLayout layout);
+        void deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept;
+        [[nodiscard]] void *bump(std::size_t size, std::size_t alignment);
+
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        MemoryUtils::AllocatorOps ops_{};
+        std::size_t               chunk_bytes_{0};
+        std::vector<void *>       chunks_{};
+        std::vector<FreeBlock *>  free_lists_{};
+        std::byte                *cursor_{nullptr};
+        std::byte                *limit_{nullptr};
+        std::size_t               live_bytes_{0};
+        std::size_t               large_bytes_{0};
+    };
+}  // namespace hgraph
+
+#endif  // HGRAPH_TYPES_UTILS_STORAGE_ARENA_H
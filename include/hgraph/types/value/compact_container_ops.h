@@ -176,49 +176,66 @@ namespace hgraph
             };
         }
 
-        inline nb::object list_to_python(const void *, const void *memory)
+        [[nodiscard]] inline const ListStorage &python_list_storage(const void *memory)
         {
             const auto *storage = static_cast<const ListStorage *>(memory);
             if (storage == nullptr || storage->element_binding() == nullptr)
             {
                 throw std::runtime_error("List to_python requires live storage with an element binding");
             }
-            // Any hole disables the trivially-copyable buffer fast-path.
-            bool dense = true;
-            for (std::size_t i = 0; i < storage->size(); ++i)
-            {
-                if (!storage->element_set(i)) { dense = false; break; }
-            }
-            if (dense)
+            return *storage;
+        }
+
+        [[nodiscard]] inline bool list_dense(const ListStorage &storage) noexcept
+        {
+            for (std::size_t i = 0; i < storage.size(); ++i)
             {
-                if (nb::object buffer = sequence_to_python_buffer(storage->element_binding(),
-                                                                  ValueArraySource{
-                                                                      .owner      = storage,
-                                                                      .size       = storage->size(),
-                                                                      .element_at = &list_value_array_element_at,
-                                                                      .first      = compact_sequence_span(
-                                                                          storage->element_binding(),
-                                                                          storage->size() == 0 ? nullptr
-                                                                                                : storage->element_at(0),
-                                                                          storage->size()),
-                                                                  });
-                    buffer.is_valid())
-                {
-                    return buffer;
-                }
+                if (!storage.element_set(i)) { return false; }
             }
+            return true;
+        }
 
-            const auto element_binding = storage->element_binding();
+        [[nodiscard]] inline ValueArraySpan list_span(const ListStorage &storage)
+        {
+            return compact_sequence_span(storage.element_binding(),
+                                         storage.size() == 0 ? nullptr : storage.element_at(0),
+                                         storage.size());
+        }
+
+        /** The NumPy copy of a dense list of buffer-compatible elements, or
+            an invalid object. Any hole disables the fast path. */
+        inline nb::object list_to_python_buffer(const ListStorage &storage)
+        {
+            if (!list_dense(storage)) { return nb::object{}; }
+            return sequence_to_python_buffer(storage.element_binding(),
+                                             ValueArraySource{
+                                                 .owner      = &storage,
+                                                 .size       = storage.size(),
+                                                 .element_at = &list_value_array_element_at,
+                                                 .first      = list_span(storage),
+                                             });
+        }
+
+        inline nb::list list_to_python_list(const ListStorage &storage)
+        {
+            const auto element_binding = storage.element_binding();
             const auto &ops = element_binding.ops_ref();
             nb::list result;
-            for (std::size_t i = 0; i < storage->size(); ++i)
+            for (std::size_t i = 0; i < storage.size(); ++i)
             {
                 // UNSET holes read back as None.
-                result.append(storage->element_set(i) ? ops.to_python(storage->element_at(i)) : nb::none());
+                result.append(storage.element_set(i) ? ops.to_python(storage.element_at(i)) : nb::none());
             }
             return result;
         }
 
+        inline nb::object list_to_python(const void *, const void *memory)
+        {
+            const ListStorage &storage = python_list_storage(memory);
+            if (nb::object buffer = list_to_python_buffer(storage); buffer.is_valid()) { return buffer; }
+            return list_to_python_list(storage);
+        }
+
         void list_from_python(const void *, const ValueTypeRef &binding, void *memory, nb::handle source);
 
         /** The VARIADIC-TUPLE variant: same storage, python reads back a
@@ -229,11 +246,22 @@ namespace hgraph
             return nb::tuple(list_to_python(context, memory));
         }
 
-        /** Shaped-array variant selected when the binding is interned. */
-        inline nb::object list_to_python_array(const void *context, const void *memory)
+        /** Shaped-array variant selected when the binding is interned. A
+            numeric buffer is already an ndarray; only the element-wise
+            fallback goes through ``numpy.asarray``. */
+        inline nb::object list_to_python_array(const void *, const void *memory)
         {
-            nb::object value = list_to_python(context, memory);
-            return nb::module_::import_("numpy").attr("asarray")(std::move(value));
+            const ListStorage &storage = python_list_storage(memory);
+            if (nb::object buffer = list_to_python_buffer(storage); buffer.is_valid()) { return buffer; }
+            return nb::module_::import_("numpy").attr("asarray")(list_to_python_list(storage));
+        }
+
+        /** Read-only NumPy view over a dense list of viewable scalars. */
+        inline nb::object list_to_python_view(const void *, const void *memory)
+        {
+            const ListStorage &storage = python_list_storage(memory);
+            if (!list_dense(storage)) { return nb::object{}; }
+            return storage.element_binding().ops_ref().to_python_span_view(list_span(storage));
         }
 #endif
 
@@ -1097,6 +1125,9 @@ namespace hgraph
                 };
                 value.dynamic_storage_metrics_impl =
                     &compact_dynamic_storage_metrics<ListStorage>;
+#if HGRAPH_ENABLE_PYTHON_USER_NODES
+                value.to_python_view_impl = &container_ops_detail::list_to_python_view;
+#endif
                 value.element_valid = &container_ops_detail::list_element_valid;
                 value.accepts_source_impl = &compact_accepts_source;
                 value.copy_assign_from_impl = &compact_list_copy_assign_from;
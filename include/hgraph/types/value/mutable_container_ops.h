@@ -579,24 +579,11 @@ namespace hgraph
 
     namespace mutable_container_detail
     {
-        // Adapt a key binding's value-layer ValueOps (hash/equals) to the
-        // KeySlotStore hook shape (which passes (key, context) / (lhs, rhs,
-        // context)). The context is the key binding's ValueOps.
-        inline std::size_t key_hash_adapter(const void *key, const void *context)
-        {
-            return static_cast<const ValueOps *>(context)->hash(key);
-        }
-        inline bool key_equal_adapter(const void *lhs, const void *rhs, const void *context)
-        {
-            return static_cast<const ValueOps *>(context)->equals(lhs, rhs);
-        }
+        // Key hooks for a key binding: inline for the canonical scalar key
+        // types, otherwise the binding's value-layer ValueOps (hash/equals).
         [[nodiscard]] inline KeySlotStoreOps key_ops_for(const ValueTypeRef &key_binding)
         {
-            return KeySlotStoreOps{
-                .hash    = &key_hash_adapter,
-                .equal   = &key_equal_adapter,
-                .context = &key_binding.ops_ref(),
-            };
+            return key_slot_store_ops_for(key_binding);
         }
     }  // namespace mutable_container_detail
 
@@ -19,6 +19,7 @@ namespace arrow
 {
     class Array;
     class ArrayBuilder;
+    class ChunkedArray;
     class DataType;
     class Schema;
     struct Datum;
@@ -45,6 +46,11 @@ namespace hgraph
         struct Column
         {
             using AppendFn = void (*)(const Column &, const ValueView &leaf, arrow::ArrayBuilder &);
+            /** Append one cell per leaf, an unset leaf as a null, in a single
+                call. Fixed-width and string leaves reserve once and then write
+                without a per-cell capacity check. */
+            using AppendBatchFn = void (*)(const Column &, std::span<const ValueView> leaves,
+                                           arrow::ArrayBuilder &);
             using ReadFn   = Value (*)(const Column &, const arrow::Array &, std::int64_t row);
 
             std::string                      name{};
@@ -52,6 +58,7 @@ namespace hgraph
             std::vector<std::size_t>         path{};   ///< field-index chain into the value
             std::shared_ptr<arrow::DataType> type{};
             AppendFn                         append{nullptr};
+            AppendBatchFn                    append_batch{nullptr};
             ReadFn                           read{nullptr};
         };
 
@@ -200,7 +207,8 @@ namespace hgraph
      * Build a frame from row TUPLE values, value columns only — no
      * bitemporal columns (the ``from_table`` frame rebuild; design record
      * step 6). ``first_column`` is the tuple index of the first value
-     * column; unset tuple cells become Arrow nulls.
+     * column; unset tuple cells become Arrow nulls. Written a column at a
+     * time through ``Column::append_batch``.
      */
     [[nodiscard]] HGRAPH_EXPORT Frame frame_from_rows(const TableConverter &converter,
                                                       std::span<const ValueView> rows,
@@ -210,6 +218,7 @@ namespace hgraph
      * Build a frame from whole row VALUES (each row a value of the
      * converter's schema — bundle or atomic), value columns only, no
      * bitemporal columns (to_data_frame / group_by; design record step 6).
+     * Written a column at a time through ``Column::append_batch``.
      */
     [[nodiscard]] HGRAPH_EXPORT Frame frame_from_values(const TableConverter &converter,
                                                         std::span<const Value> rows);
@@ -253,6 +262,51 @@ namespace hgraph
                                                     const ValueTypeMetaData *leaf,
                                                     std::int64_t row);
 
+    /**
+     * Sequential reader over one column of a frame, resolved once.
+     *
+     * ``frame_cell`` looks the column up and concatenates a chunked column on
+     * every call, which makes a replay over a multi-chunk frame quadratic.
+     * A cursor holds the column's chunks, validates each against ``leaf``
+     * when it is built, and reads a row from the chunk that holds it in
+     * place. The chunk last read is remembered, so rows read in ascending
+     * order cost O(1) each; any other order binary-searches the chunk starts.
+     */
+    class HGRAPH_EXPORT FrameColumnCursor
+    {
+      public:
+        FrameColumnCursor() = default;
+        /** Throws ``std::invalid_argument`` when the column is missing or
+            any chunk disagrees with ``leaf``. */
+        FrameColumnCursor(const Frame &frame, std::string_view column, const ValueTypeMetaData *leaf);
+
+        [[nodiscard]] bool has_value() const noexcept { return column_ != nullptr; }
+        [[nodiscard]] std::int64_t length() const noexcept;
+
+        /** The cell at ``row``; an Arrow null yields an empty ``Value``. */
+        [[nodiscard]] Value read(std::int64_t row) const;
+        [[nodiscard]] bool  is_null(std::int64_t row) const;
+        /** A ``DateTime`` column's cell without building a ``Value``; a null
+            throws ``std::invalid_argument``. */
+        [[nodiscard]] DateTime date_time(std::int64_t row) const;
+
+      private:
+        [[nodiscard]] const arrow::Array &locate(std::int64_t row, std::int64_t &local) const;
+
+        std::shared_ptr<arrow::ChunkedArray> column_{};
+        std::vector<std::int64_t>            chunk_ends_{};   ///< exclusive end row of each chunk
+        TableConverter::Column               reader_{};
+        std::string                          name_{};
+        bool                                 date_time_{false};
+        mutable std::size_t                  chunk_{0};
+    };
+
+    /** The frame restricted to ``columns``, in that order, sharing the
+        column data (no copy). A missing column throws; a repeated name is
+        kept once. */
+    [[nodiscard]] HGRAPH_EXPORT Frame frame_select_columns(const Frame &frame,
+                                                           std::span<const std::string> columns);
+
     /** Rename columns per (from, to) pairs (convert frame->frame mapping). */
     [[nodiscard]] HGRAPH_EXPORT Frame frame_rename_columns(
         const Frame &frame, std::span<const std::pair<std::string, std::string>> renames);
@@ -51,7 +51,7 @@ namespace hgraph
     };
 
     static_assert(sizeof(ValueOpsKind) == 1);
-    inline constexpr std::uint16_t VALUE_OPS_ABI_VERSION = 6;
+    inline constexpr std::uint16_t VALUE_OPS_ABI_VERSION = 7;
 
     struct ValueOps;
 #if HGRAPH_ENABLE_PYTHON_USER_NODES
@@ -111,6 +111,12 @@ namespace hgraph
      *   may return the type name.
      * - ``format_string(memory)`` — user-facing scalar text. It falls back
      *   to the diagnostic string unless the type supplies a distinct form.
+     * - ``to_python_span_view(span)`` / ``to_python_view(memory)`` — a
+     *   read-only NumPy array that borrows the storage instead of copying
+     *   it: a run of elements of a numeric scalar type, or a whole dense
+     *   numeric sequence. The array is valid only while the storage is
+     *   neither mutated nor destroyed, in practice the current evaluation
+     *   cycle. An invalid object means "no view; use ``to_python``".
      */
     struct ValueOps
     {
@@ -128,6 +134,8 @@ namespace hgraph
                                  nb::handle source) = nullptr;
         nb::object (*to_python_buffer_impl)(const void *context, const ValueTypeRef &binding,
                                             const ValueArraySource &source) = nullptr;
+        nb::object (*to_python_span_view_impl)(const void *context, const ValueArraySpan &span) = nullptr;
+        nb::object (*to_python_view_impl)(const void *context, const void *memory) = nullptr;
 #endif
         void (*copy_construct_view_impl)(const void *context, const ValueTypeRef &binding, void *dst,
                                          const void *memory) = nullptr;
@@ -236,6 +244,16 @@ namespace hgraph
             }
             return to_python_buffer_impl(context, binding, source);
         }
+
+        [[nodiscard]] nb::object to_python_span_view(const ValueArraySpan &span) const
+        {
+            return to_python_span_view_impl != nullptr ? to_python_span_view_impl(context, span) : nb::object{};
+        }
+
+        [[nodiscard]] nb::object to_python_view(const void *memory) const
+        {
+            return to_python_view_impl != nullptr ? to_python_view_impl(context, memory) : nb::object{};
+        }
 #endif
 
         [[nodiscard]] ValueTypeRef owning_type(ValueTypeRef view_type) const
@@ -830,6 +848,53 @@ namespace hgraph
                 throw std::logic_error("ValueOps::to_python_buffer is not available for this scalar type");
             }
         }
+
+        /** Scalars whose storage NumPy can read in place: the buffer storage
+            type itself, or a same-sized integer reinterpreted through
+            ``numpy_view_dtype`` (``DateTime`` and ``TimeDelta``). */
+        template <typename T>
+        inline constexpr bool python_span_viewable = [] {
+            if constexpr (detail::buffer_compatible_type<T>)
+            {
+                using traits       = python_buffer_traits<T>;
+                using storage_type = typename traits::storage_type;
+                return std::is_same_v<std::remove_cv_t<T>, storage_type> ||
+                       (traits::numpy_view_dtype() != nullptr && sizeof(T) == sizeof(storage_type) &&
+                        !std::is_same_v<T, Date>);
+            }
+            else
+            {
+                return false;
+            }
+        }();
+
+        template <typename T>
+        nb::object to_python_span_view_thunk(const void *, const ValueArraySpan &span)
+        {
+            using traits       = python_buffer_traits<T>;
+            using storage_type = typename traits::storage_type;
+            if (span.stride % sizeof(storage_type) != 0) { return nb::object{}; }
+            // NumPy wants a non-null data pointer even for an empty array.
+            static constexpr storage_type empty{};
+            const void *data = span.size == 0 || span.data == nullptr ? &empty : span.data;
+            nb::ndarray<nb::numpy, const storage_type, nb::ndim<1>> array{
+                data, {span.size}, nb::handle{}, {static_cast<std::int64_t>(span.stride / sizeof(storage_type))}};
+            // Without an owner the default policy would copy; the view borrows.
+            nb::object result = array.cast(nb::rv_policy::reference);
+            if constexpr (traits::numpy_view_dtype() != nullptr)
+            {
+                return result.attr("view")(nb::str{traits::numpy_view_dtype()});
+            }
+            return result;
+        }
+
+        template <typename T>
+        [[nodiscard]] constexpr auto to_python_span_view_impl_for() noexcept
+            -> nb::object (*)(const void *, const ValueArraySpan &)
+        {
+            if constexpr (python_span_viewable<T>) { return &to_python_span_view_thunk<T>; }
+            else { return nullptr; }
+        }
 #endif
     }  // namespace value_ops_detail
 
@@ -856,6 +921,7 @@ namespace hgraph
             .to_python_impl = &value_ops_detail::to_python_thunk<T>,
             .from_python_impl = &value_ops_detail::from_python_thunk<T>,
             .to_python_buffer_impl = &value_ops_detail::to_python_buffer_thunk<T>,
+            .to_python_span_view_impl = value_ops_detail::to_python_span_view_impl_for<T>(),
 #endif
             .format_string_impl = &value_ops_detail::format_string_thunk<T>,
             .dynamic_storage_metrics_impl = &value_ops_detail::dynamic_storage_metrics_thunk<T>,
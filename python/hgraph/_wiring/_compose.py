@@ -478,7 +478,7 @@ def _bind_switch_scalar_args(branch, args, kwargs):
     return adapter
 
 
-def switch_(key, cases, *args, reload_on_ticked=False, **kwargs):
+def switch_(key, cases, *args, reload_on_ticked=False, warm_branches=0, **kwargs):
     """Run one child graph selected by the current key.
 
     A key change stops and destroys the old branch, builds the selected branch,
@@ -490,6 +490,9 @@ def switch_(key, cases, *args, reload_on_ticked=False, **kwargs):
         supplies the fallback.
     :param args: Positional inputs forwarded to the active branch.
     :param reload_on_ticked: Rebuild even when the key ticks with the same value.
+    :param warm_branches: Keep this many stopped branches constructed and
+        restart them when their key returns instead of rebuilding. A restarted
+        branch keeps its node state from before it was stopped.
     :param kwargs: Named inputs forwarded to the active branch.
     :return: The active child graph output, or ``None`` for sink branches.
 
@@ -514,7 +517,8 @@ def switch_(key, cases, *args, reload_on_ticked=False, **kwargs):
             branch = _bind_switch_scalar_args(branch, args, kwargs)
         prepared[case_key] = branch if isinstance(branch, str) else _as_wired(branch)
     erased = _hgraph.switch_cases(
-        prepared, reload=reload_on_ticked, key_type=_unwrap(key).ts_type)
+        prepared, reload=reload_on_ticked, key_type=_unwrap(key).ts_type,
+        warm_branches=warm_branches)
     return wire("switch_", key, erased, *ts_args, **ts_kwargs)
 
 
@@ -29,6 +29,15 @@ def is_realtime():
     return _current_wiring().is_realtime
 
 
+def set_trait(name, value):
+    """Set a graph trait, read at runtime by the nodes of the graph being wired.
+
+    Nested graphs see their parents' traits; ``set_trait("recycled_child_graphs", n)``
+    lets each ``map_``/``mesh_`` below keep up to ``n`` erased child graphs for reuse.
+    """
+    _current_wiring().set_trait(name, value)
+
+
 # Operators whose durable overloads register from hgraph-persistence
 # (RFC 0025). replay_const has no in-memory implementation at all.
 _DURABLE_OPERATORS = frozenset({"record", "replay", "compare", "replay_const"})
@@ -1,7 +1,7 @@
 """hgraph.test - the test utilities (hgraph-compatible import path)."""
 from contextlib import contextmanager
 
-from _hgraph import EvaluationProfiler, EvaluationProfileEntry, EvaluationProfilePhase, EvaluationProfileSnapshot, EvaluationTrace, GraphDiagnostics, WiringTracer
+from _hgraph import EvaluationProfiler, EvaluationProfileEntry, EvaluationProfilePhase, EvaluationProfileSnapshot, LatencyHistogram, EvaluationTrace, GraphDiagnostics, WiringTracer
 
 from .._wiring import eval_node
 from ._breakpoint import breakpoint_
@@ -1637,6 +1637,24 @@ namespace hgraph::python_bridge
             return v.value_to_python();
         }
 
+        /** ``value`` as a read-only NumPy array borrowing the input's
+            storage when it is a dense numeric array or a window occupying
+            one contiguous run; otherwise the same copy ``value`` returns.
+            The view is valid only for the current evaluation. */
+        [[nodiscard]] nb::object value_view() const
+        {
+            if (!key_set_projection && valid())
+            {
+                const ValueView current = checked().value();
+                if (current.valid())
+                {
+                    nb::object view = current.type().ops_ref().to_python_view(current.data());
+                    if (view.is_valid()) { return view; }
+                }
+            }
+            return value();
+        }
+
         [[nodiscard]] nb::object delta_value() const
         {
             if (key_set_projection)
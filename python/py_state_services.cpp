@@ -1180,6 +1180,12 @@ namespace hgraph::python_bridge
         {"value", &py_ts_raw_get<&PyTimeSeries::value>, nullptr,
          "The current Python value, or None when the input is invalid.",
          nullptr},
+        {"value_view", &py_ts_raw_get<&PyTimeSeries::value_view>, nullptr,
+         "The current value as a read-only NumPy view over the input's "
+         "storage, valid only during this evaluation. Numeric arrays and "
+         "unwrapped numeric windows are viewed without copying; other "
+         "values are returned as value would return them.",
+         nullptr},
         {"delta_value", &py_ts_raw_get<&PyTimeSeries::delta_value>, nullptr,
          "The change observed in the current evaluation cycle.", nullptr},
         {"modified", &py_ts_raw_get<&PyTimeSeries::modified>, nullptr,
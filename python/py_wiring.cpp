@@ -873,6 +873,17 @@ namespace hgraph::python_bridge
                     nb::arg("value"),
                     "Globally select logging instead of direct trace output.");
 
+    nb::class_<LatencyHistogram>(
+        m, "LatencyHistogram",
+        "A fixed-memory log-linear latency distribution with nanosecond "
+        "buckets.")
+        .def_prop_ro("count", &LatencyHistogram::count)
+        .def_prop_ro("max", &LatencyHistogram::max)
+        .def("quantile", &LatencyHistogram::quantile, nb::arg("q"),
+             "Return the latency at or below which a fraction q of samples fall.")
+        .def_prop_ro("p50", &LatencyHistogram::p50)
+        .def_prop_ro("p99", &LatencyHistogram::p99)
+        .def_prop_ro("p999", &LatencyHistogram::p999);
     nb::class_<EvaluationProfilePhase>(
         m, "EvaluationProfilePhase",
         "Aggregated timing and failure counts for one lifecycle phase.")
@@ -880,7 +891,15 @@ namespace hgraph::python_bridge
         .def_ro("failures", &EvaluationProfilePhase::failures)
         .def_ro("total_time", &EvaluationProfilePhase::total_time)
         .def_ro("max_time", &EvaluationProfilePhase::max_time)
-        .def_ro("recent_time", &EvaluationProfilePhase::recent_time);
+        .def_ro("recent_time", &EvaluationProfilePhase::recent_time)
+        .def_prop_ro(
+            "latency",
+            [](const EvaluationProfilePhase &self) { return self.latency.get(); },
+            nb::rv_policy::reference_internal)
+        .def_ro("allocations", &EvaluationProfilePhase::allocations)
+        .def_ro("allocated_bytes", &EvaluationProfilePhase::allocated_bytes)
+        .def_ro("max_allocations", &EvaluationProfilePhase::max_allocations)
+        .def_ro("max_allocated_bytes", &EvaluationProfilePhase::max_allocated_bytes);
     nb::class_<EvaluationProfileEntry>(
         m, "EvaluationProfileEntry",
         "A profiler entry for one graph or node path, split into start, "
@@ -901,17 +920,28 @@ namespace hgraph::python_bridge
         .def_ro("scheduling_lag_max", &EvaluationProfileSnapshot::scheduling_lag_max)
         .def_ro("scheduling_lag_samples", &EvaluationProfileSnapshot::scheduling_lag_samples)
         .def_ro("runtime_load", &EvaluationProfileSnapshot::runtime_load)
+        .def_prop_ro(
+            "cycle_latency",
+            [](const EvaluationProfileSnapshot &self) { return self.cycle_latency.get(); },
+            nb::rv_policy::reference_internal)
+        .def_prop_ro(
+            "scheduling_lag",
+            [](const EvaluationProfileSnapshot &self) { return self.scheduling_lag.get(); },
+            nb::rv_policy::reference_internal)
         .def_ro("entries", &EvaluationProfileSnapshot::entries);
     nb::class_<EvaluationProfiler>(
         m, "EvaluationProfiler",
         "Collect graph and node lifecycle timing without retaining runtime "
         "objects.\n\n"
         "Pass an instance as GraphConfiguration.profile. snapshot() is safe "
-        "after the run completes.")
-        .def(nb::init<bool, bool, bool, bool, bool, std::size_t>(),
+        "after the run completes.\n\n"
+        "allocations=True raises ValueError in a Python process: the "
+        "counting allocator is installed only by native executables.")
+        .def(nb::init<bool, bool, bool, bool, bool, std::size_t, bool, bool>(),
              nb::arg("start") = true, nb::arg("eval") = true,
              nb::arg("stop") = true, nb::arg("node") = true,
-             nb::arg("graph") = true, nb::arg("recent_window") = 100)
+             nb::arg("graph") = true, nb::arg("recent_window") = 100,
+             nb::arg("histograms") = false, nb::arg("allocations") = false)
         .def("snapshot", &EvaluationProfiler::snapshot,
              "Return an immutable snapshot of the currently collected metrics.")
         .def("reset", &EvaluationProfiler::reset,
@@ -1039,7 +1069,13 @@ namespace hgraph::python_bridge
         .def_ro("executor_runtime_types", &RuntimeRegistrySnapshot::executor_runtime_types)
         .def_ro("type_records", &RuntimeRegistrySnapshot::type_records)
         .def_ro("type_system_lock_acquisitions",
-                &RuntimeRegistrySnapshot::type_system_lock_acquisitions);
+                &RuntimeRegistrySnapshot::type_system_lock_acquisitions)
+        .def_ro("operator_resolution_cache_entries",
+                &RuntimeRegistrySnapshot::operator_resolution_cache_entries)
+        .def_ro("operator_resolution_cache_hits",
+                &RuntimeRegistrySnapshot::operator_resolution_cache_hits)
+        .def_ro("operator_resolution_cache_misses",
+                &RuntimeRegistrySnapshot::operator_resolution_cache_misses);
     m.def("runtime_registry_snapshot", &runtime_registry_snapshot,
           "Capture cold-path process-lifetime runtime registry cardinalities.");
 
@@ -1163,9 +1199,10 @@ namespace hgraph::python_bridge
         });
 
     m.def("switch_cases", [](nb::dict cases, bool reload,
-                              std::optional<PyTsType> key_type) {
+                              std::optional<PyTsType> key_type, std::size_t warm_branches) {
         stdlib::SwitchCases result;
         result.reload_on_ticked = reload;
+        result.warm_branches    = warm_branches;
         const auto *key_schema = key_type.has_value()
                                      ? TypeRegistry::instance()
                                            .dereference(key_type->meta)
@@ -1193,7 +1230,7 @@ namespace hgraph::python_bridge
         }
         return PySwitchCases{std::move(result)};
     }, nb::arg("cases"), nb::arg("reload") = false,
-       nb::arg("key_type") = nb::none());
+       nb::arg("key_type") = nb::none(), nb::arg("warm_branches") = 0);
     m.def("dispatch_cases", [](nb::list entries, nb::list on, nb::object default_branch) {
         const auto as_wired_fn = [](nb::handle branch) {
             if (nb::isinstance<PyWiredFn>(branch))
@@ -1255,6 +1292,10 @@ namespace hgraph::python_bridge
         .def_prop_ro("is_realtime", [](const PyWiring &wiring) {
             return wiring.raw->is_realtime();
         }, "Whether this context is wiring a real-time graph.")
+        .def("set_trait", [](PyWiring &wiring, const std::string &name, nb::handle value) {
+            wiring.raw->set_trait(name, py_to_value(value));
+        }, nb::arg("name"), nb::arg("value"),
+        "Set a graph trait on the graph being wired.")
         .def("_acquire_extension_state", [](PyWiring &wiring, const std::string &key,
                                              const nb::object &factory) {
             auto state = std::static_pointer_cast<PyWiringExtensionState>(
@@ -23,3 +23,36 @@ def test_fixed_array_capacity_accepts_a_shorter_logical_value():
 
     with pytest.raises(ValueError, match="at most 3 elements"):
         eval_node(passthrough, [np.array([1, 2, 3, 4])])
+
+
+@pytest.mark.parametrize("annotation", [Array[float, Size[4]], Array[float, Size[-1]]])
+def test_array_value_view_borrows_the_input_storage(annotation):
+    observations = []
+
+    @compute_node
+    def inspect(ts: TS[annotation]) -> TS[float]:
+        view = ts.value_view
+        observations.append(
+            {
+                "values": view.tolist(),
+                "writeable": view.flags.writeable,
+                "shared": np.shares_memory(view, ts.value_view),
+                "copied": np.shares_memory(view, ts.value),
+            }
+        )
+        return float(view.sum())
+
+    values = [np.array([1.0, 2.0, 3.0, 4.0]), np.array([0.5, 1.5])]
+    assert eval_node(inspect, values) == [10.0, 2.0]
+    assert [item["values"] for item in observations] == [[1.0, 2.0, 3.0, 4.0], [0.5, 1.5]]
+    assert not any(item["writeable"] for item in observations)
+    assert all(item["shared"] for item in observations)
+    assert not any(item["copied"] for item in observations)
+
+
+def test_array_value_view_copies_values_without_a_numeric_layout():
+    @compute_node
+    def inspect(ts: TS[Array[str, Size[2]]]) -> TS[bool]:
+        return list(ts.value_view) == list(ts.value)
+
+    assert eval_node(inspect, [["a", "b"]]) == [True]
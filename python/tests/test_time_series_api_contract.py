@@ -890,6 +890,37 @@ def test_tsw_input_views_expose_configuration_population_and_time_metadata():
     assert observations[3]["removed_value"] == 1
 
 
+def test_tsw_input_value_view_borrows_an_unwrapped_window():
+    observations = []
+
+    @compute_node
+    def inspect(value: TSW[float, WindowSize[3], WindowSize[1]]) -> TS[float]:
+        view = value.value_view
+        observations.append(
+            {
+                "values": view.tolist(),
+                "shared": np.shares_memory(view, value.value_view),
+                "writeable": view.flags.writeable,
+            }
+        )
+        return float(view.sum())
+
+    @graph
+    def app(value: TS[float]) -> TS[float]:
+        return inspect(to_window(value, 3, 1))
+
+    assert eval_node(app, [1.0, 2.0, 3.0, 4.0]) == [1.0, 3.0, 6.0, 9.0]
+    assert [item["values"] for item in observations] == [
+        [1.0],
+        [1.0, 2.0],
+        [1.0, 2.0, 3.0],
+        [2.0, 3.0, 4.0],
+    ]
+    # The fourth tick wraps the ring into two runs: value_view then copies.
+    assert [item["shared"] for item in observations] == [True, True, True, False]
+    assert not any(item["writeable"] for item in observations)
+
+
 def test_tsw_output_views_expose_numpy_compatible_value_and_time_buffers():
     observations = []
 
@@ -57,21 +57,19 @@ namespace hgraph::stdlib
 
             [[nodiscard]] const ValueTypeMetaData *datetime_meta()
             {
-                // Generation-cached: read_dt runs per replayed ROW, and the
-                // name lookup took the registry mutex plus a string
-                // allocation every call (lock-free per-tick ruling).
+                // Generation-cached: the name lookup took the registry
+                // mutex plus a string allocation every call (lock-free
+                // per-tick ruling).
                 return TypeRegistry::instance().scalar_type<DateTime>().schema();
             }
 
-            [[nodiscard]] DateTime read_dt(const Frame &frame, const std::string &dt_col,
-                                           std::int64_t row)
+            [[nodiscard]] DateTime read_dt(const FromFramePlan &plan, std::int64_t row)
             {
-                const Value cell = frame_cell(frame, dt_col, datetime_meta(), row);
-                if (!cell.has_value())
+                if (plan.dt.is_null(row))
                 {
                     throw std::invalid_argument("from_data_frame: null value in the date column");
                 }
-                return cell.view().checked_as<DateTime>();
+                return plan.dt.date_time(row) + plan.offset;
             }
 
             [[nodiscard]] const ValueTypeMetaData *frame_columns_schema(const ValueTypeMetaData *frame_meta,
@@ -211,12 +209,26 @@ namespace hgraph::stdlib
             }
 
             const auto rows = plan->frame.has_value() ? frame_rows(plan->frame) : 0;
-            while (plan->row < rows &&
-                   read_dt(plan->frame, plan->dt_col, plan->row) + plan->offset <
-                       start_time)
+            if (rows > 0)
             {
-                ++plan->row;
+                // Keep only the replayed columns (no copy: the projection
+                // shares the column chunks) and resolve each once.
+                std::vector<std::string> columns{plan->dt_col};
+                if (plan->key_meta != nullptr) { columns.push_back(plan->key_col); }
+                for (const auto &field : plan->fields) { columns.push_back(field.column); }
+                plan->frame = frame_select_columns(plan->frame, columns);
+                plan->dt    = FrameColumnCursor{plan->frame, plan->dt_col, datetime_meta()};
+                if (plan->key_meta != nullptr)
+                {
+                    plan->key = FrameColumnCursor{plan->frame, plan->key_col, plan->key_meta};
+                }
+                plan->cells.reserve(plan->fields.size());
+                for (const auto &field : plan->fields)
+                {
+                    plan->cells.emplace_back(plan->frame, field.column, field.leaf);
+                }
             }
+            while (plan->row < rows && read_dt(*plan, plan->row) < start_time) { ++plan->row; }
             plan_out = plan.release();
         }
 
@@ -232,12 +244,7 @@ namespace hgraph::stdlib
             const auto rows = plan_out->frame.has_value()
                                   ? frame_rows(plan_out->frame)
                                   : std::int64_t{0};
-            if (plan_out->row < rows)
-            {
-                sched.schedule(read_dt(plan_out->frame, plan_out->dt_col,
-                                       plan_out->row) +
-                               plan_out->offset);
-            }
+            if (plan_out->row < rows) { sched.schedule(read_dt(*plan_out, plan_out->row)); }
         }
 
         namespace
@@ -249,18 +256,17 @@ namespace hgraph::stdlib
                 {
                     Value value{checked_binding(plan.bundle_meta, "from_data_frame")};
                     bool  any = false;
-                    for (const auto &field : plan.fields)
+                    for (std::size_t index = 0; index < plan.fields.size(); ++index)
                     {
-                        const Value cell = frame_cell(plan.frame, field.column, field.leaf, row);
+                        const Value cell = plan.cells[index].read(row);
                         if (!cell.has_value()) { continue; }   // nulls do not tick
-                        set_bundle_field(value, field.field_index, cell);
+                        set_bundle_field(value, plan.fields[index].field_index, cell);
                         any = true;
                     }
                     if (any) { apply_delta(out, value.view()); }
                     return;
                 }
-                const auto &field = plan.fields.front();
-                const Value cell  = frame_cell(plan.frame, field.column, field.leaf, row);
+                const Value cell = plan.cells.front().read(row);
                 if (cell.has_value()) { apply_current_value(out, cell.view()); }
             }
 
@@ -277,7 +283,7 @@ namespace hgraph::stdlib
             {
                 auto        dict     = out.as_dict();
                 auto        mutation = dict.begin_mutation(out.evaluation_time());
-                const Value key = frame_cell(plan.frame, plan.key_col, plan.key_meta, row);
+                const Value key = plan.key.read(row);
                 auto        element = mutation.at(key.view());
                 apply_from_frame_leafish(
                     plan, row, TSOutputView{out.output(), element, out.evaluation_time()});
@@ -288,15 +294,12 @@ namespace hgraph::stdlib
                              const TSOutputView &out)
         {
             const auto rows = plan.frame.has_value() ? frame_rows(plan.frame) : 0;
-            while (plan.row < rows && read_dt(plan.frame, plan.dt_col, plan.row) + plan.offset == now)
+            while (plan.row < rows && read_dt(plan, plan.row) == now)
             {
                 plan.apply_row(plan, plan.row, out);
                 ++plan.row;
             }
-            if (plan.row < rows)
-            {
-                sched.schedule(read_dt(plan.frame, plan.dt_col, plan.row) + plan.offset);
-            }
+            if (plan.row < rows) { sched.schedule(read_dt(plan, plan.row)); }
         }
 
         // -----------------------------------------------------------------
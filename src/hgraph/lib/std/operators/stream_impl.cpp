@@ -40,6 +40,10 @@ namespace hgraph::stdlib
         register_overload<mean, stream_impl_detail::tsw_numeric_aggregate_impl<true, Float>>();
         register_overload<min_, stream_impl_detail::tsw_extremum_impl<true>>();
         register_overload<max_, stream_impl_detail::tsw_extremum_impl<false>>();
+        register_overload<min_, stream_impl_detail::tsw_numeric_extremum_impl<true, Int>>();
+        register_overload<min_, stream_impl_detail::tsw_numeric_extremum_impl<true, Float>>();
+        register_overload<max_, stream_impl_detail::tsw_numeric_extremum_impl<false, Int>>();
+        register_overload<max_, stream_impl_detail::tsw_numeric_extremum_impl<false, Float>>();
         register_overload<min_, stream_impl_detail::tsw_extremum_default_impl<true>>();
         register_overload<max_, stream_impl_detail::tsw_extremum_default_impl<false>>();
         register_overload<throttle, throttle_impl>();
@@ -0,0 +1,26 @@
+#include <hgraph/runtime/allocation_counter.h>
+
+#include <atomic>
+
+namespace hgraph
+{
+    namespace
+    {
+        // Plain integers with static initialisation: the replacement
+        // operator new runs before and after any dynamic initialiser here.
+        thread_local AllocationCount g_thread_allocations{};
+        std::atomic<bool>            g_counting_installed{false};
+    }  // namespace
+
+    void count_thread_allocation(std::size_t bytes) noexcept
+    {
+        ++g_thread_allocations.allocations;
+        g_thread_allocations.bytes += bytes;
+    }
+
+    AllocationCount thread_allocation_count() noexcept { return g_thread_allocations; }
+
+    void mark_allocation_counting_installed() noexcept { g_counting_installed.store(true, std::memory_order_relaxed); }
+
+    bool allocation_counting_installed() noexcept { return g_counting_installed.load(std::memory_order_relaxed); }
+}  // namespace hgraph
@@ -7,9 +7,12 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <chrono>
+#include <cmath>
 #include <mutex>
 #include <optional>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 
@@ -31,13 +34,87 @@ enum class ProfilePhase : std::uint8_t {
 [[nodiscard]] DateTime current_wall_time() noexcept {
   return std::chrono::time_point_cast<TimeDelta>(engine_clock::now());
 }
+
+[[nodiscard]] std::size_t latency_bucket(std::uint64_t nanoseconds) noexcept {
+  constexpr std::size_t bits = LatencyHistogram::sub_bucket_bits;
+  if (nanoseconds < LatencyHistogram::sub_buckets) {
+    return static_cast<std::size_t>(nanoseconds);
+  }
+  const auto exponent =
+      static_cast<std::size_t>(std::bit_width(nanoseconds) - 1);
+  if (exponent >= LatencyHistogram::max_exponent) {
+    return LatencyHistogram::bucket_count - 1;
+  }
+  const auto mantissa = static_cast<std::size_t>(nanoseconds >> (exponent - bits));
+  return (exponent - bits + 1) * LatencyHistogram::sub_buckets + mantissa -
+         LatencyHistogram::sub_buckets;
+}
 } // namespace
 
+void LatencyHistogram::record(Duration value) noexcept {
+  if (value < Duration{0}) {
+    value = Duration{0};
+  }
+  ++counts_[latency_bucket(static_cast<std::uint64_t>(value.count()))];
+  ++count_;
+  max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) noexcept {
+  for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    counts_[bucket] += other.counts_[bucket];
+  }
+  count_ += other.count_;
+  max_ = std::max(max_, other.max_);
+}
+
+LatencyHistogram::Duration LatencyHistogram::quantile(double q) const noexcept {
+  if (count_ == 0) {
+    return Duration{0};
+  }
+  q = std::clamp(std::isnan(q) ? 0.0 : q, 0.0, 1.0);
+  const auto rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count_))));
+  std::uint64_t seen = 0;
+  for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    seen += counts_[bucket];
+    if (seen >= rank) {
+      // The last bucket also holds every untracked sample: no bound but max.
+      return bucket + 1 == bucket_count
+                 ? max_
+                 : std::min(bucket_upper_bound(bucket), max_);
+    }
+  }
+  return max_;
+}
+
+LatencyHistogram::Duration
+LatencyHistogram::bucket_lower_bound(std::size_t bucket) noexcept {
+  if (bucket < sub_buckets) {
+    return Duration{static_cast<std::int64_t>(bucket)};
+  }
+  const std::size_t shift = bucket / sub_buckets - 1;
+  const std::size_t mantissa = sub_buckets + bucket % sub_buckets;
+  return Duration{static_cast<std::int64_t>(mantissa) << shift};
+}
+
+LatencyHistogram::Duration
+LatencyHistogram::bucket_upper_bound(std::size_t bucket) noexcept {
+  if (bucket < sub_buckets) {
+    return Duration{static_cast<std::int64_t>(bucket)};
+  }
+  const std::size_t shift = bucket / sub_buckets - 1;
+  return bucket_lower_bound(bucket) +
+         Duration{(std::int64_t{1} << shift) - 1};
+}
+
 struct EvaluationProfiler::State {
   struct PhaseState {
     EvaluationProfilePhase snapshot{};
     std::vector<TimeDelta> recent{};
     std::size_t recent_cursor{0};
+    /** Reserved at registration when the profiler collects histograms. */
+    std::unique_ptr<LatencyHistogram> latency{};
   };
 
   struct EntryState {
@@ -50,6 +127,7 @@ struct EvaluationProfiler::State {
   struct EntityState {
     EntryState *entry{nullptr};
     std::array<std::optional<ProfileTime>, 3> active{};
+    std::optional<AllocationCount> allocations_started{};
   };
 
   mutable std::mutex mutex{};
@@ -64,6 +142,8 @@ struct EvaluationProfiler::State {
   TimeDelta scheduling_lag_total{0};
   TimeDelta scheduling_lag_max{0};
   std::uint64_t scheduling_lag_samples{0};
+  std::unique_ptr<LatencyHistogram> cycle_latency{};
+  std::unique_ptr<LatencyHistogram> scheduling_lag{};
 };
 
 namespace {
@@ -85,8 +165,13 @@ phase_state(EvaluationProfiler::State::EntryState &entry, ProfilePhase phase) {
 }
 
 void record_duration(EvaluationProfiler::State::PhaseState &phase,
-                     TimeDelta duration, bool failed,
+                     ProfileClock::duration measured, bool failed,
                      std::size_t recent_window) {
+  if (phase.latency != nullptr) {
+    phase.latency->record(
+        std::chrono::duration_cast<LatencyHistogram::Duration>(measured));
+  }
+  TimeDelta duration = std::chrono::duration_cast<TimeDelta>(measured);
   if (duration < TimeDelta{0}) {
     duration = TimeDelta{0};
   }
@@ -116,14 +201,36 @@ void record_duration(EvaluationProfiler::State::PhaseState &phase,
   phase.recent_cursor = (phase.recent_cursor + 1) % recent_window;
 }
 
+void begin_allocations(EvaluationProfiler::State::EntityState &entity) noexcept {
+  entity.allocations_started = thread_allocation_count();
+}
+
+void end_allocations(EvaluationProfiler::State::EntityState &entity,
+                     AllocationCount allocated) noexcept {
+  if (!entity.allocations_started.has_value() || entity.entry == nullptr) {
+    return;
+  }
+  const AllocationCount counted = allocated - *entity.allocations_started;
+  EvaluationProfilePhase &phase = entity.entry->evaluation.snapshot;
+  phase.allocations += counted.allocations;
+  phase.allocated_bytes += counted.bytes;
+  phase.max_allocations = std::max(phase.max_allocations, counted.allocations);
+  phase.max_allocated_bytes =
+      std::max(phase.max_allocated_bytes, counted.bytes);
+  entity.allocations_started.reset();
+}
+
 EvaluationProfiler::State::EntryState &
 ensure_entry(EvaluationProfiler::State &state, std::string path,
-             std::string label, bool graph) {
+             std::string label, bool graph, bool histograms) {
   auto [it, inserted] = state.entries.try_emplace(path);
   if (inserted) {
     it->second.identity.path = std::move(path);
     it->second.identity.label = std::move(label);
     it->second.identity.graph = graph;
+    if (histograms) {
+      it->second.evaluation.latency = std::make_unique<LatencyHistogram>();
+    }
   }
   return it->second;
 }
@@ -132,11 +239,12 @@ EvaluationProfiler::State::EntityState &register_entity(
     EvaluationProfiler::State &state,
     std::unordered_map<const void *, EvaluationProfiler::State::EntityState>
         &entities,
-    const void *identity, std::string path, std::string label, bool graph) {
+    const void *identity, std::string path, std::string label, bool graph,
+    bool histograms) {
   auto [entity, inserted] = entities.try_emplace(identity);
   if (inserted || entity->second.entry == nullptr) {
-    entity->second.entry =
-        &ensure_entry(state, std::move(path), std::move(label), graph);
+    entity->second.entry = &ensure_entry(state, std::move(path),
+                                         std::move(label), graph, histograms);
   }
   return entity->second;
 }
@@ -153,11 +261,11 @@ TimeDelta end_phase(EvaluationProfiler::State::EntityState &entity,
   if (!started.has_value() || entity.entry == nullptr) {
     return TimeDelta{0};
   }
-  const TimeDelta duration = elapsed(*started, ProfileClock::now());
-  record_duration(phase_state(*entity.entry, phase), duration, failed,
+  const ProfileClock::duration measured = ProfileClock::now() - *started;
+  record_duration(phase_state(*entity.entry, phase), measured, failed,
                   recent_window);
   started.reset();
-  return duration;
+  return std::chrono::duration_cast<TimeDelta>(measured);
 }
 
 EvaluationProfiler::State::EntityState *find_entity(
@@ -175,11 +283,23 @@ EvaluationProfiler::State::EntityState *find_entity(
 } // namespace
 
 EvaluationProfiler::EvaluationProfiler(EvaluationProfilerOptions options)
-    : options_(options), state_(std::make_shared<State>()) {}
+    : options_(options), state_(std::make_shared<State>()) {
+  if (options_.allocations && !allocation_counting_installed()) {
+    throw std::invalid_argument(
+        "EvaluationProfiler allocations need the counting allocator of "
+        "hgraph/runtime/allocation_hooks.h, which this process does not "
+        "install");
+  }
+  if (options_.histograms) {
+    state_->cycle_latency = std::make_unique<LatencyHistogram>();
+    state_->scheduling_lag = std::make_unique<LatencyHistogram>();
+  }
+}
 
 EvaluationProfiler::EvaluationProfiler(bool start, bool eval, bool stop,
                                        bool node, bool graph,
-                                       std::size_t recent_window)
+                                       std::size_t recent_window,
+                                       bool histograms, bool allocations)
     : EvaluationProfiler(EvaluationProfilerOptions{
           .start = start,
           .eval = eval,
@@ -187,6 +307,8 @@ EvaluationProfiler::EvaluationProfiler(bool start, bool eval, bool stop,
           .node = node,
           .graph = graph,
           .recent_window = recent_window,
+          .histograms = histograms,
+          .allocations = allocations,
       }) {}
 
 EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
@@ -200,6 +322,14 @@ EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
   result.scheduling_lag_total = state_->scheduling_lag_total;
   result.scheduling_lag_max = state_->scheduling_lag_max;
   result.scheduling_lag_samples = state_->scheduling_lag_samples;
+  if (state_->cycle_latency != nullptr) {
+    result.cycle_latency =
+        std::make_shared<const LatencyHistogram>(*state_->cycle_latency);
+  }
+  if (state_->scheduling_lag != nullptr) {
+    result.scheduling_lag =
+        std::make_shared<const LatencyHistogram>(*state_->scheduling_lag);
+  }
   if (result.wall_time > TimeDelta{0}) {
     result.runtime_load =
         static_cast<double>(result.root_evaluation_time.count()) /
@@ -212,6 +342,10 @@ EvaluationProfileSnapshot EvaluationProfiler::snapshot() const {
     EvaluationProfileEntry copy = entry.identity;
     copy.start = entry.start.snapshot;
     copy.evaluation = entry.evaluation.snapshot;
+    if (entry.evaluation.latency != nullptr) {
+      copy.evaluation.latency =
+          std::make_shared<const LatencyHistogram>(*entry.evaluation.latency);
+    }
     copy.stop = entry.stop.snapshot;
     result.entries.push_back(std::move(copy));
   }
@@ -233,6 +367,12 @@ void EvaluationProfiler::reset() {
   state_->scheduling_lag_total = TimeDelta{0};
   state_->scheduling_lag_max = TimeDelta{0};
   state_->scheduling_lag_samples = 0;
+  if (state_->cycle_latency != nullptr) {
+    *state_->cycle_latency = LatencyHistogram{};
+  }
+  if (state_->scheduling_lag != nullptr) {
+    *state_->scheduling_lag = LatencyHistogram{};
+  }
 }
 
 void EvaluationProfiler::on_before_start_graph(const GraphView &graph) {
@@ -245,7 +385,8 @@ void EvaluationProfiler::on_before_start_graph(const GraphView &graph) {
   }
   auto &entity = register_entity(*state_, state_->graph_entities, graph.data(),
                                  diagnostic::graph_path(graph),
-                                 diagnostic::graph_label(graph), true);
+                                 diagnostic::graph_label(graph), true,
+                                 options_.histograms);
   if (options_.start) {
     begin_phase(entity, ProfilePhase::Start);
   }
@@ -282,7 +423,8 @@ void EvaluationProfiler::on_before_start_node(const NodeView &node) {
   std::scoped_lock lock{state_->mutex};
   auto &entity = register_entity(*state_, state_->node_entities, node.data(),
                                  diagnostic::node_path(node),
-                                 diagnostic::node_label(node), false);
+                                 diagnostic::node_label(node), false,
+                                 options_.histograms);
   if (options_.start) {
     begin_phase(entity, ProfilePhase::Start);
   }
@@ -324,11 +466,17 @@ void EvaluationProfiler::on_before_graph_evaluation(const GraphView &graph) {
       state_->scheduling_lag_total += lag;
       state_->scheduling_lag_max = std::max(state_->scheduling_lag_max, lag);
       ++state_->scheduling_lag_samples;
+      if (state_->scheduling_lag != nullptr) {
+        state_->scheduling_lag->record(lag);
+      }
     }
   }
   if (options_.graph) {
     if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
       begin_phase(*entity, ProfilePhase::Evaluation);
+      if (options_.allocations) {
+        begin_allocations(*entity);
+      }
     }
   }
 }
@@ -337,9 +485,15 @@ void EvaluationProfiler::on_after_graph_evaluation(const GraphView &graph) {
   if (!options_.eval) {
     return;
   }
+  const AllocationCount allocated = options_.allocations
+                                        ? thread_allocation_count()
+                                        : AllocationCount{};
   std::scoped_lock lock{state_->mutex};
   if (options_.graph) {
     if (auto *entity = find_entity(state_->graph_entities, graph.data())) {
+      if (options_.allocations) {
+        end_allocations(*entity, allocated);
+      }
       end_phase(*entity, ProfilePhase::Evaluation, graph.failed_node().valid(),
                 options_.recent_window);
     }
@@ -347,8 +501,13 @@ void EvaluationProfiler::on_after_graph_evaluation(const GraphView &graph) {
   if (graph.is_root()) {
     ++state_->graph_cycles;
     if (state_->root_evaluation_started.has_value()) {
-      state_->root_evaluation_time +=
-          elapsed(*state_->root_evaluation_started, ProfileClock::now());
+      const ProfileClock::duration cycle =
+          ProfileClock::now() - *state_->root_evaluation_started;
+      state_->root_evaluation_time += std::chrono::duration_cast<TimeDelta>(cycle);
+      if (state_->cycle_latency != nullptr) {
+        state_->cycle_latency->record(
+            std::chrono::duration_cast<LatencyHistogram::Duration>(cycle));
+      }
       state_->root_evaluation_started.reset();
     }
   }
@@ -361,6 +520,9 @@ void EvaluationProfiler::on_before_node_evaluation(const NodeView &node) {
   std::scoped_lock lock{state_->mutex};
   if (auto *entity = find_entity(state_->node_entities, node.data())) {
     begin_phase(*entity, ProfilePhase::Evaluation);
+    if (options_.allocations) {
+      begin_allocations(*entity);
+    }
   }
 }
 
@@ -368,8 +530,15 @@ void EvaluationProfiler::on_after_node_evaluation(const NodeView &node) {
   if (!options_.eval || !options_.node) {
     return;
   }
+  // Read before any profiler work so none of it is charged to the node.
+  const AllocationCount allocated = options_.allocations
+                                        ? thread_allocation_count()
+                                        : AllocationCount{};
   std::scoped_lock lock{state_->mutex};
   if (auto *entity = find_entity(state_->node_entities, node.data())) {
+    if (options_.allocations) {
+      end_allocations(*entity, allocated);
+    }
     end_phase(*entity, ProfilePhase::Evaluation, failed_node_is(node),
               options_.recent_window);
   }
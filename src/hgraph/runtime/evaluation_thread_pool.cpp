@@ -0,0 +1,167 @@
+#include "evaluation_thread_pool.h"
+
+#include <hgraph/runtime/node.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace hgraph::runtime_detail
+{
+    namespace
+    {
+        thread_local bool running_pool_item = false;
+
+        /** Sets whether the calling thread runs pool items for its lifetime. */
+        class PoolItemScope
+        {
+          public:
+            explicit PoolItemScope(bool marked) noexcept : previous_(std::exchange(running_pool_item, marked)) {}
+            ~PoolItemScope() noexcept { running_pool_item = previous_; }
+
+            PoolItemScope(const PoolItemScope &)            = delete;
+            PoolItemScope &operator=(const PoolItemScope &) = delete;
+
+          private:
+            bool previous_;
+        };
+    }  // namespace
+
+    bool EvaluationThreadPool::in_job() noexcept { return running_pool_item; }
+
+    bool concurrent_evaluation_safe(const NodeTypeMetaData &schema) noexcept
+    {
+        return !schema.uses_python_values && !schema.uses_global_state && !schema.requires_phase_runner;
+    }
+
+    EvaluationThreadPool::EvaluationThreadPool(std::size_t concurrency, bool independent_items)
+        : ranges_(std::make_unique<Range[]>(std::max<std::size_t>(concurrency, 1))), independent_items_(independent_items)
+    {
+        const std::size_t workers = concurrency > 1 ? concurrency - 1 : 0;
+        workers_.reserve(workers);
+        try
+        {
+            for (std::size_t participant = 1; participant <= workers; ++participant)
+            {
+                workers_.emplace_back([this, participant] { worker_loop(participant); });
+            }
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard lock{mutex_};
+                stopping_ = true;
+            }
+            wake_.notify_all();
+            for (auto &worker : workers_) { worker.join(); }
+            throw;
+        }
+    }
+
+    EvaluationThreadPool::~EvaluationThreadPool()
+    {
+        {
+            std::lock_guard lock{mutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) { worker.join(); }
+    }
+
+    void EvaluationThreadPool::run(std::size_t count, Task task, void *context)
+    {
+        if (count == 0) { return; }
+        if (workers_.empty() || count == 1)
+        {
+            PoolItemScope item_scope{!independent_items_};
+            for (std::size_t index = 0; index < count; ++index) { task(context, index); }
+            return;
+        }
+
+        const std::size_t participants = concurrency();
+        const std::size_t chunk        = count / participants;
+        const std::size_t remainder    = count % participants;
+        std::size_t       begin        = 0;
+        for (std::size_t participant = 0; participant < participants; ++participant)
+        {
+            const std::size_t size = chunk + (participant < remainder ? 1 : 0);
+            ranges_[participant].next.store(begin, std::memory_order_relaxed);
+            ranges_[participant].end = begin + size;
+            begin += size;
+        }
+        task_        = task;
+        context_     = context;
+        error_ = nullptr;
+        error_index_.store(std::numeric_limits<std::size_t>::max(), std::memory_order_relaxed);
+
+        {
+            std::lock_guard lock{mutex_};
+            active_workers_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        participate(0);
+
+        {
+            std::unique_lock lock{mutex_};
+            done_.wait(lock, [&] { return active_workers_ == 0; });
+        }
+        task_    = nullptr;
+        context_ = nullptr;
+        if (error_ != nullptr) { std::rethrow_exception(std::exchange(error_, nullptr)); }
+    }
+
+    void EvaluationThreadPool::worker_loop(std::size_t participant)
+    {
+        std::uint64_t seen = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock lock{mutex_};
+                wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) { return; }
+                seen = generation_;
+            }
+            participate(participant);
+            {
+                std::lock_guard lock{mutex_};
+                if (--active_workers_ == 0) { done_.notify_one(); }
+            }
+        }
+    }
+
+    void EvaluationThreadPool::participate(std::size_t participant) noexcept
+    {
+        PoolItemScope item_scope{!independent_items_};
+        const std::size_t participants = concurrency();
+        for (std::size_t offset = 0; offset < participants; ++offset)
+        {
+            Range &range = ranges_[(participant + offset) % participants];
+            for (;;)
+            {
+                const std::size_t index = range.next.fetch_add(1, std::memory_order_relaxed);
+                if (index >= range.end) { break; }
+                if (index > error_index_.load(std::memory_order_relaxed)) { continue; }
+                try
+                {
+                    task_(context_, index);
+                }
+                catch (...)
+                {
+                    record_failure(index, std::current_exception());
+                }
+            }
+        }
+    }
+
+    void EvaluationThreadPool::record_failure(std::size_t index, std::exception_ptr error) noexcept
+    {
+        std::lock_guard lock{error_mutex_};
+        if (index < error_index_.load(std::memory_order_relaxed))
+        {
+            error_ = std::move(error);
+            error_index_.store(index, std::memory_order_relaxed);
+        }
+    }
+}  // namespace hgraph::runtime_detail
@@ -0,0 +1,122 @@
+#ifndef HGRAPH_RUNTIME_EVALUATION_THREAD_POOL_H
+#define HGRAPH_RUNTIME_EVALUATION_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hgraph
+{
+    class GraphView;
+    struct NodeTypeMetaData;
+}  // namespace hgraph
+
+namespace hgraph::runtime_detail
+{
+    /**
+     * Fork-join pool used by the runtime to evaluate independent work items of
+     * one cycle concurrently (rank levels of a root graph, keyed child graphs).
+     *
+     * ``parallel_for`` splits ``[0, count)`` into one contiguous range per
+     * participant. A participant drains its own range first and then steals
+     * the remaining indices of its peers, so uneven item costs balance without
+     * a shared queue. The calling thread is a participant; the pool owns
+     * ``concurrency - 1`` workers which sleep between jobs.
+     *
+     * Exceptions are captured per item. Once an item has failed, unclaimed
+     * items after it are skipped while items before it still run, and the
+     * failure with the lowest index is rethrown on the calling thread: the
+     * failure a sequential walk in index order would have stopped at.
+     *
+     * A pool runs one job at a time and is driven from a single thread.
+     *
+     * With ``independent_items`` each item is a whole run of its own (a sweep
+     * executor) rather than part of an enclosing cycle, so threads running
+     * one are not marked as pool items and ``in_job`` stays false for them.
+     */
+    class EvaluationThreadPool
+    {
+      public:
+        explicit EvaluationThreadPool(std::size_t concurrency, bool independent_items = false);
+        ~EvaluationThreadPool();
+
+        EvaluationThreadPool(const EvaluationThreadPool &)            = delete;
+        EvaluationThreadPool &operator=(const EvaluationThreadPool &) = delete;
+        EvaluationThreadPool(EvaluationThreadPool &&)                 = delete;
+        EvaluationThreadPool &operator=(EvaluationThreadPool &&)      = delete;
+
+        /** True while the calling thread runs an item of a pool job (items of independent pools excluded). */
+        [[nodiscard]] static bool in_job() noexcept;
+
+        /** Participants per job, including the calling thread. */
+        [[nodiscard]] std::size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+        /** Invoke ``fn(index)`` for every index in ``[0, count)`` and wait for all of them. */
+        template <typename Fn>
+        void parallel_for(std::size_t count, Fn &&fn)
+        {
+            using Callable = std::remove_reference_t<Fn>;
+            run(count,
+                [](void *context, std::size_t index) { (*static_cast<Callable *>(context))(index); },
+                const_cast<void *>(static_cast<const void *>(std::addressof(fn))));
+        }
+
+      private:
+        using Task = void (*)(void *, std::size_t);
+
+        struct alignas(64) Range
+        {
+            std::atomic<std::size_t> next{0};
+            std::size_t              end{0};
+        };
+
+        void run(std::size_t count, Task task, void *context);
+        void worker_loop(std::size_t participant);
+        void participate(std::size_t participant) noexcept;
+        void record_failure(std::size_t index, std::exception_ptr error) noexcept;
+
+        std::unique_ptr<Range[]> ranges_;
+        std::vector<std::thread> workers_{};
+
+        std::mutex              mutex_{};
+        std::condition_variable wake_{};
+        std::condition_variable done_{};
+        std::uint64_t           generation_{0};
+        std::size_t             active_workers_{0};
+        bool                    stopping_{false};
+
+        bool independent_items_{false};
+
+        Task  task_{nullptr};
+        void *context_{nullptr};
+
+        /** Lowest failed index of the current job; ``SIZE_MAX`` when none. */
+        std::atomic<std::size_t> error_index_{std::numeric_limits<std::size_t>::max()};
+        std::mutex               error_mutex_{};
+        std::exception_ptr       error_{};
+    };
+
+    /**
+     * Pool of the root graph above ``graph``, or null when the root evaluates
+     * sequentially or the calling thread already runs a pool item: jobs do
+     * not nest, so work reached from inside one stays on its thread.
+     */
+    [[nodiscard]] EvaluationThreadPool *evaluation_thread_pool(const GraphView &graph);
+
+    /**
+     * Whether a node of ``schema`` may evaluate off the run thread: it must
+     * touch no Python values, global state or phase runner. Callers add their
+     * own node-kind and binding restrictions.
+     */
+    [[nodiscard]] bool concurrent_evaluation_safe(const NodeTypeMetaData &schema) noexcept;
+}  // namespace hgraph::runtime_detail
+
+#endif  // HGRAPH_RUNTIME_EVALUATION_THREAD_POOL_H
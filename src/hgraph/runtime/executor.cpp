@@ -2,6 +2,7 @@
 #include <hgraph/runtime/executor.h>
 
 #include "registry_snapshot_detail.h"
+#include "thread_affinity.h"
 
 #include <hgraph/runtime/lifecycle_observer.h>
 #include <hgraph/runtime/logger.h>
@@ -22,6 +23,7 @@
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -58,13 +60,16 @@ namespace hgraph
         {
             SimulationExecutorStorage(const GraphExecutorBuilder &builder,
                                       ExecutorTypeRef type,
-                                      void *executor_memory)
+                                      void *executor_memory,
+                                      DateTime run_start,
+                                      DateTime run_end)
                 : logger(builder.logger() != nullptr ? builder.logger()
                                                      : log::shared_logger()),
                   logger_ops(&builder.logger_ops()),
+                  parallel_evaluation_threads(builder.parallel_evaluation_threads()),
                   graph(builder.graph_builder().make_root_graph(type.writable(executor_memory))),
-                  start_time(builder.start_time()),
-                  end_time(builder.end_time()),
+                  start_time(run_start),
+                  end_time(run_end),
                   evaluation_time(start_time),
                   cycle_wall_start(current_wall_time()),
                   error_capture_options(builder.error_capture_options()),
@@ -87,6 +92,7 @@ namespace hgraph
             LifecycleObserverList lifecycle_observers{}; // declared first so it is constructed before graph
             std::shared_ptr<spdlog::logger> logger{};
             const LoggerOps *logger_ops{&plain_logger_ops()};
+            std::size_t      parallel_evaluation_threads{0};  // read by the root graph's constructor
             GraphValue       graph{};
             DateTime         start_time{MIN_ST};
             DateTime         end_time{MAX_ET};
@@ -110,13 +116,16 @@ namespace hgraph
         {
             RealTimeExecutorStorage(const GraphExecutorBuilder &builder,
                                     ExecutorTypeRef type,
-                                    void *executor_memory)
+                                    void *executor_memory,
+                                    DateTime run_start,
+                                    DateTime run_end)
                 : logger(builder.logger() != nullptr ? builder.logger()
                                                      : log::shared_logger()),
                   logger_ops(&builder.logger_ops()),
+                  parallel_evaluation_threads(builder.parallel_evaluation_threads()),
                   graph(builder.graph_builder().make_root_graph(type.writable(executor_memory))),
-                  start_time(builder.start_time()),
-                  end_time(builder.end_time()),
+                  start_time(run_start),
+                  end_time(run_end),
                   evaluation_time(start_time),
                   error_capture_options(builder.error_capture_options()),
                   cleanup_on_error(builder.cleanup_on_error()),
@@ -125,6 +134,9 @@ namespace hgraph
             {
                 immediate_cycle_limit = builder.max_consecutive_immediate_cycles();
                 max_wait_slice        = builder.max_wait_slice();
+                wait_strategy         = builder.wait_strategy();
+                spin_budget           = builder.spin_budget();
+                evaluation_cpus       = builder.evaluation_cpus();
                 for (LifecycleObserver *observer : builder.lifecycle_observers()) { lifecycle_observers.add(observer); }
             }
 
@@ -138,11 +150,15 @@ namespace hgraph
             LifecycleObserverList lifecycle_observers{}; // declared first so it is constructed before graph
             std::shared_ptr<spdlog::logger> logger{};
             const LoggerOps               *logger_ops{&plain_logger_ops()};
+            std::size_t                  parallel_evaluation_threads{0};  // read by the root graph's constructor
             GraphValue                   graph{};
             DateTime                     start_time{MIN_ST};
             DateTime                     end_time{MAX_ET};
             DateTime                     evaluation_time{MIN_ST};
             TimeDelta                    max_wait_slice{10'000'000};
+            RealTimeWaitStrategy         wait_strategy{RealTimeWaitStrategy::Block};
+            TimeDelta                    spin_budget{50};
+            std::vector<std::size_t>     evaluation_cpus{};
             std::uint32_t                immediate_cycle_limit{0};
             std::uint32_t                consecutive_immediate_cycles{0};
             ErrorCaptureOptions          error_capture_options{};
@@ -155,7 +171,11 @@ namespace hgraph
             mutable std::mutex           mutex{};
             std::condition_variable      condition{};
             std::atomic_bool             stop_requested{false};
-            bool                         push_update_pending{false};
+            // Set by producers without the mutex so a polling run loop sees
+            // it directly. ``waiting`` is raised (under the mutex) while the
+            // run loop may block; only then must a producer notify.
+            std::atomic_bool             push_update_pending{false};
+            std::atomic_bool             waiting{false};
             GraphExecutorPhaseRunner     phase_runner{};
             bool                         run_logging_enabled{false};
         };
@@ -332,28 +352,28 @@ namespace hgraph
         void realtime_mark_push_update_pending_impl(const void *, void *memory)
         {
             auto &state = realtime_storage(memory);
+            if (state.stop_requested.load(std::memory_order_acquire)) { return; }
+            // Both sides are sequentially consistent: either this load sees
+            // ``waiting``, or the run loop's predicate (evaluated after it
+            // raised ``waiting``) sees the pending flag.
+            state.push_update_pending.store(true, std::memory_order_seq_cst);
+            if (!state.waiting.load(std::memory_order_seq_cst)) { return; }
             {
+                // The run loop holds the mutex from raising ``waiting`` until
+                // it sleeps, so taking it here orders the notify after that.
                 std::lock_guard lock{state.mutex};
-                if (state.stop_requested.load(std::memory_order_acquire)) { return; }
-                state.push_update_pending = true;
             }
             state.condition.notify_all();
         }
 
         bool realtime_is_push_update_pending_impl(const void *, void *memory) noexcept
         {
-            auto &state = realtime_storage(memory);
-            std::lock_guard lock{state.mutex};
-            return state.push_update_pending;
+            return realtime_storage(memory).push_update_pending.load(std::memory_order_acquire);
         }
 
         bool realtime_reset_push_update_pending_impl(const void *, void *memory) noexcept
         {
-            auto &state = realtime_storage(memory);
-            std::lock_guard lock{state.mutex};
-            const bool pending = state.push_update_pending;
-            state.push_update_pending = false;
-            return pending;
+            return realtime_storage(memory).push_update_pending.exchange(false, std::memory_order_acq_rel);
         }
 
         [[nodiscard]] DateTime advance_simulation(SimulationExecutorStorage &state, DateTime next_scheduled_time)
@@ -373,6 +393,61 @@ namespace hgraph
         // loop exceeds it almost immediately.
         constexpr std::uint32_t max_immediate_drain_cycles = 1024;
 
+        [[nodiscard]] bool realtime_wake_requested(const RealTimeExecutorStorage &state) noexcept
+        {
+            return state.push_update_pending.load(std::memory_order_seq_cst) ||
+                   state.stop_requested.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Wait until ``target``, a push wake or a stop, following the
+         * configured ``RealTimeWaitStrategy``; returns the wall clock read
+         * last. A push delivered while the previous cycle was evaluating is
+         * already pending, so this does not wait at all.
+         */
+        [[nodiscard]] DateTime wait_realtime(RealTimeExecutorStorage &state, DateTime target)
+        {
+            DateTime wall_now = current_wall_time();
+            if (state.wait_strategy != RealTimeWaitStrategy::Block)
+            {
+                const DateTime spin_end = state.wait_strategy == RealTimeWaitStrategy::Spin
+                                              ? target
+                                              : std::min(target, wall_now + state.spin_budget);
+                while (wall_now < spin_end && !realtime_wake_requested(state))
+                {
+                    runtime_detail::cpu_relax();
+                    wall_now = current_wall_time();
+                }
+                if (state.wait_strategy == RealTimeWaitStrategy::SpinThenYield)
+                {
+                    while (wall_now < target && !realtime_wake_requested(state))
+                    {
+                        std::this_thread::yield();
+                        wall_now = current_wall_time();
+                    }
+                }
+                if (state.wait_strategy != RealTimeWaitStrategy::SpinThenBlock) { return wall_now; }
+            }
+
+            std::unique_lock lock{state.mutex};
+            state.waiting.store(true, std::memory_order_seq_cst);
+            const auto wake_requested = [&state] { return realtime_wake_requested(state); };
+            while (wall_now < target && !wake_requested())
+            {
+                // The predicate overload absorbs spurious wakes. A false
+                // return is the forced slice timeout; it only refreshes
+                // wall_now and loops unless target has become due.
+                const bool wake_requested_before_timeout = state.condition.wait_for(
+                    lock,
+                    std::min(target - wall_now, state.max_wait_slice),
+                    wake_requested);
+                wall_now = current_wall_time();
+                if (wake_requested_before_timeout) { break; }
+            }
+            state.waiting.store(false, std::memory_order_relaxed);
+            return wall_now;
+        }
+
         [[nodiscard]] DateTime advance_realtime(RealTimeExecutorStorage &state, DateTime next_scheduled_time)
         {
             // Whichever comes first bounds this cycle: the next scheduled work
@@ -383,28 +458,7 @@ namespace hgraph
             const DateTime target     = std::min(next_scheduled_time, state.end_time);
             const DateTime next_cycle = state.evaluation_time + MIN_TD;
 
-            DateTime wall_now = current_wall_time();
-            {
-                std::unique_lock lock{state.mutex};
-                const auto wake_requested = [&state] {
-                    return state.push_update_pending ||
-                           state.stop_requested.load(std::memory_order_acquire);
-                };
-                // A push delivered while the previous cycle was evaluating is
-                // already pending, so this does not wait at all.
-                while (wall_now < target && !wake_requested())
-                {
-                    // The predicate overload absorbs spurious wakes. A false
-                    // return is the forced slice timeout; it only refreshes
-                    // wall_now and loops unless target has become due.
-                    const bool wake_requested_before_timeout = state.condition.wait_for(
-                        lock,
-                        std::min(target - wall_now, state.max_wait_slice),
-                        wake_requested);
-                    wall_now = current_wall_time();
-                    if (wake_requested_before_timeout) { break; }
-                }
-            }
+            const DateTime wall_now   = wait_realtime(state, target);
 
             // This cycle's evaluation time, from two rules in strict
             // precedence order.
@@ -683,6 +737,7 @@ namespace hgraph
         void realtime_run_impl(const void *, const GraphExecutorView &executor)
         {
             auto &state = realtime_storage(executor.data());
+            const runtime_detail::ThreadAffinityScope affinity{state.evaluation_cpus};
             run_storage(state,
                         [](RealTimeExecutorStorage &storage, DateTime next) {
                             return advance_realtime(storage, next);
@@ -828,6 +883,18 @@ namespace hgraph
             return realtime_storage(memory).cleanup_on_error;
         }
 
+        std::size_t simulation_parallel_evaluation_threads_impl(const void *,
+                                                                const void *memory) noexcept
+        {
+            return simulation_storage(memory).parallel_evaluation_threads;
+        }
+
+        std::size_t realtime_parallel_evaluation_threads_impl(const void *,
+                                                              const void *memory) noexcept
+        {
+            return realtime_storage(memory).parallel_evaluation_threads;
+        }
+
         [[nodiscard]] GraphExecutorOps simulation_executor_ops(const ExecutorRuntimeContext *context)
         {
             return GraphExecutorOps{
@@ -849,6 +916,7 @@ namespace hgraph
                 .run_logging_enabled_impl = &simulation_run_logging_enabled_impl,
                 .error_capture_options_impl = &simulation_error_capture_options_impl,
                 .cleanup_on_error_impl = &simulation_cleanup_on_error_impl,
+                .parallel_evaluation_threads_impl = &simulation_parallel_evaluation_threads_impl,
             };
         }
 
@@ -873,6 +941,7 @@ namespace hgraph
                 .run_logging_enabled_impl = &realtime_run_logging_enabled_impl,
                 .error_capture_options_impl = &realtime_error_capture_options_impl,
                 .cleanup_on_error_impl = &realtime_cleanup_on_error_impl,
+                .parallel_evaluation_threads_impl = &realtime_parallel_evaluation_threads_impl,
             };
         }
 
@@ -1302,6 +1371,13 @@ namespace hgraph
                ops().cleanup_on_error_impl(ops().context, data());
     }
 
+    std::size_t GraphExecutorView::parallel_evaluation_threads() const noexcept
+    {
+        return valid() && ops().parallel_evaluation_threads_impl != nullptr
+                   ? ops().parallel_evaluation_threads_impl(ops().context, data())
+                   : 0;
+    }
+
     void GraphExecutorView::run() const
     {
         if (!valid()) { throw std::logic_error("GraphExecutorView::run requires a live executor"); }
@@ -1331,6 +1407,13 @@ namespace hgraph
     GraphExecutorValue::GraphExecutorValue() noexcept = default;
 
     GraphExecutorValue::GraphExecutorValue(const GraphExecutorBuilder &builder)
+        : GraphExecutorValue(builder, builder.start_time(), builder.end_time())
+    {
+    }
+
+    GraphExecutorValue::GraphExecutorValue(const GraphExecutorBuilder &builder,
+                                           DateTime start_time,
+                                           DateTime end_time)
     {
         if (builder.mode() != GraphExecutorMode::RealTime &&
             graph_has_push_sources(builder.graph_builder()))
@@ -1343,10 +1426,12 @@ namespace hgraph
             switch (builder.mode())
             {
                 case GraphExecutorMode::Simulation:
-                    std::construct_at(MemoryUtils::cast<SimulationExecutorStorage>(dst), builder, type, dst);
+                    std::construct_at(MemoryUtils::cast<SimulationExecutorStorage>(dst), builder, type, dst,
+                                      start_time, end_time);
                     return;
                 case GraphExecutorMode::RealTime:
-                    std::construct_at(MemoryUtils::cast<RealTimeExecutorStorage>(dst), builder, type, dst);
+                    std::construct_at(MemoryUtils::cast<RealTimeExecutorStorage>(dst), builder, type, dst,
+                                      start_time, end_time);
                     return;
             }
             throw std::logic_error("Unknown graph executor mode");
@@ -1434,6 +1519,26 @@ namespace hgraph
         return *this;
     }
 
+    GraphExecutorBuilder &GraphExecutorBuilder::wait_strategy(RealTimeWaitStrategy strategy,
+                                                              TimeDelta spin_budget) noexcept
+    {
+        wait_strategy_ = strategy;
+        spin_budget_   = spin_budget > TimeDelta::zero() ? spin_budget : TimeDelta{50};
+        return *this;
+    }
+
+    GraphExecutorBuilder &GraphExecutorBuilder::evaluation_cpus(std::vector<std::size_t> cpus)
+    {
+        evaluation_cpus_ = std::move(cpus);
+        return *this;
+    }
+
+    GraphExecutorBuilder &GraphExecutorBuilder::parallel_evaluation(std::size_t threads) noexcept
+    {
+        parallel_evaluation_threads_ = threads;
+        return *this;
+    }
+
     GraphExecutorBuilder &GraphExecutorBuilder::phase_runner(GraphExecutorPhaseRunner runner)
     {
         phase_runner_ = std::move(runner);
@@ -1513,6 +1618,26 @@ namespace hgraph
         return max_wait_slice_;
     }
 
+    RealTimeWaitStrategy GraphExecutorBuilder::wait_strategy() const noexcept
+    {
+        return wait_strategy_;
+    }
+
+    TimeDelta GraphExecutorBuilder::spin_budget() const noexcept
+    {
+        return spin_budget_;
+    }
+
+    const std::vector<std::size_t> &GraphExecutorBuilder::evaluation_cpus() const noexcept
+    {
+        return evaluation_cpus_;
+    }
+
+    std::size_t GraphExecutorBuilder::parallel_evaluation_threads() const noexcept
+    {
+        return parallel_evaluation_threads_;
+    }
+
     const std::vector<LifecycleObserver *> &GraphExecutorBuilder::lifecycle_observers() const noexcept
     {
         return lifecycle_observers_;
@@ -1534,6 +1659,11 @@ namespace hgraph
         return GraphExecutorValue{*this};
     }
 
+    GraphExecutorValue GraphExecutorBuilder::make_executor(DateTime start_time, DateTime end_time) const
+    {
+        return GraphExecutorValue{*this, start_time, end_time};
+    }
+
     void clear_executor_runtime_types() noexcept
     {
         executor_runtime_registry().clear();
@@ -1,5 +1,6 @@
 #include <hgraph/runtime/graph.h>
 
+#include "evaluation_thread_pool.h"
 #include "registry_snapshot_detail.h"
 
 #include <hgraph/types/metadata/type_realization.h>
@@ -10,19 +11,24 @@
 #include <hgraph/types/metadata/debug_descriptor.h>
 #include <hgraph/types/metadata/type_record_registry.h>
 #include <hgraph/types/time_series/ts_output.h>
+#include <hgraph/types/utils/storage_arena.h>
 #include <hgraph/util/scope.h>
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace hgraph {
 namespace {
@@ -151,6 +157,90 @@ output_at_path(TSOutputView view, const std::vector<std::size_t> &path) {
   return view;
 }
 
+/**
+ * Graphs at or above this node count evaluate from a ready set instead of
+ * scanning every schedule slot per cycle. Small graphs (typical per-key
+ * nested graphs) keep the dense scan: it touches one cache line or two and
+ * needs no allocation.
+ */
+inline constexpr std::size_t sparse_schedule_min_nodes = 64;
+
+/**
+ * Sparse scheduling index for large graphs.
+ *
+ * The per-node schedule array stays authoritative; this index only tells the
+ * cycle where to look. ``ready`` holds one bit per node due at the current
+ * evaluation time and is consumed in rank order. ``pending`` is a min-heap of
+ * (time, node) entries for everything else. Heap entries are validated
+ * lazily against the schedule slot, so a reschedule never searches the heap:
+ * superseded entries are discarded when they surface.
+ */
+struct SparseScheduleState {
+  struct Pending {
+    DateTime when{};
+    std::size_t node_index{0};
+
+    [[nodiscard]] friend bool operator>(const Pending &lhs,
+                                        const Pending &rhs) noexcept {
+      return lhs.when != rhs.when ? lhs.when > rhs.when
+                                  : lhs.node_index > rhs.node_index;
+    }
+  };
+
+  void mark_ready(std::size_t node_index, std::size_t node_count) {
+    if (ready.empty()) {
+      ready.resize((node_count + 63) / 64, 0);
+    }
+    ready[node_index / 64] |= std::uint64_t{1} << (node_index % 64);
+  }
+
+  void clear_ready(std::size_t node_index) noexcept {
+    ready[node_index / 64] &= ~(std::uint64_t{1} << (node_index % 64));
+  }
+
+  /** First ready node at or after ``from``; ``node_count`` when none. */
+  [[nodiscard]] std::size_t next_ready(std::size_t from,
+                                       std::size_t node_count) const noexcept {
+    std::size_t word = from / 64;
+    if (word >= ready.size()) {
+      return node_count;
+    }
+    std::uint64_t bits = ready[word] & (~std::uint64_t{0} << (from % 64));
+    while (bits == 0) {
+      if (++word == ready.size()) {
+        return node_count;
+      }
+      bits = ready[word];
+    }
+    return std::min(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)),
+                    node_count);
+  }
+
+  void push_pending(DateTime when, std::size_t node_index) {
+    pending.push_back(Pending{.when = when, .node_index = node_index});
+    std::push_heap(pending.begin(), pending.end(), std::greater<>{});
+  }
+
+  void pop_pending() noexcept {
+    std::pop_heap(pending.begin(), pending.end(), std::greater<>{});
+    pending.pop_back();
+  }
+
+  /** Ready-set key of a node: its index, or its level position when the
+      root graph evaluates by rank level (see ``RankLevelPlan``). */
+  [[nodiscard]] std::size_t key(std::size_t node_index) const noexcept {
+    return position != nullptr ? (*position)[node_index] : node_index;
+  }
+
+  std::vector<std::uint64_t> ready{};
+  std::vector<Pending> pending{};
+  /** Node index -> key; null keys the ready set by node index. */
+  const std::vector<std::size_t> *position{nullptr};
+  /** With ``position`` set: the lowest key a current-cycle schedule may still
+      join, i.e. the first key after the level being evaluated. */
+  std::size_t ready_floor{0};
+};
+
 struct GraphRuntimeBaseStorage {
   GraphRuntimeBaseStorage() = default;
 
@@ -168,6 +258,9 @@ struct GraphRuntimeBaseStorage {
   bool started{false};
   bool starting{false};
   bool stopping{false};
+  /** Set once ``stop`` has unbound the wired edges; the next ``start``
+      rebinds them (see start_impl). */
+  bool edges_unbound{false};
   bool evaluating{false};
   bool evaluation_failed{false};
   /** Graph traits (parent-chained key-value metadata; GraphView::trait_or).
@@ -186,7 +279,36 @@ struct GraphRuntimeBaseStorage {
   spdlog::logger *logger{nullptr};
   /** Selected with ``logger`` and cached through nested graphs in O(1). */
   const LoggerOps *logger_ops{nullptr};
+  /** Nested-graph storage allocator: the root's arena when its builder
+      enabled one, else the default allocator. Nested graphs copy their
+      parent's pointer. */
+  const MemoryUtils::AllocatorOps *storage_allocator{&MemoryUtils::allocator()};
   const TypeRealizationSnapshot *type_realization{nullptr};
+  /** Used only when the layout selects sparse scheduling; empty otherwise. */
+  SparseScheduleState sparse_schedule{};
+};
+
+/**
+ * Run-thread state of a root graph configured for parallel evaluation
+ * (``GraphExecutorBuilder::parallel_evaluation``): the pool shared by its
+ * rank-level walk and by keyed child graphs below it, and the level scratch.
+ */
+struct ParallelEvaluation {
+  explicit ParallelEvaluation(std::size_t threads) : pool(threads) {}
+
+  runtime_detail::EvaluationThreadPool pool;
+  /** Serialises schedule_node while a level is evaluated concurrently. */
+  std::mutex schedule_mutex{};
+  /** Serialises TSData notification from a concurrent level: nodes of one
+      level may share a downstream consumer, whose input tracking each of
+      them notifies (see ``TSNotificationLockScope``). */
+  std::mutex notification_mutex{};
+  bool concurrent_level{false};
+  /** Scratch, reused across cycles: due nodes of the current level (index
+      order), the concurrent subset, and per-item batch outcomes. */
+  std::vector<std::size_t> due{};
+  std::vector<std::size_t> batch{};
+  std::vector<unsigned char> outcome{};
 };
 
 struct RootGraphRuntimeStorage : GraphRuntimeBaseStorage {
@@ -196,8 +318,15 @@ struct RootGraphRuntimeStorage : GraphRuntimeBaseStorage {
     return GraphExecutorView{root_executor_ptr};
   }
 
+  /** Backs nested-graph storage when the builder enabled an arena. Declared
+      first so it is destroyed last: the header outlives the node tuple, and
+      node storage returns its blocks here on destruction. */
+  std::unique_ptr<StorageArena> arena{};
   GlobalState global_state{};
   ExecutorPtr root_executor_ptr{};
+  /** Present only when the executor opted into parallel evaluation; the
+      rank-level walk additionally needs a usable level plan. */
+  std::unique_ptr<ParallelEvaluation> parallel{};
 };
 
 struct NestedGraphRuntimeStorage : GraphRuntimeBaseStorage {
@@ -210,6 +339,9 @@ struct NestedGraphRuntimeStorage : GraphRuntimeBaseStorage {
       so the parent can track WHICH child is due without scanning slots. */
   void (*child_schedule_observer)(void *, DateTime) = nullptr;
   void *child_schedule_observer_context = nullptr;
+  /** Node storage destroyed by ``GraphValue::clear_nodes``; only the header,
+      schedule and compound-storage view remain constructed. */
+  bool nodes_cleared{false};
 };
 
 inline constexpr std::string_view graph_header_field_name{"header"};
@@ -229,11 +361,34 @@ struct GraphRuntimeStorageLayout {
   std::size_t compound_scalar_storage_offset{invalid_cursor};
   std::size_t schedule_offset{0};
   std::size_t schedule_stride{0};
+  bool sparse_schedule{false};
+};
+
+/**
+ * Dependency levels of a root graph, used by parallel evaluation. A node's
+ * level is one more than the deepest producer wired into it, so no edge
+ * joins two nodes of one level. Ready-set keys order the nodes by (level,
+ * index); the push-source prefix keeps its indices because its own pass
+ * drives it.
+ */
+struct RankLevelPlan {
+  /** Node index -> ready-set key. */
+  std::vector<std::size_t> position{};
+  /** Ready-set key -> node index. */
+  std::vector<std::size_t> node_at{};
+  /** Ready-set key -> one past the last key of its level. */
+  std::vector<std::size_t> level_end{};
+  /** Node index -> may be evaluated off the run thread. */
+  std::vector<bool> concurrent{};
+  /** False when the graph cannot be levelled (see rank_level_plan_for). */
+  bool available{false};
 };
 
 struct GraphRuntimeContext {
   GraphRuntimeStorageLayout layout{};
   std::vector<GraphNodeRuntimeLocation> node_locations{};
+  /** Root contexts only. */
+  RankLevelPlan levels{};
 };
 
 [[nodiscard]] const GraphRuntimeContext &graph_context(const void *context) {
@@ -308,6 +463,7 @@ graph_runtime_context_for(const MemoryUtils::StoragePlan &plan,
                                       : invalid_cursor,
       .schedule_offset = schedule.offset,
       .schedule_stride = schedule.plan->array_stride(),
+      .sparse_schedule = node_builders.size() >= sparse_schedule_min_nodes,
   };
   context.node_locations.reserve(node_builders.size());
   for (std::size_t index = 0; index < node_builders.size(); ++index) {
@@ -605,9 +761,21 @@ void construct_graph_storage(GraphTypeRef type, const GraphBuilder &builder,
   rollback.release();
 }
 
+[[nodiscard]] bool nested_nodes_cleared(GraphTypeRef type,
+                                        const void *memory) {
+  if (type.ops_ref().parent_kind != GraphParentKind::Nested) {
+    return false;
+  }
+  return graph_header<NestedGraphRuntimeStorage>(
+             graph_context(type.ops_ref().context), memory)
+      .nodes_cleared;
+}
+
 void propagate_nested_parent_schedule(NestedGraphRuntimeStorage &state) {
   const DateTime next = state.next_scheduled_time;
-  if (next >= MAX_DT) {
+  // A child evaluated on a pool thread leaves its parent's schedule alone:
+  // the owning node collects the child's next time once the job completes.
+  if (next >= MAX_DT || runtime_detail::EvaluationThreadPool::in_job()) {
     return;
   }
 
@@ -636,10 +804,98 @@ compute_push_source_nodes_end(const GraphBuilder &builder) {
   return prefix;
 }
 
+/**
+ * Level the nodes after the push-source prefix for parallel evaluation.
+ * Only native compute and sink nodes that touch no Python values, global
+ * state or phase runner may run off the run thread. No plan is produced
+ * when the graph pools compound scalars (allocation goes through a
+ * run-thread scope), when an edge does not point forward in rank order, when
+ * any endpoint carries a REF (a reference binds an input to an output
+ * outside the wired edges, so levels no longer bound what a node reads), or
+ * when no level holds two concurrent nodes.
+ */
+[[nodiscard]] RankLevelPlan rank_level_plan_for(const GraphBuilder &builder,
+                                                std::size_t first_normal_node,
+                                                bool pooled_storage) {
+  const std::size_t node_count = builder.nodes().size();
+  if (pooled_storage || node_count < first_normal_node + 2) {
+    return {};
+  }
+
+  std::vector<bool> concurrent(node_count, false);
+  for (std::size_t index = 0; index < node_count; ++index) {
+    const NodeTypeMetaData *schema = builder.nodes()[index].type().schema();
+    if (TypeRegistry::contains_ref(schema->input_schema) ||
+        TypeRegistry::contains_ref(schema->output_schema)) {
+      return {};
+    }
+    concurrent[index] = index >= first_normal_node &&
+                        (schema->node_kind == NodeKind::Compute ||
+                         schema->node_kind == NodeKind::Sink) &&
+                        runtime_detail::concurrent_evaluation_safe(*schema);
+  }
+
+  // Sources precede targets, so visiting edges by target finalises every
+  // source's level before it is read.
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+  edges.reserve(builder.edges().size());
+  for (const GraphEdge &edge : builder.edges()) {
+    if (edge.source_node >= edge.target_node) {
+      return {};
+    }
+    edges.emplace_back(edge.target_node, edge.source_node);
+  }
+  std::sort(edges.begin(), edges.end());
+  std::vector<std::size_t> level(node_count, 0);
+  for (const auto &[target, source] : edges) {
+    level[target] = std::max(level[target], level[source] + 1);
+  }
+
+  RankLevelPlan plan;
+  plan.node_at.resize(node_count);
+  for (std::size_t index = 0; index < node_count; ++index) {
+    plan.node_at[index] = index;
+  }
+  std::stable_sort(plan.node_at.begin() +
+                       static_cast<std::ptrdiff_t>(first_normal_node),
+                   plan.node_at.end(), [&](std::size_t lhs, std::size_t rhs) {
+                     return level[lhs] < level[rhs];
+                   });
+  plan.position.resize(node_count);
+  plan.level_end.resize(node_count);
+  for (std::size_t key = 0; key < first_normal_node; ++key) {
+    plan.position[key] = key;
+    plan.level_end[key] = key + 1;
+  }
+  for (std::size_t begin = first_normal_node; begin < node_count;) {
+    std::size_t end = begin;
+    std::size_t concurrent_nodes = 0;
+    while (end < node_count &&
+           level[plan.node_at[end]] == level[plan.node_at[begin]]) {
+      plan.position[plan.node_at[end]] = end;
+      concurrent_nodes += concurrent[plan.node_at[end]] ? 1 : 0;
+      ++end;
+    }
+    std::fill(plan.level_end.begin() + static_cast<std::ptrdiff_t>(begin),
+              plan.level_end.begin() + static_cast<std::ptrdiff_t>(end), end);
+    plan.available = plan.available || concurrent_nodes > 1;
+    begin = end;
+  }
+  if (!plan.available) {
+    return {};
+  }
+  plan.concurrent = std::move(concurrent);
+  return plan;
+}
+
 template <typename Storage>
 void attach_nodes_impl(const void *context, void *memory, GraphValue *graph) {
-  static_cast<void>(sizeof(Storage));
   const auto &runtime = graph_context(context);
+  if constexpr (std::is_same_v<Storage, NestedGraphRuntimeStorage>) {
+    if (graph_header<Storage>(runtime, memory).nodes_cleared) {
+      return;
+    }
+  }
   for (std::size_t index = 0; index < runtime.layout.node_count; ++index) {
     auto node = graph_node_view(runtime, memory, index);
     const auto node_type = node.type();
@@ -780,6 +1036,82 @@ RootGraphView nested_graph_root_impl(const void *context,
   return parent.graph().root();
 }
 
+/**
+ * Index a schedule slot write for a sparse graph. A node due now and still
+ * ahead of the running cycle's cursor joins the ready set directly; every
+ * other write (future times, out-of-band writes between cycles or during a
+ * pause, a node the cursor has already passed) goes to the pending heap and
+ * is matched against the slot when the next evaluate call collects it, as
+ * the dense scan would.
+ */
+void record_sparse_schedule(const GraphRuntimeContext &runtime,
+                            GraphRuntimeBaseStorage &state, void *memory,
+                            std::size_t node_index, DateTime when) {
+  auto &sparse = state.sparse_schedule;
+  const bool ahead = sparse.position != nullptr
+                         ? sparse.key(node_index) >= sparse.ready_floor
+                         : node_index > state.evaluation_cursor;
+  if (state.evaluating && when == state.evaluation_time && ahead) {
+    sparse.mark_ready(sparse.key(node_index), runtime.layout.node_count);
+    return;
+  }
+  // Superseded entries are only dropped when they surface; bound the heap
+  // by rebuilding it from the authoritative slots once it is mostly stale.
+  if (sparse.pending.size() >= 4 * runtime.layout.node_count) {
+    sparse.pending.clear();
+    for (std::size_t index = 0; index < runtime.layout.node_count; ++index) {
+      const DateTime scheduled = graph_schedule(runtime, memory, index);
+      if (scheduled >= state.evaluation_time && index != node_index) {
+        sparse.pending.push_back(
+            SparseScheduleState::Pending{.when = scheduled, .node_index = index});
+      }
+    }
+    std::make_heap(sparse.pending.begin(), sparse.pending.end(),
+                   std::greater<>{});
+  }
+  sparse.push_pending(when, node_index);
+}
+
+/**
+ * Move every pending entry due at ``evaluation_time`` into the ready set and
+ * drop entries that are stale (superseded, or for a time that has passed).
+ * Entries keyed before ``first_key`` are not indexed: push-source prefix
+ * nodes are driven by their own pass, and a resumed cycle never revisits
+ * nodes behind its cursor.
+ */
+void collect_sparse_ready(const GraphRuntimeContext &runtime,
+                          GraphRuntimeBaseStorage &state, void *memory,
+                          DateTime evaluation_time, std::size_t first_key) {
+  auto &sparse = state.sparse_schedule;
+  while (!sparse.pending.empty() &&
+         sparse.pending.front().when <= evaluation_time) {
+    const auto entry = sparse.pending.front();
+    sparse.pop_pending();
+    const std::size_t key = sparse.key(entry.node_index);
+    if (entry.when == evaluation_time && key >= first_key &&
+        graph_schedule(runtime, memory, entry.node_index) == evaluation_time) {
+      sparse.mark_ready(key, runtime.layout.node_count);
+    }
+  }
+}
+
+/** Earliest live pending time after ``evaluation_time``; MAX_DT when none. */
+[[nodiscard]] DateTime next_sparse_pending(const GraphRuntimeContext &runtime,
+                                           GraphRuntimeBaseStorage &state,
+                                           void *memory,
+                                           DateTime evaluation_time) noexcept {
+  auto &sparse = state.sparse_schedule;
+  while (!sparse.pending.empty()) {
+    const auto &entry = sparse.pending.front();
+    if (entry.when > evaluation_time &&
+        graph_schedule(runtime, memory, entry.node_index) == entry.when) {
+      return entry.when;
+    }
+    sparse.pop_pending();
+  }
+  return MAX_DT;
+}
+
 template <typename Storage>
 void schedule_node_impl(const void *context, const GraphView &graph,
                         std::size_t node_index, DateTime when) {
@@ -789,6 +1121,13 @@ void schedule_node_impl(const void *context, const GraphView &graph,
     throw std::out_of_range("Graph schedule node index is out of range");
   }
 
+  std::unique_lock<std::mutex> concurrent_lock{};
+  if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+    if (state.parallel != nullptr && state.parallel->concurrent_level) {
+      concurrent_lock = std::unique_lock{state.parallel->schedule_mutex};
+    }
+  }
+
   const DateTime current = state.evaluation_time;
   if (when < current) {
     throw std::runtime_error("Graph cannot schedule a node in the past");
@@ -800,6 +1139,10 @@ void schedule_node_impl(const void *context, const GraphView &graph,
     if (when > current && when < state.next_scheduled_time) {
       state.next_scheduled_time = when;
     }
+    if (runtime.layout.sparse_schedule ||
+        state.sparse_schedule.position != nullptr) {
+      record_sparse_schedule(runtime, state, graph.data(), node_index, when);
+    }
   }
 }
 
@@ -896,10 +1239,23 @@ void start_impl(const void *context, const GraphView &graph,
   });
 
   // NOTE: edge subscriptions are established at construction and torn
-  // down at stop (see unbind_edges). Restart is NOT supported by
-  // design: stop is a step toward erase (cleanup before disposal),
-  // so no rebind pass exists here — a blanket bind_edges() would
-  // reset REF-adapted bindings that construction set up.
+  // down at stop (see unbind_edges). Stop is normally a step toward
+  // erase; the one restart path (switch_ warm branches) starts a stopped
+  // graph again. It rebinds the wired edges exactly as construction did
+  // and clears the stale schedule, so boundary machinery re-points its
+  // links afterwards as it would on a fresh graph. Node storage and
+  // output values are kept: a restarted graph is not a fresh one.
+  if (state.edges_unbound) {
+    for (std::size_t index = 0; index < runtime.layout.node_count; ++index) {
+      graph_schedule(runtime, graph.data(), index) = MIN_DT;
+    }
+    std::ranges::fill(state.sparse_schedule.ready, std::uint64_t{0});
+    state.sparse_schedule.pending.clear();
+    if (graph.schema() != nullptr) {
+      bind_edges(runtime, graph.data(), graph.schema()->edges);
+    }
+    state.edges_unbound = false;
+  }
 
   // Nodes are NOT scheduled by default. A node that needs an initial
   // evaluation schedules itself in its ``start`` (a source does
@@ -999,6 +1355,7 @@ void stop_impl(const void *context, const GraphView &graph,
   }
   release_alternative_subscriptions(runtime, graph.data(),
                                     state.evaluation_time);
+  state.edges_unbound = true;
   state.started = false;
   if (exceptions.has_exception()) {
     state.lifecycle_observers->notify_stop_graph_failed(graph);
@@ -1040,6 +1397,13 @@ const LoggerOps *logger_ops_impl(const void *context,
   return graph_header<Storage>(runtime, memory).logger_ops;
 }
 
+template <typename Storage>
+const MemoryUtils::AllocatorOps *
+storage_allocator_impl(const void *context, const void *memory) noexcept {
+  const auto &runtime = graph_context(context);
+  return graph_header<Storage>(runtime, memory).storage_allocator;
+}
+
 template <typename Storage>
 const TypeRealizationSnapshot *
 type_realization_impl(const void *context, const void *memory) noexcept {
@@ -1063,6 +1427,108 @@ compound_scalar_storage_impl(const void *context, const void *memory) noexcept {
   }
 }
 
+/**
+ * Walk the ready set of a root graph level by level (see
+ * ``GraphExecutorBuilder::parallel_evaluation``). The due concurrent nodes
+ * of a level run on the pool without lifecycle notifications, which is why
+ * a cycle with registered observers keeps every node on the run thread.
+ * Their TSData notifications run under ``notification_mutex``, as nodes of
+ * a level may feed one consumer. The level's remaining nodes then run
+ * through ``evaluate_cursor_node`` in rank order. Returns false when a node
+ * requested a pause; its ready bit is kept so the resumed walk finds it
+ * again.
+ */
+template <typename EvaluateCursorNode>
+bool evaluate_rank_levels(const GraphRuntimeContext &runtime,
+                          RootGraphRuntimeStorage &state,
+                          const GraphView &graph, DateTime evaluation_time,
+                          std::size_t first_key,
+                          EvaluateCursorNode &&evaluate_cursor_node) {
+  const auto &plan = runtime.levels;
+  const std::size_t node_count = runtime.layout.node_count;
+  auto &sparse = state.sparse_schedule;
+  auto &parallel = *state.parallel;
+  const bool concurrent = state.lifecycle_observers->empty();
+  auto reset_floor = make_scope_exit([&] noexcept { sparse.ready_floor = 0; });
+
+  for (std::size_t key = sparse.next_ready(first_key, node_count);
+       key < node_count; key = sparse.next_ready(key, node_count)) {
+    const std::size_t level_end = plan.level_end[key];
+    sparse.ready_floor = level_end;
+
+    parallel.due.clear();
+    parallel.batch.clear();
+    for (std::size_t due_key = key; due_key < level_end;
+         due_key = sparse.next_ready(due_key + 1, level_end)) {
+      const std::size_t index = plan.node_at[due_key];
+      if (graph_schedule(runtime, graph.data(), index) != evaluation_time) {
+        sparse.clear_ready(due_key);
+      } else if (concurrent && plan.concurrent[index]) {
+        parallel.batch.push_back(index);
+      } else {
+        parallel.due.push_back(index);
+      }
+    }
+
+    if (parallel.batch.size() > 1) {
+      parallel.outcome.assign(parallel.batch.size(), 0);
+      const auto finish_batch = [&] {
+        for (std::size_t item = 0; item < parallel.batch.size(); ++item) {
+          if (parallel.outcome[item] == 1) {
+            sparse.clear_ready(plan.position[parallel.batch[item]]);
+          }
+        }
+      };
+      parallel.concurrent_level = true;
+      annotate_on_exception(
+          [&] {
+            auto end_level = make_scope_exit(
+                [&] noexcept { parallel.concurrent_level = false; });
+            parallel.pool.parallel_for(
+                parallel.batch.size(), [&](std::size_t item) {
+                  TypeRealizationScope realization_scope{
+                      state.type_realization};
+                  TSNotificationLockScope notification_scope{
+                      parallel.notification_mutex};
+                  parallel.outcome[item] = 2;
+                  graph_node_view(runtime, graph.data(), parallel.batch[item])
+                      .evaluate(evaluation_time);
+                  parallel.outcome[item] = 1;
+                });
+          },
+          [&] {
+            // The pool rethrows the failure of the lowest batch item, which
+            // is the first node in rank order whose evaluation failed.
+            finish_batch();
+            const auto failed = static_cast<std::size_t>(
+                std::find(parallel.outcome.begin(), parallel.outcome.end(), 2) -
+                parallel.outcome.begin());
+            state.evaluation_cursor = parallel.batch[failed];
+            state.evaluation_failed = true;
+            rethrow_with_node_identity(
+                graph_node_view(runtime, graph.data(), state.evaluation_cursor),
+                state.evaluation_cursor, "evaluate");
+          });
+      finish_batch();
+    } else if (!parallel.batch.empty()) {
+      // A single concurrent node gains nothing from the pool.
+      const std::size_t index = parallel.batch.front();
+      parallel.due.insert(
+          std::upper_bound(parallel.due.begin(), parallel.due.end(), index),
+          index);
+    }
+
+    for (const std::size_t index : parallel.due) {
+      state.evaluation_cursor = index;
+      if (!evaluate_cursor_node()) {
+        return false;
+      }
+      sparse.clear_ready(plan.position[index]);
+    }
+  }
+  return true;
+}
+
 template <typename Storage>
 bool evaluate_impl(const void *context, const GraphView &graph,
                    DateTime evaluation_time) {
@@ -1151,43 +1617,92 @@ bool evaluate_impl(const void *context, const GraphView &graph,
     state.evaluation_cursor = first_normal_node;
   }
 
-  for (; state.evaluation_cursor < runtime.layout.node_count;
-       ++state.evaluation_cursor) {
-    auto &scheduled =
-        graph_schedule(runtime, graph.data(), state.evaluation_cursor);
-    if (scheduled == evaluation_time) {
-      // post-eval MIN_DT stamp removed (see lazy-cleanup invariant)
-      bool completed = true;
-      NodeView node_view =
-          graph_node_view(runtime, graph.data(), state.evaluation_cursor);
-      state.lifecycle_observers->notify_before_node_evaluation(node_view);
-      // Best-effort: the node did run once, so a matching "after" fires
-      // regardless of a pause or a thrown exception (unlike the graph-level
-      // notification above, which is about the whole CYCLE completing).
-      auto node_after_notify = make_scope_exit<true>([&] {
-        state.lifecycle_observers->notify_after_node_evaluation(node_view);
-      });
-      if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
-        completed = annotate_on_exception(
-            [&] { return node_view.evaluate(state.evaluation_time); },
-            [&] {
-              state.evaluation_failed = true;
-              rethrow_with_node_identity(node_view, state.evaluation_cursor,
-                                         "evaluate");
-            });
-      } else {
-        completed = annotate_on_exception(
-            [&] { return node_view.evaluate(state.evaluation_time); },
-            [&] { state.evaluation_failed = true; });
+  // Evaluates the node under the cursor; false when it requested a pause.
+  const auto evaluate_cursor_node = [&]() -> bool {
+    // post-eval MIN_DT stamp removed (see lazy-cleanup invariant)
+    NodeView node_view =
+        graph_node_view(runtime, graph.data(), state.evaluation_cursor);
+    state.lifecycle_observers->notify_before_node_evaluation(node_view);
+    // Best-effort: the node did run once, so a matching "after" fires
+    // regardless of a pause or a thrown exception (unlike the graph-level
+    // notification above, which is about the whole CYCLE completing).
+    auto node_after_notify = make_scope_exit<true>([&] {
+      state.lifecycle_observers->notify_after_node_evaluation(node_view);
+    });
+    if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+      return annotate_on_exception(
+          [&] { return node_view.evaluate(state.evaluation_time); },
+          [&] {
+            state.evaluation_failed = true;
+            rethrow_with_node_identity(node_view, state.evaluation_cursor,
+                                       "evaluate");
+          });
+    } else {
+      return annotate_on_exception(
+          [&] { return node_view.evaluate(state.evaluation_time); },
+          [&] { state.evaluation_failed = true; });
+    }
+  };
+
+  if (runtime.layout.sparse_schedule ||
+      state.sparse_schedule.position != nullptr) {
+    // Cost is proportional to the nodes due this cycle: walk the ready set
+    // in rank order. Notifications raised by an evaluating node land ahead
+    // of the cursor (ranks are topological) and are picked up by the same
+    // walk. A ready bit is cleared only once its node completes, so a paused
+    // node is found again when the cycle resumes.
+    auto &sparse = state.sparse_schedule;
+    const std::size_t first_key =
+        resuming ? sparse.key(state.evaluation_cursor) : state.evaluation_cursor;
+    collect_sparse_ready(runtime, state, graph.data(), evaluation_time,
+                         first_key);
+    bool walked_levels = false;
+    if constexpr (std::is_same_v<Storage, RootGraphRuntimeStorage>) {
+      if (sparse.position != nullptr) {
+        if (!evaluate_rank_levels(runtime, state, graph, evaluation_time,
+                                  first_key, evaluate_cursor_node)) {
+          return false;
+        }
+        walked_levels = true;
       }
-      if (!completed) {
-        // Pause requested: hold the cursor on this node and propagate upward
-        // (the enclosing mesh node resolves the dependency and resumes us).
-        return false;
+    }
+    if (!walked_levels) {
+      for (state.evaluation_cursor = sparse.next_ready(
+               state.evaluation_cursor, runtime.layout.node_count);
+           state.evaluation_cursor < runtime.layout.node_count;
+           state.evaluation_cursor = sparse.next_ready(
+               state.evaluation_cursor + 1, runtime.layout.node_count)) {
+        if (graph_schedule(runtime, graph.data(), state.evaluation_cursor) ==
+                evaluation_time &&
+            !evaluate_cursor_node()) {
+          // Pause requested: hold the cursor on this node and propagate
+          // upward (the enclosing mesh node resolves the dependency and
+          // resumes us).
+          return false;
+        }
+        sparse.clear_ready(state.evaluation_cursor);
       }
-    } else if (scheduled > evaluation_time) {
-      if (scheduled < state.next_scheduled_time) {
-        state.next_scheduled_time = scheduled;
+    }
+    state.next_scheduled_time =
+        std::min(state.next_scheduled_time,
+                 next_sparse_pending(runtime, state, graph.data(),
+                                     evaluation_time));
+  } else {
+    for (; state.evaluation_cursor < runtime.layout.node_count;
+         ++state.evaluation_cursor) {
+      const DateTime scheduled =
+          graph_schedule(runtime, graph.data(), state.evaluation_cursor);
+      if (scheduled == evaluation_time) {
+        if (!evaluate_cursor_node()) {
+          // Pause requested: hold the cursor on this node and propagate
+          // upward (the enclosing mesh node resolves the dependency and
+          // resumes us).
+          return false;
+        }
+      } else if (scheduled > evaluation_time) {
+        if (scheduled < state.next_scheduled_time) {
+          state.next_scheduled_time = scheduled;
+        }
       }
     }
   }
@@ -1348,6 +1863,8 @@ struct GraphRuntimeRegistry {
                                CompoundScalarStorage>(builder.nodes(),
                                                       pooled_storage);
     entry.root_context = graph_runtime_context_for(root_plan, builder.nodes());
+    entry.root_context.levels = rank_level_plan_for(
+        builder, entry.schema.push_source_nodes_end, pooled_storage);
     entry.root_ops = make_root_ops(&entry.root_context, pooled_storage);
     entry.root_type = intern_graph_type(entry.schema, root_plan, entry.root_ops,
                                         "hgraph.graph.root");
@@ -1410,6 +1927,8 @@ struct GraphRuntimeRegistry {
                 : nullptr,
         .logger_impl = &logger_impl<RootGraphRuntimeStorage>,
         .logger_ops_impl = &logger_ops_impl<RootGraphRuntimeStorage>,
+        .storage_allocator_impl =
+            &storage_allocator_impl<RootGraphRuntimeStorage>,
     };
   }
 
@@ -1459,6 +1978,8 @@ struct GraphRuntimeRegistry {
                 : nullptr,
         .logger_impl = &logger_impl<NestedGraphRuntimeStorage>,
         .logger_ops_impl = &logger_ops_impl<NestedGraphRuntimeStorage>,
+        .storage_allocator_impl =
+            &storage_allocator_impl<NestedGraphRuntimeStorage>,
     };
   }
 
@@ -1782,6 +2303,18 @@ const LoggerOps *GraphView::logger_ops() const noexcept {
              : nullptr;
 }
 
+const MemoryUtils::AllocatorOps &GraphView::storage_allocator() const noexcept {
+  if (!valid()) {
+    return MemoryUtils::allocator();
+  }
+  const auto &table = ops();
+  const auto *allocator = table.storage_allocator_impl != nullptr
+                              ? table.storage_allocator_impl(table.context,
+                                                             data())
+                              : nullptr;
+  return allocator != nullptr ? *allocator : MemoryUtils::allocator();
+}
+
 const TypeRealizationSnapshot *GraphView::type_realization() const noexcept {
   if (!valid()) {
     return nullptr;
@@ -1893,7 +2426,21 @@ GraphValue::GraphValue(const GraphBuilder &builder, ExecutorPtr root_executor) {
               &GraphExecutorView{root_executor}.lifecycle_observers();
           state.logger = GraphExecutorView{root_executor}.logger();
           state.logger_ops = GraphExecutorView{root_executor}.logger_ops();
+          if (builder.storage_arena_chunk_bytes_ != 0) {
+            state.arena = std::make_unique<StorageArena>(
+                builder.storage_arena_chunk_bytes_);
+            state.storage_allocator = &state.arena->allocator();
+          }
           state.type_realization = snapshot.get();
+          const auto &runtime = graph_context(type.ops_ref().context);
+          const std::size_t threads =
+              GraphExecutorView{root_executor}.parallel_evaluation_threads();
+          if (threads > 1) {
+            state.parallel = std::make_unique<ParallelEvaluation>(threads);
+            if (runtime.levels.available) {
+              state.sparse_schedule.position = &runtime.levels.position;
+            }
+          }
         });
   });
   pointer_ = type.writable(storage_.data());
@@ -1921,6 +2468,7 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node) {
   const auto shared_storage =
       NodeView{parent_node}.graph().compound_scalar_storage();
   const auto type = builder.nested_type();
+  const auto &allocator = NodeView{parent_node}.graph().storage_allocator();
   storage_ = storage_type::owning_constructed(*type.record(), [&](void *dst) {
     construct_graph_storage<NestedGraphRuntimeStorage>(
         type, builder, dst, [&](NestedGraphRuntimeStorage &state) {
@@ -1934,10 +2482,11 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node) {
               &NodeView{parent_node}.graph().lifecycle_observers();
           state.logger = NodeView{parent_node}.graph().logger();
           state.logger_ops = NodeView{parent_node}.graph().logger_ops();
+          state.storage_allocator = &allocator;
           state.type_realization = effective_snapshot;
         },
         shared_storage);
-  });
+  }, allocator);
   pointer_ = type.writable(storage_.data());
   if (shared_storage.available()) {
     CompoundScalarStorageScope storage_scope{shared_storage};
@@ -1987,6 +2536,8 @@ GraphValue::GraphValue(const GraphBuilder &builder, NodePtr parent_node,
             &NodeView{parent_node}.graph().lifecycle_observers();
         state.logger = NodeView{parent_node}.graph().logger();
         state.logger_ops = NodeView{parent_node}.graph().logger_ops();
+        state.storage_allocator =
+            &NodeView{parent_node}.graph().storage_allocator();
         state.type_realization = effective_snapshot;
       },
       shared_storage);
@@ -2023,7 +2574,16 @@ void GraphValue::reset() noexcept {
                                   : CompoundScalarStorageView{};
   const auto destroy_storage = [&] {
     if (uses_external_storage()) {
-      type().destroy_at(const_cast<void *>(pointer_.data()));
+      void *memory = const_cast<void *>(pointer_.data());
+      if (nested_nodes_cleared(type(), memory)) {
+        const auto &context = graph_context(type().ops_ref().context);
+        destroy_constructed_graph_parts<NestedGraphRuntimeStorage>(
+            context, memory, false, true,
+            graph_has_compound_scalar_storage(context), 0,
+            context.layout.node_count, type().checked_plan());
+      } else {
+        type().destroy_at(memory);
+      }
     } else {
       storage_.reset();
     }
@@ -2037,6 +2597,37 @@ void GraphValue::reset() noexcept {
   pointer_ = {};
 }
 
+bool GraphValue::clear_nodes() noexcept {
+  if (!uses_external_storage() ||
+      type().ops_ref().parent_kind != GraphParentKind::Nested) {
+    return false;
+  }
+  void *memory = const_cast<void *>(pointer_.data());
+  const auto &context = graph_context(type().ops_ref().context);
+  auto &state = graph_header<NestedGraphRuntimeStorage>(context, memory);
+  if (state.nodes_cleared) {
+    return true;
+  }
+  if (state.started || state.starting || state.stopping || state.evaluating) {
+    return false;
+  }
+  const auto destroy_nodes = [&] {
+    for (std::size_t index = context.layout.node_count; index > 0; --index) {
+      const auto &location = context.node_locations[index - 1];
+      location.type.destroy_at(MemoryUtils::advance(memory, location.offset));
+    }
+  };
+  const auto compound_storage = view().compound_scalar_storage();
+  if (compound_storage.available()) {
+    CompoundScalarStorageScope storage_scope{compound_storage};
+    destroy_nodes();
+  } else {
+    destroy_nodes();
+  }
+  state.nodes_cleared = true;
+  return true;
+}
+
 GraphValue::GraphValue(GraphValue &&other) noexcept
     : pointer_(std::exchange(other.pointer_, {})),
       storage_(std::move(other.storage_)) {
@@ -2151,6 +2742,15 @@ GraphBuilder &GraphBuilder::trait(std::string_view name, Value &&value) {
 
 GlobalStateView GraphBuilder::traits() noexcept { return traits_.view(); }
 
+GraphBuilder &GraphBuilder::storage_arena(std::size_t chunk_bytes) {
+  storage_arena_chunk_bytes_ = chunk_bytes;
+  return *this;
+}
+
+std::size_t GraphBuilder::storage_arena() const noexcept {
+  return storage_arena_chunk_bytes_;
+}
+
 GraphBuilder &GraphBuilder::global_state(GlobalState state) {
   global_state_ = std::move(state);
   invalidate_types();
@@ -2247,6 +2847,79 @@ GraphValue GraphBuilder::make_nested_graph(
   return GraphValue{*this, parent_node, external_memory, available_layout};
 }
 
+void GraphBuilder::reset_nested_graph(GraphValue &graph) const {
+  const auto type = nested_type();
+  if (!graph.uses_external_storage() || graph.type() != type) {
+    throw std::invalid_argument(
+        "reset_nested_graph requires an in-place nested graph of this builder");
+  }
+  if (!graph.clear_nodes()) {
+    throw std::logic_error("reset_nested_graph requires a stopped graph");
+  }
+  const auto *active_snapshot = active_type_realization();
+  const auto snapshot =
+      active_snapshot == nullptr ? type_realization() : nullptr;
+  TypeRealizationScope realization_scope{
+      active_snapshot != nullptr ? active_snapshot : snapshot.get()};
+  GraphValueRealizationScope graph_value_scope{};
+
+  void *memory = graph.view().data();
+  const auto &context = graph_context(type.ops_ref().context);
+  const auto compound_storage = graph.view().compound_scalar_storage();
+  std::size_t constructed_nodes = 0;
+  bool graph_complete = false;
+  // A failed rebuild leaves no graph: every part still constructed is
+  // destroyed, as a failed construction would.
+  auto rollback = make_scope_exit([&]() noexcept {
+    destroy_constructed_graph_parts<NestedGraphRuntimeStorage>(
+        context, memory, graph_complete, true,
+        graph_has_compound_scalar_storage(context), constructed_nodes,
+        context.layout.node_count, type.checked_plan());
+    graph.pointer_ = {};
+  });
+
+  const auto construct_nodes = [&] {
+    for (std::size_t index = 0; index < context.layout.node_count; ++index) {
+      nodes_[index].construct_node_storage(
+          graph_node_memory(context, memory, index), index);
+      ++constructed_nodes;
+    }
+  };
+  if (compound_storage.available()) {
+    CompoundScalarStorageScope storage_scope{compound_storage};
+    construct_nodes();
+  } else {
+    construct_nodes();
+  }
+
+  // The header keeps its parent, caches and scratch capacity; only the
+  // run state of the previous instance is cleared.
+  auto &state = graph_header<NestedGraphRuntimeStorage>(context, memory);
+  for (std::size_t index = 0; index < context.layout.node_count; ++index) {
+    graph_schedule(context, memory, index) = MIN_DT;
+  }
+  std::ranges::fill(state.sparse_schedule.ready, std::uint64_t{0});
+  state.sparse_schedule.pending.clear();
+  state.next_scheduled_time = MAX_DT;
+  state.evaluation_time = MIN_DT;
+  state.evaluation_cursor = invalid_cursor;
+  state.evaluation_failed = false;
+  state.edges_unbound = false;
+  state.child_schedule_observer = nullptr;
+  state.child_schedule_observer_context = nullptr;
+  state.nodes_cleared = false;
+  graph_complete = true;
+  bind_edges(context, memory, edges_);
+  rollback.release();
+
+  if (compound_storage.available()) {
+    CompoundScalarStorageScope storage_scope{compound_storage};
+    graph.attach_nodes();
+  } else {
+    graph.attach_nodes();
+  }
+}
+
 void clear_graph_runtime_types() noexcept {
   clear_debug_descriptors(TypeFamily::Graph);
   graph_runtime_registry().clear();
@@ -2265,4 +2938,16 @@ std::size_t detail::graph_runtime_type_count() noexcept {
   return count;
 }
 
+namespace runtime_detail {
+EvaluationThreadPool *evaluation_thread_pool(const GraphView &graph) {
+  if (EvaluationThreadPool::in_job()) {
+    return nullptr;
+  }
+  const RootGraphView root = graph.root();
+  const auto &runtime = graph_context(root.type().ops_ref().context);
+  const auto &state = graph_header<RootGraphRuntimeStorage>(runtime, root.data());
+  return state.parallel != nullptr ? &state.parallel->pool : nullptr;
+}
+} // namespace runtime_detail
+
 } // namespace hgraph
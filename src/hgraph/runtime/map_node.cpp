@@ -1,3 +1,4 @@
+#include <hgraph/runtime/lifecycle_observer.h>
 #include <hgraph/runtime/map_node.h>
 #include <hgraph/runtime/nested_bindings.h>
 #include <hgraph/runtime/nested_graph_storage.h>
@@ -7,6 +8,7 @@
 #include <hgraph/types/value/impl/graph_local_value.h>
 #include <hgraph/util/scope.h>
 
+#include "evaluation_thread_pool.h"
 #include "mapped_child_bindings.h"
 #include "mapped_key_source.h"
 
@@ -16,8 +18,10 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -109,6 +113,9 @@ namespace hgraph
             bool                        observing_keys{false};
             bool                        keys_source_cleared{false};
             bool primed{false};
+            // The recycle limit is read from the graph traits once, on the
+            // first reconciliation.
+            bool recycle_configured{false};
 
             // Rebinding is required for a wholesale source repoint, or for a
             // specific key whose membership changed in a multiplexed input.
@@ -130,6 +137,12 @@ namespace hgraph
             // Entries are LAZY: a stale (rescheduled, stopped, or removed)
             // slot pops harmlessly — the evaluation loop re-checks due-ness.
             std::vector<MapChildSchedule> child_schedule_queue{};
+            // Concurrent evaluation (map_evaluate_children_concurrently):
+            // serialises TSData notification from children on pool threads,
+            // plus per-cycle scratch for the due entries and captured errors.
+            std::mutex                              notification_mutex{};
+            std::vector<MapKeyEntry *>              concurrent_due{};
+            std::vector<std::optional<std::string>> concurrent_errors{};
 
             void push_child_schedule(MapChildSchedule schedule)
             {
@@ -184,6 +197,13 @@ namespace hgraph
                 return count_bank(entries) + count_bank(previous_entries);
             }
 
+            void configure_recycling(std::size_t limit)
+            {
+                entries.set_recycle_limit(limit);
+                previous_entries.set_recycle_limit(limit);
+                recycle_configured = true;
+            }
+
             void destroy_previous_entries_before(DateTime evaluation_time) noexcept
             {
                 if (previous_entries.has_entries() && previous_entries_time < evaluation_time)
@@ -267,7 +287,8 @@ namespace hgraph
             // A forwarding source can repoint during its mutation, so acting on
             // this slot callback alone could stop an unrelated replacement key.
             void on_remove(std::size_t) override {}
-            void on_erase(std::size_t slot) override { entries.destroy_at(slot); }
+            // Parks the child for reuse when recycling is enabled.
+            void on_erase(std::size_t slot) override { entries.park_at(slot); }
             // Reconciliation must stop children and publish their removals
             // before an erase callback performs destruction.
             void on_clear() override { keys_source_cleared = true; }
@@ -279,6 +300,8 @@ namespace hgraph
             runtime_detail::MappedChildAccessPlan access{};
             std::size_t                storage_offset{0};
             MemoryUtils::StorageLayout graph_layout{};
+            /** Due children may evaluate on the executor's pool. */
+            bool                       concurrent_children{false};
         };
 
         using MapNodeContextPtr = std::shared_ptr<const MapNodeContext>;
@@ -290,17 +313,43 @@ namespace hgraph
             bool broadcast_repointed{false};
         };
 
+        // A keyed child may evaluate off the run thread only when every node
+        // is a plain compute, sink or pull-source node that passes
+        // concurrent_evaluation_safe. A REF endpoint can bind the child to
+        // outputs beyond its own element, and a nested graph could pause or
+        // reach back into the pool.
+        [[nodiscard]] bool map_children_concurrent(const GraphBuilder &child)
+        {
+            if (child.nodes().empty()) { return false; }
+            for (const NodeBuilder &node : child.nodes())
+            {
+                const NodeTypeMetaData *schema = node.type().schema();
+                if (schema == nullptr ||
+                    (schema->node_kind != NodeKind::Compute && schema->node_kind != NodeKind::Sink &&
+                     schema->node_kind != NodeKind::PullSource) ||
+                    !runtime_detail::concurrent_evaluation_safe(*schema) ||
+                    TypeRegistry::contains_ref(schema->input_schema) ||
+                    TypeRegistry::contains_ref(schema->output_schema))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         [[nodiscard]] MapNodeContextPtr make_map_node_context(
             MapNodeSpec spec,
             runtime_detail::MappedChildAccessPlan access,
             std::size_t storage_offset,
             MemoryUtils::StorageLayout graph_layout)
         {
+            const bool concurrent_children = map_children_concurrent(spec.child.graph_builder);
             return std::make_shared<MapNodeContext>(MapNodeContext{
-                .spec           = std::move(spec),
-                .access         = std::move(access),
-                .storage_offset = storage_offset,
-                .graph_layout   = graph_layout,
+                .spec                = std::move(spec),
+                .access              = std::move(access),
+                .storage_offset      = storage_offset,
+                .graph_layout        = graph_layout,
+                .concurrent_children = concurrent_children,
             });
         }
 
@@ -513,8 +562,8 @@ namespace hgraph
             MapKeyEntry *existing = storage.entries.entry_at(slot);
             auto &entry = existing != nullptr
                               ? *existing
-                              : storage.entries.construct_at(
-                                    slot, value_impl::graph_local_value(key_view));
+                              : storage.entries.recycle_at(
+                                    slot, spec.child.graph_builder, value_impl::graph_local_value(key_view));
             if (entry.graph.has_value() && entry.graph.view().started()) { return; }
             auto rollback = UnwindCleanupGuard([&] {
                 clear_entry_output_binding(view, context, entry, evaluation_time);
@@ -638,8 +687,13 @@ namespace hgraph
             const auto &spec       = context.spec;
             const auto  keys_index = *spec.keys_input_index;
             storage.destroy_previous_entries_before(evaluation_time);
-            storage.entries.bind_graph_layout(context.graph_layout);
-            storage.previous_entries.bind_graph_layout(context.graph_layout);
+            const auto &allocator = view.graph().storage_allocator();
+            storage.entries.bind_graph_layout(context.graph_layout, allocator);
+            storage.previous_entries.bind_graph_layout(context.graph_layout, allocator);
+            if (!storage.recycle_configured)
+            {
+                storage.configure_recycling(runtime_detail::recycled_child_graph_limit(view.graph()));
+            }
 
             auto root_input = view.input(evaluation_time);
             SourceRepointStatus source_status =
@@ -983,6 +1037,108 @@ namespace hgraph
             (void)mutation.move_value_from(std::move(error_value));
         }
 
+        void refresh_map_entry_bindings(const NodeView &view, const MapNodeContext &context,
+                                        MapNodeStorage &storage, MapKeyEntry &entry,
+                                        DateTime evaluation_time)
+        {
+            const bool membership_changed = map_entry_membership_changed(storage, entry.key.view());
+            if (!storage.refresh_all_bindings && !membership_changed) { return; }
+
+            const auto &spec           = context.spec;
+            const bool  silent_repoint = storage.selective_repoint_bindings && !membership_changed &&
+                                         !map_entry_repoint_modified(storage, entry.key.view());
+            const TSOutputView key_source = entry.key_source.bound()
+                                                ? entry.key_source.view(evaluation_time)
+                                                : TSOutputView{};
+            auto child = entry.graph.view();
+            runtime_detail::bind_mapped_child_inputs(view, child, evaluation_time, spec.child,
+                                                     context.access, entry.key.view(), key_source,
+                                                     std::nullopt, silent_repoint);
+            runtime_detail::bind_mapped_child_output(view, child, evaluation_time,
+                                                     spec.child.output_binding, context.access,
+                                                     entry.key.view(), key_source,
+                                                     spec.output_binding_mode, silent_repoint);
+        }
+
+        void pull_map_child_schedule(MapNodeStorage &storage, MapKeyEntry &entry, DateTime evaluation_time)
+        {
+            if (const DateTime next = entry.graph.view().next_scheduled_time();
+                next != MAX_DT && next > evaluation_time)
+            {
+                // The PULL half: schedules created while the map drove
+                // the child land in the queue here; the out-of-band
+                // observer covers schedules arriving between map
+                // evaluations.
+                storage.push_pulled_child_schedule(next, entry.schedule_context);
+            }
+            else
+            {
+                // Invalidate a lazy entry when the child consumed or
+                // cancelled its previous deadline.
+                entry.schedule_context.pulled_when = MAX_DT;
+            }
+        }
+
+        /**
+         * Evaluate this cycle's due children on the executor's pool
+         * (``GraphExecutorBuilder::parallel_evaluation``). Bindings are
+         * refreshed and the due entries gathered on the run thread; the
+         * children then evaluate concurrently, their notifications into the
+         * shared output serialised by ``notification_mutex``; captured errors,
+         * output finalisation and schedule pulls are then applied in slot
+         * order as the sequential walk does. Eligible children hold no nested
+         * graph, so none can pause. Without error capture a failing child
+         * aborts the cycle with the first failure in slot order, though later
+         * siblings may already have evaluated.
+         */
+        void map_evaluate_children_concurrently(const NodeView &view, const MapNodeContext &context,
+                                                MapNodeStorage &storage,
+                                                runtime_detail::EvaluationThreadPool &pool,
+                                                DateTime evaluation_time, bool captures_errors)
+        {
+            auto &due = storage.concurrent_due;
+            due.clear();
+            for (const std::size_t slot : storage.evaluation_slots)
+            {
+                auto *entry = storage.entry_at(slot);
+                if (entry == nullptr || !entry->graph.has_value() || !entry->graph.view().started()) { continue; }
+                refresh_map_entry_bindings(view, context, storage, *entry, evaluation_time);
+                if (entry->graph.view().next_scheduled_time() <= evaluation_time) { due.push_back(entry); }
+                else { pull_map_child_schedule(storage, *entry, evaluation_time); }
+            }
+
+            auto &errors = storage.concurrent_errors;
+            errors.assign(due.size(), std::nullopt);
+            pool.parallel_for(due.size(), [&](std::size_t item) {
+                TSNotificationLockScope notification_scope{storage.notification_mutex};
+                auto child = due[item]->graph.view();
+                if (!captures_errors)
+                {
+                    static_cast<void>(child.evaluate(evaluation_time));
+                    return;
+                }
+                static_cast<void>(fallback_on_exception(
+                    true, [&] { return child.evaluate(evaluation_time); },
+                    [&](const char *error) { errors[item].emplace(error); }));
+            });
+
+            for (std::size_t item = 0; item < due.size(); ++item)
+            {
+                MapKeyEntry &entry = *due[item];
+                if (errors[item].has_value())
+                {
+                    write_map_error(view, entry.graph.view().failed_node(), entry.key.view(), evaluation_time,
+                                    std::move(*errors[item]));
+                }
+                runtime_detail::finalize_mapped_child_output(view, evaluation_time,
+                                                             context.spec.child.output_binding,
+                                                             context.access.output, entry.key.view());
+                pull_map_child_schedule(storage, entry, evaluation_time);
+            }
+            due.clear();
+            errors.clear();
+        }
+
         // Evaluates the keyed children, supporting pause/resume: a child that pauses (a
         // mesh nested in the child needs a sibling) propagates the pause — we save the slot
         // cursor and return false so the enclosing mesh resolves the dependency and
@@ -1011,7 +1167,21 @@ namespace hgraph
             // Due children write their TSD elements directly via their terminal forwarding
             // outputs (no post-evaluation collection). A child evaluation propagates its own
             // next scheduled time back to this node; unevaluated children pull theirs up.
-            const std::size_t start_position = resuming ? storage.resume_position_plus_one - 1 : 0;
+            runtime_detail::EvaluationThreadPool *pool = nullptr;
+            if (!resuming && context.concurrent_children && storage.evaluation_slots.size() > 1 &&
+                view.graph().lifecycle_observers().empty() &&
+                !view.graph().compound_scalar_storage().available())
+            {
+                pool = runtime_detail::evaluation_thread_pool(view.graph());
+            }
+            if (pool != nullptr)
+            {
+                map_evaluate_children_concurrently(view, context, storage, *pool, evaluation_time,
+                                                   captures_errors);
+            }
+            const std::size_t start_position =
+                pool != nullptr ? storage.evaluation_slots.size()
+                                : (resuming ? storage.resume_position_plus_one - 1 : 0);
             for (std::size_t position = start_position; position < storage.evaluation_slots.size(); ++position)
             {
                 const std::size_t slot = storage.evaluation_slots[position];
@@ -1023,24 +1193,7 @@ namespace hgraph
                 // schedule enqueued before the stop) lingers this cycle —
                 // stopped children never evaluate.
                 if (!child.started()) { continue; }
-                const bool membership_changed =
-                    map_entry_membership_changed(storage, entry->key.view());
-                if (storage.refresh_all_bindings || membership_changed)
-                {
-                    const bool silent_repoint = storage.selective_repoint_bindings &&
-                                                !membership_changed &&
-                                                !map_entry_repoint_modified(storage, entry->key.view());
-                    const TSOutputView key_source = entry->key_source.bound()
-                                                        ? entry->key_source.view(evaluation_time)
-                                                        : TSOutputView{};
-                    runtime_detail::bind_mapped_child_inputs(view, child, evaluation_time, spec.child,
-                                                             context.access, entry->key.view(), key_source,
-                                                             std::nullopt, silent_repoint);
-                    runtime_detail::bind_mapped_child_output(view, child, evaluation_time,
-                                                             spec.child.output_binding, context.access,
-                                                             entry->key.view(), key_source,
-                                                             spec.output_binding_mode, silent_repoint);
-                }
+                refresh_map_entry_bindings(view, context, storage, *entry, evaluation_time);
 
                 const bool resume_this = resuming && position == start_position;
                 if (child.next_scheduled_time() <= evaluation_time || resume_this)
@@ -1065,21 +1218,7 @@ namespace hgraph
                         context.access.output,
                         entry->key.view());
                 }
-                if (const DateTime next = child.next_scheduled_time(); next != MAX_DT && next > evaluation_time)
-                {
-                    // The PULL half: schedules created while the map drove
-                    // the child land in the queue here; the out-of-band
-                    // observer covers schedules arriving between map
-                    // evaluations.
-                    storage.push_pulled_child_schedule(
-                        next, entry->schedule_context);
-                }
-                else
-                {
-                    // Invalidate a lazy entry when the child consumed or
-                    // cancelled its previous deadline.
-                    entry->schedule_context.pulled_when = MAX_DT;
-                }
+                pull_map_child_schedule(storage, *entry, evaluation_time);
             }
             storage.resume_position_plus_one = 0;
             storage.evaluation_slots.clear();
@@ -1352,6 +1491,18 @@ namespace hgraph
         return MemoryUtils::cast<MapNodeStorage>(storage_)->child_graph_count();
     }
 
+    std::size_t MapNodeView::parked_child_graph_count() const noexcept
+    {
+        const auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
+        return storage.entries.parked_count() + storage.previous_entries.parked_count();
+    }
+
+    std::size_t MapNodeView::recycled_child_graph_count() const noexcept
+    {
+        const auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
+        return storage.entries.recycled_count() + storage.previous_entries.recycled_count();
+    }
+
     bool MapNodeView::child_graphs_use_in_place_storage() const noexcept
     {
         const auto &storage = *MemoryUtils::cast<MapNodeStorage>(storage_);
@@ -79,6 +79,15 @@ namespace hgraph::runtime_detail
         MappedOutputAccessPlan           output{};
     };
 
+    /** The ``RECYCLED_CHILD_GRAPHS_TRAIT`` limit in force for ``graph``; ``0`` when absent or not positive. */
+    [[nodiscard]] inline std::size_t recycled_child_graph_limit(const GraphView &graph) noexcept
+    {
+        const ValueView limit = graph.trait(RECYCLED_CHILD_GRAPHS_TRAIT);
+        if (!limit.has_value() || limit.schema() != scalar_descriptor<Int>::value_meta()) { return 0; }
+        const Int value = limit.as<Int>();
+        return value > 0 ? static_cast<std::size_t>(value) : 0;
+    }
+
     [[nodiscard]] inline std::span<const std::size_t> mapped_child_path_suffix(
         const std::vector<std::size_t> &path)
     {
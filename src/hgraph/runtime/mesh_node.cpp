@@ -205,11 +205,14 @@ struct MeshNodeStorage final : SlotObserver {
   }
 
   void initialise(const ValueTypeRef &key_binding,
-                  MemoryUtils::StorageLayout graph_layout) {
-    entries.bind_graph_layout(graph_layout);
+                  MemoryUtils::StorageLayout graph_layout,
+                  const MemoryUtils::AllocatorOps &allocator,
+                  const GraphView &graph) {
+    entries.bind_graph_layout(graph_layout, allocator);
     if (instance_keys.has_value()) {
       return;
     }
+    entries.set_recycle_limit(runtime_detail::recycled_child_graph_limit(graph));
     instance_keys.emplace(key_binding);
     instance_keys->add_slot_observer(this);
   }
@@ -333,7 +336,8 @@ struct MeshNodeStorage final : SlotObserver {
     }
   }
 
-  void on_erase(std::size_t slot) override { entries.destroy_at(slot); }
+  // Parks the instance graph for reuse when recycling is enabled.
+  void on_erase(std::size_t slot) override { entries.park_at(slot); }
   void on_clear() override {
     evaluation_candidates.reset();
     entries.destroy_all();
@@ -350,11 +354,13 @@ struct MeshNodeContext {
 
 void initialise_mesh_storage(MeshNodeStorage &storage,
                              const MeshNodeContext &context,
-                             ValueTypeRef key_binding) {
+                             ValueTypeRef key_binding,
+                             const GraphView &graph) {
   if (!key_binding || key_binding.schema() != context.key_binding.schema()) {
     throw std::logic_error("mesh_ has no resolved key binding");
   }
-  storage.initialise(key_binding, context.graph_layout);
+  storage.initialise(key_binding, context.graph_layout,
+                     graph.storage_allocator(), graph);
 }
 
 struct MeshSubscribeStorage {
@@ -795,8 +801,9 @@ MeshEntry &create_instance(const NodeView &view, const MeshNodeContext &context,
       UnwindCleanupGuard([&] { storage.retire_slot(slot, evaluation_time); });
   auto &entry = existing != nullptr
                     ? *existing
-                    : storage.entries.construct_at(
-                          slot, value_impl::graph_local_value(key_view));
+                    : storage.entries.recycle_at(
+                          slot, spec.child.graph_builder,
+                          value_impl::graph_local_value(key_view));
   entry.rank = rank;
   entry.paused = true;
   entry.settled_time = MIN_DT;
@@ -998,7 +1005,7 @@ bool mesh_evaluate_impl(const void *, const NodeView &view,
   auto output = view.output(evaluation_time);
   const auto runtime_key_binding =
       output.as_dict().data_view().layout().key_binding;
-  initialise_mesh_storage(storage, context, runtime_key_binding);
+  initialise_mesh_storage(storage, context, runtime_key_binding, view.graph());
   storage.erase_retired_before(evaluation_time);
 
   auto root_input = view.input(evaluation_time);
@@ -1487,6 +1494,14 @@ std::size_t MeshNodeView::child_graph_count() const noexcept {
   return count;
 }
 
+std::size_t MeshNodeView::parked_child_graph_count() const noexcept {
+  return MemoryUtils::cast<MeshNodeStorage>(storage_)->entries.parked_count();
+}
+
+std::size_t MeshNodeView::recycled_child_graph_count() const noexcept {
+  return MemoryUtils::cast<MeshNodeStorage>(storage_)->entries.recycled_count();
+}
+
 bool MeshNodeView::child_graphs_use_in_place_storage() const noexcept {
   const auto &storage = *MemoryUtils::cast<MeshNodeStorage>(storage_);
   for (std::size_t slot = 0; slot < storage.entries.slot_capacity(); ++slot) {
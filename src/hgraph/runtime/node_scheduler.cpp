@@ -0,0 +1,135 @@
+#include <hgraph/runtime/node_scheduler.h>
+
+namespace hgraph
+{
+    namespace
+    {
+        /** Room for one more element, growing geometrically as ``push_back`` would. */
+        template <typename T> void reserve_one(std::vector<T> &values)
+        {
+            if (values.size() == values.capacity()) { values.reserve(std::max<std::size_t>(8, values.capacity() * 2)); }
+        }
+    }  // namespace
+
+    std::optional<DateTime> NodeSchedulerState::tag_time(std::string_view tag) const noexcept
+    {
+        const std::uint32_t id = find_tag(tag);
+        if (id == untagged || !tags_[id].pending) { return std::nullopt; }
+        return tags_[id].when;
+    }
+
+    void NodeSchedulerState::schedule(DateTime when, std::string_view tag)
+    {
+        // Grow before touching anything, so a failed allocation leaves the
+        // pending events as they were.
+        if (tag.empty())
+        {
+            reserve_one(events_);
+            const Event event{when, untagged};
+            const auto  it = find_event(event);
+            if (it == events_.end() || it->when != when || it->tag != untagged) { events_.insert(it, event); }
+            return;
+        }
+
+        const std::uint32_t id   = intern_tag(tag);
+        TagSlot            &slot = tags_[id];
+        if (slot.pending) { events_.erase(find_event(Event{slot.when, id})); }
+        else
+        {
+            reserve_one(events_);
+            --idle_tags_;
+        }
+        slot.when    = when;
+        slot.pending = true;
+        const Event event{when, id};
+        events_.insert(find_event(event), event);
+    }
+
+    std::optional<DateTime> NodeSchedulerState::cancel(std::string_view tag) noexcept
+    {
+        const std::uint32_t id = find_tag(tag);
+        if (id == untagged || !tags_[id].pending) { return std::nullopt; }
+        const DateTime when = tags_[id].when;
+        events_.erase(find_event(Event{when, id}));
+        release(id);
+        return when;
+    }
+
+    void NodeSchedulerState::cancel_next() noexcept
+    {
+        if (events_.empty()) { return; }
+        const std::uint32_t id = events_.back().tag;
+        events_.pop_back();
+        release(id);
+    }
+
+    void NodeSchedulerState::consume_until(DateTime until) noexcept
+    {
+        while (!events_.empty() && events_.back().when <= until) { cancel_next(); }
+    }
+
+    void NodeSchedulerState::clear() noexcept
+    {
+        events_.clear();
+        for (TagSlot &slot : tags_) { slot.pending = false; }
+        idle_tags_ = tags_.size();
+    }
+
+    bool NodeSchedulerState::orders_after(const Event &lhs, const Event &rhs) const noexcept
+    {
+        if (lhs.when != rhs.when) { return lhs.when > rhs.when; }
+        // Untagged orders before any tag at the same time, as the empty name did.
+        if (lhs.tag == rhs.tag || lhs.tag == untagged) { return false; }
+        if (rhs.tag == untagged) { return true; }
+        return tags_[rhs.tag].name < tags_[lhs.tag].name;
+    }
+
+    std::vector<NodeSchedulerState::Event>::iterator NodeSchedulerState::find_event(const Event &event) noexcept
+    {
+        // Events are held latest first: the first one not after ``event`` is
+        // either ``event`` itself or where it belongs.
+        return std::lower_bound(events_.begin(), events_.end(), event,
+                                [this](const Event &lhs, const Event &rhs) { return orders_after(lhs, rhs); });
+    }
+
+    std::uint32_t NodeSchedulerState::find_tag(std::string_view tag) const noexcept
+    {
+        const auto it = std::lower_bound(tags_by_name_.begin(), tags_by_name_.end(), tag,
+                                         [this](std::uint32_t id, std::string_view name) { return tags_[id].name < name; });
+        return it != tags_by_name_.end() && tags_[*it].name == tag ? *it : untagged;
+    }
+
+    std::uint32_t NodeSchedulerState::intern_tag(std::string_view tag)
+    {
+        if (const std::uint32_t id = find_tag(tag); id != untagged) { return id; }
+
+        const auto by_name = [this](std::uint32_t id, std::string_view name) { return tags_[id].name < name; };
+        std::uint32_t id = untagged;
+        if (idle_tags_ > 0)
+        {
+            // Recycle an idle slot (and its string capacity) rather than grow.
+            const auto slot = std::find_if(tags_.begin(), tags_.end(), [](const TagSlot &s) { return !s.pending; });
+            id = static_cast<std::uint32_t>(slot - tags_.begin());
+            const auto stale = std::lower_bound(tags_by_name_.begin(), tags_by_name_.end(), slot->name, by_name);
+            slot->name.assign(tag);
+            tags_by_name_.erase(stale);
+        }
+        else
+        {
+            if (tags_.size() >= untagged) { throw std::length_error("NodeScheduler tag capacity exceeded"); }
+            reserve_one(tags_by_name_);
+            tags_.push_back(TagSlot{.name = std::string{tag}});
+            id = static_cast<std::uint32_t>(tags_.size() - 1);
+            ++idle_tags_;
+        }
+        tags_by_name_.insert(std::lower_bound(tags_by_name_.begin(), tags_by_name_.end(), tag, by_name), id);
+        return id;
+    }
+
+    void NodeSchedulerState::release(std::uint32_t tag) noexcept
+    {
+        if (tag == untagged) { return; }
+        tags_[tag].pending = false;
+        ++idle_tags_;
+    }
+}  // namespace hgraph
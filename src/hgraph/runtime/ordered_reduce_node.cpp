@@ -44,9 +44,9 @@ namespace hgraph
                 destroy_current_generation();
             }
 
-            void initialise(MemoryUtils::StorageLayout graph_layout)
+            void initialise(MemoryUtils::StorageLayout graph_layout, const MemoryUtils::AllocatorOps &allocator)
             {
-                for (auto &bank : banks) { bank.bind_graph_layout(graph_layout); }
+                for (auto &bank : banks) { bank.bind_graph_layout(graph_layout, allocator); }
             }
 
             void stop_generation(std::size_t bank_index, std::size_t count) noexcept
@@ -425,7 +425,7 @@ namespace hgraph
             auto typed = view.as<OrderedReduceNodeView>();
             const auto &context = *static_cast<const OrderedReduceContext *>(typed.internal_context());
             auto &storage = *MemoryUtils::cast<OrderedReduceStorage>(typed.internal_storage());
-            storage.initialise(context.graph_layout);
+            storage.initialise(context.graph_layout, view.graph().storage_allocator());
 
             const bool resuming = storage.resume_index_plus_one != 0;
             if (!resuming)
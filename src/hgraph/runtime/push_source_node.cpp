@@ -6,9 +6,13 @@
 #include <hgraph/types/value/value_builder.h>
 #include <hgraph/util/scope.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -94,6 +98,44 @@ namespace hgraph
             return context.sender_schema == &value || context.authored_schema == &value;
         }
 
+        void validate_push_value(const PushSourcePolicyContext &context, const Value &value)
+        {
+            if (!value.has_value())
+            {
+                throw std::invalid_argument("PushSourceSender requires a live value payload");
+            }
+            const auto &value_schema = *value.schema();
+            if (context.sender_schema == nullptr ||
+                !push_value_schema_acceptable(context, value_schema))
+            {
+                throw std::invalid_argument("PushSourceSender value schema does not "
+                                            "match the push-source sender schema");
+            }
+        }
+
+        /** Move ``values`` into one homogeneous variadic tuple value. */
+        template <typename Values>
+        [[nodiscard]] Value make_burst_value(const ValueTypeRef &element_binding,
+                                             const ValueTypeRef &value_binding, Values &values)
+        {
+            if (!element_binding || !value_binding)
+            {
+                throw std::logic_error("Burst push-source queue is not initialized");
+            }
+
+            ListBuilder builder{element_binding, *value_binding.schema()};
+            for (Value &value : values)
+            {
+                builder.push_back(std::move(value));
+            }
+            ListStorage storage = builder.build_storage();
+            Value result{value_binding};
+            value_binding.ops_ref().move_assign_from(
+                value_binding, const_cast<void *>(result.view().data()),
+                value_binding, &storage);
+            return result;
+        }
+
         struct QueuePolicyStorage
         {
             void start(const PushSourcePolicyContext &context,
@@ -211,22 +253,7 @@ namespace hgraph
                 {
                     return {};
                 }
-                if (!burst_element_binding || !burst_value_binding)
-                {
-                    throw std::logic_error("Burst push-source queue is not initialized");
-                }
-
-                ListBuilder builder{burst_element_binding, *burst_value_binding.schema()};
-                for (Value &value : values)
-                {
-                    builder.push_back(std::move(value));
-                }
-                ListStorage storage = builder.build_storage();
-                Value result{burst_value_binding};
-                burst_value_binding.ops_ref().move_assign_from(
-                    burst_value_binding, const_cast<void *>(result.view().data()),
-                    burst_value_binding, &storage);
-                return result;
+                return make_burst_value(burst_element_binding, burst_value_binding, values);
             }
 
             [[nodiscard]] std::size_t pending_items() const noexcept
@@ -243,17 +270,7 @@ namespace hgraph
 
             static void validate(const PushSourcePolicyContext &context, const Value &value)
             {
-                if (!value.has_value())
-                {
-                    throw std::invalid_argument("PushSourceSender requires a live value payload");
-                }
-                const auto &value_schema = *value.schema();
-                if (context.sender_schema == nullptr ||
-                    !push_value_schema_acceptable(context, value_schema))
-                {
-                    throw std::invalid_argument("PushSourceSender value schema does not "
-                                                "match the push-source sender schema");
-                }
+                validate_push_value(context, value);
             }
 
             mutable std::mutex      mutex{};
@@ -266,6 +283,243 @@ namespace hgraph
             bool                    accepting{false};
         };
 
+        /**
+         * Bounded multi-producer / single-consumer ring of pre-allocated
+         * Value slots (the sequence-numbered cell scheme of Vyukov's bounded
+         * queue). A producer claims a slot by advancing the enqueue position
+         * with one compare-and-swap, moves its value in, then publishes the
+         * slot's sequence. The graph thread is the only consumer, so the
+         * dequeue position is plain state.
+         *
+         * ``pending`` counts published values. The producer that raises it
+         * from zero asks for a wake-up, as the deque's was-empty test does; it
+         * may dip below zero while a consumed value's producer has yet to
+         * count it. Blocked producers sleep on ``space_epoch``, which the
+         * consumer advances (and notifies only when someone waits) after
+         * freeing slots.
+         */
+        struct RingPolicyStorage
+        {
+            RingPolicyStorage() = default;
+
+            RingPolicyStorage(const RingPolicyStorage &)            = delete;
+            RingPolicyStorage &operator=(const RingPolicyStorage &) = delete;
+
+            /** Runs before any sender exists, so no producer can race it. */
+            void start(const PushSourcePolicyContext &context,
+                       const TSValueTypeMetaData *burst_output_schema = nullptr)
+            {
+                const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(context.max_pending, 2));
+                if (capacity != capacity_)
+                {
+                    cells_    = std::make_unique<Cell[]>(capacity);
+                    capacity_ = capacity;
+                }
+                for (std::size_t index = 0; index < capacity_; ++index)
+                {
+                    cells_[index].value = Value{};
+                    cells_[index].sequence.store(index, std::memory_order_relaxed);
+                }
+                enqueue_position_.store(0, std::memory_order_relaxed);
+                dequeue_position_ = 0;
+                pending_.store(0, std::memory_order_relaxed);
+
+                burst_element_binding_ = {};
+                burst_value_binding_   = {};
+                drained_.clear();
+                if (burst_output_schema != nullptr)
+                {
+                    burst_element_binding_ = ValuePlanFactory::instance().type_for(context.sender_schema);
+                    burst_value_binding_ =
+                        compact_list_type(burst_element_binding_, *burst_output_schema->value_schema);
+                    drained_.reserve(capacity_);
+                }
+                consumer_thread_ = std::this_thread::get_id();
+                accepting_.store(true, std::memory_order_release);
+            }
+
+            /** Producers may still be inside a send: only published slots are
+                released here; a late publication is reset by the next start. */
+            void stop()
+            {
+                accepting_.store(false, std::memory_order_seq_cst);
+                release_space(true);
+                Value discarded;
+                while (try_pop(discarded)) { discarded = Value{}; }
+                pending_.store(0, std::memory_order_relaxed);
+                drained_.clear();
+                burst_element_binding_ = {};
+                burst_value_binding_   = {};
+            }
+
+            [[nodiscard]] PushSourceSendResult try_send(const PushSourcePolicyContext &context, Value value)
+            {
+                if (!accepting_.load(std::memory_order_acquire))
+                {
+                    return {};
+                }
+                validate_push_value(context, value);
+                if (!try_push(value))
+                {
+                    return {};
+                }
+                return published();
+            }
+
+            [[nodiscard]] PushSourceSendResult send_blocking(const PushSourcePolicyContext &context, Value value)
+            {
+                if (!accepting_.load(std::memory_order_acquire))
+                {
+                    return {};
+                }
+                validate_push_value(context, value);
+                for (;;)
+                {
+                    const std::uint32_t epoch = space_epoch_.load(std::memory_order_seq_cst);
+                    if (try_push(value))
+                    {
+                        return published();
+                    }
+                    if (consumer_thread_ == std::this_thread::get_id())
+                    {
+                        throw std::logic_error("PushSourceSender::send_blocking cannot wait on "
+                                               "the graph evaluation thread");
+                    }
+                    // Announce the wait before re-reading the epoch; the
+                    // consumer advances the epoch before reading the count.
+                    blocked_producers_.fetch_add(1, std::memory_order_seq_cst);
+                    if (accepting_.load(std::memory_order_seq_cst) &&
+                        space_epoch_.load(std::memory_order_seq_cst) == epoch)
+                    {
+                        space_epoch_.wait(epoch, std::memory_order_seq_cst);
+                    }
+                    blocked_producers_.fetch_sub(1, std::memory_order_relaxed);
+                    if (!accepting_.load(std::memory_order_acquire))
+                    {
+                        return {};
+                    }
+                }
+            }
+
+            [[nodiscard]] std::optional<PushSourceQueuePop> try_pop_one()
+            {
+                PushSourceQueuePop result{};
+                if (!try_pop(result.value))
+                {
+                    return std::nullopt;
+                }
+                result.more_pending = pending_.fetch_sub(1, std::memory_order_acq_rel) > 1;
+                release_space(false);
+                return result;
+            }
+
+            [[nodiscard]] Value take_burst()
+            {
+                drained_.clear();
+                Value value;
+                while (try_pop(value))
+                {
+                    drained_.push_back(std::move(value));
+                }
+                if (drained_.empty())
+                {
+                    return {};
+                }
+                pending_.fetch_sub(static_cast<std::ptrdiff_t>(drained_.size()), std::memory_order_acq_rel);
+                release_space(false);
+                Value result = make_burst_value(burst_element_binding_, burst_value_binding_, drained_);
+                drained_.clear();
+                return result;
+            }
+
+            [[nodiscard]] std::size_t pending_items() const noexcept
+            {
+                return static_cast<std::size_t>(
+                    std::max<std::ptrdiff_t>(pending_.load(std::memory_order_relaxed), 0));
+            }
+
+          private:
+            struct Cell
+            {
+                std::atomic<std::size_t> sequence{0};
+                Value                    value{};
+            };
+
+            [[nodiscard]] bool try_push(Value &value)
+            {
+                std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    Cell &cell = cells_[position & (capacity_ - 1)];
+                    const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    const auto        lag      = static_cast<std::ptrdiff_t>(sequence - position);
+                    if (lag == 0)
+                    {
+                        if (enqueue_position_.compare_exchange_weak(position, position + 1,
+                                                                    std::memory_order_relaxed))
+                        {
+                            cell.value = std::move(value);
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (lag < 0)
+                    {
+                        return false;  // full: the slot still holds a value from the previous lap
+                    }
+                    else
+                    {
+                        position = enqueue_position_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            [[nodiscard]] bool try_pop(Value &out)
+            {
+                if (cells_ == nullptr)
+                {
+                    return false;
+                }
+                Cell &cell = cells_[dequeue_position_ & (capacity_ - 1)];
+                if (cell.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1)
+                {
+                    return false;
+                }
+                out = std::move(cell.value);
+                cell.sequence.store(dequeue_position_ + capacity_, std::memory_order_release);
+                ++dequeue_position_;
+                return true;
+            }
+
+            [[nodiscard]] PushSourceSendResult published() noexcept
+            {
+                return {.accepted      = true,
+                        .wake_required = pending_.fetch_add(1, std::memory_order_acq_rel) == 0};
+            }
+
+            void release_space(bool always_notify) noexcept
+            {
+                space_epoch_.fetch_add(1, std::memory_order_seq_cst);
+                if (always_notify || blocked_producers_.load(std::memory_order_seq_cst) != 0)
+                {
+                    space_epoch_.notify_all();
+                }
+            }
+
+            std::unique_ptr<Cell[]> cells_{};
+            std::size_t             capacity_{0};
+            alignas(64) std::atomic<std::size_t> enqueue_position_{0};
+            alignas(64) std::size_t dequeue_position_{0};
+            std::atomic<std::ptrdiff_t> pending_{0};
+            std::atomic<std::uint32_t>  space_epoch_{0};
+            std::atomic<std::uint32_t>  blocked_producers_{0};
+            std::atomic<bool>           accepting_{false};
+            std::thread::id             consumer_thread_{};
+            ValueTypeRef                burst_element_binding_{};
+            ValueTypeRef                burst_value_binding_{};
+            std::vector<Value>          drained_{};
+        };
+
         struct ConflatingPolicyStorage
         {
             void start(const TSValueTypeMetaData &schema)
@@ -357,7 +611,8 @@ namespace hgraph
         /** Shared lifetime boundary between retained producer handles and the
          * graph-owned policy storage. Closing prevents new calls; graph stop
          * then wakes policy waiters and waits for entered calls before node
-         * storage can be destroyed. */
+         * storage can be destroyed. Entering and leaving a call touch only
+         * atomics, so concurrent producers do not serialise here. */
         class PushSourceSenderControl
         {
           public:
@@ -372,14 +627,14 @@ namespace hgraph
             [[nodiscard]] bool valid() const noexcept
             {
                 std::lock_guard lock{mutex_};
-                return !closing_ && storage_ != nullptr && push_engine_.valid() &&
+                return !closing_.load() && storage_ != nullptr && push_engine_.valid() &&
                        !push_engine_.stop_requested();
             }
 
             [[nodiscard]] const TypeRealizationSnapshot *type_realization() const noexcept
             {
                 std::lock_guard lock{mutex_};
-                return !closing_ && storage_ != nullptr ? type_realization_ : nullptr;
+                return !closing_.load() && storage_ != nullptr ? type_realization_ : nullptr;
             }
 
             [[nodiscard]] bool try_send(Value value)
@@ -431,13 +686,15 @@ namespace hgraph
             void begin_close() noexcept
             {
                 std::lock_guard lock{mutex_};
-                closing_ = true;
+                closing_.store(true);
             }
 
             void wait_for_quiescence() noexcept
             {
-                std::unique_lock lock{mutex_};
-                quiescent_.wait(lock, [this] { return active_calls_ == 0; });
+                for (std::size_t calls = active_calls_.load(); calls != 0; calls = active_calls_.load())
+                {
+                    active_calls_.wait(calls);
+                }
             }
 
             void detach() noexcept
@@ -449,34 +706,37 @@ namespace hgraph
             }
 
           private:
+            // Sequentially consistent: a call counts itself before reading
+            // ``closing_`` and a close sets ``closing_`` before reading the
+            // count, so either the call backs out or the close waits for it.
+            // Detach follows quiescence, so an entered call may read the
+            // policy, storage and engine without the mutex.
             [[nodiscard]] bool enter() noexcept
             {
-                std::lock_guard lock{mutex_};
-                if (closing_ || storage_ == nullptr)
+                active_calls_.fetch_add(1);
+                if (closing_.load())
                 {
+                    leave();
                     return false;
                 }
-                ++active_calls_;
                 return true;
             }
 
             void leave() noexcept
             {
-                std::lock_guard lock{mutex_};
-                if (--active_calls_ == 0)
+                if (active_calls_.fetch_sub(1) == 1 && closing_.load())
                 {
-                    quiescent_.notify_all();
+                    active_calls_.notify_all();
                 }
             }
 
             mutable std::mutex      mutex_{};
-            std::condition_variable quiescent_{};
             PushSourcePolicy        policy_{};
             void                   *storage_{nullptr};
             PushQueueEngineView     push_engine_{};
             const TypeRealizationSnapshot *type_realization_{nullptr};
-            std::size_t              active_calls_{0};
-            bool                     closing_{false};
+            std::atomic<std::size_t> active_calls_{0};
+            std::atomic<bool>        closing_{false};
         };
     }  // namespace detail
 
@@ -768,6 +1028,68 @@ namespace hgraph
                 ->pending_items();
         }
 
+        void ring_queue_policy_start(const void *context, void *storage, const TSValueTypeMetaData &)
+        {
+            MemoryUtils::cast<detail::RingPolicyStorage>(storage)->start(policy_context(context));
+        }
+
+        void ring_burst_policy_start(const void *context, void *storage,
+                                     const TSValueTypeMetaData &output_schema)
+        {
+            MemoryUtils::cast<detail::RingPolicyStorage>(storage)->start(policy_context(context), &output_schema);
+        }
+
+        void ring_policy_stop(const void *, void *storage)
+        {
+            MemoryUtils::cast<detail::RingPolicyStorage>(storage)->stop();
+        }
+
+        [[nodiscard]] detail::PushSourceSendResult ring_policy_try_send(
+            const void *context, void *storage, Value value)
+        {
+            return MemoryUtils::cast<detail::RingPolicyStorage>(storage)->try_send(
+                policy_context(context), std::move(value));
+        }
+
+        [[nodiscard]] detail::PushSourceSendResult ring_policy_send_blocking(
+            const void *context, void *storage, Value value)
+        {
+            return MemoryUtils::cast<detail::RingPolicyStorage>(storage)->send_blocking(
+                policy_context(context), std::move(value));
+        }
+
+        [[nodiscard]] bool ring_queue_policy_emit_next(
+            const void *, void *storage, const TSOutputView &output)
+        {
+            auto item = MemoryUtils::cast<detail::RingPolicyStorage>(storage)->try_pop_one();
+            if (!item.has_value())
+            {
+                return false;
+            }
+
+            apply_delta(output, item->value.view());
+            return item->more_pending;
+        }
+
+        [[nodiscard]] bool ring_burst_policy_emit_next(
+            const void *, void *storage, const TSOutputView &output)
+        {
+            Value burst = MemoryUtils::cast<detail::RingPolicyStorage>(storage)->take_burst();
+            if (!burst.has_value())
+            {
+                return false;
+            }
+
+            apply_current_value(output, burst.view());
+            return false;
+        }
+
+        [[nodiscard]] std::size_t ring_policy_pending_items(
+            const void *, const void *storage) noexcept
+        {
+            return MemoryUtils::cast<const detail::RingPolicyStorage>(storage)->pending_items();
+        }
+
         [[nodiscard]] const detail::PushSourcePolicyOps &queue_policy_ops()
         {
             static const detail::PushSourcePolicyOps ops{
@@ -816,6 +1138,38 @@ namespace hgraph
             return ops;
         }
 
+        [[nodiscard]] const detail::PushSourcePolicyOps &ring_queue_policy_ops()
+        {
+            static const detail::PushSourcePolicyOps ops{
+                .storage_plan = &MemoryUtils::plan_for<detail::RingPolicyStorage>(),
+                .sender_schema_impl = &sender_schema_impl,
+                .output_compatible_impl = &delta_output_compatible,
+                .start_impl = &ring_queue_policy_start,
+                .stop_impl = &ring_policy_stop,
+                .try_send_impl = &ring_policy_try_send,
+                .send_blocking_impl = &ring_policy_send_blocking,
+                .emit_next_impl = &ring_queue_policy_emit_next,
+                .pending_items_impl = &ring_policy_pending_items,
+            };
+            return ops;
+        }
+
+        [[nodiscard]] const detail::PushSourcePolicyOps &ring_burst_policy_ops()
+        {
+            static const detail::PushSourcePolicyOps ops{
+                .storage_plan = &MemoryUtils::plan_for<detail::RingPolicyStorage>(),
+                .sender_schema_impl = &sender_schema_impl,
+                .output_compatible_impl = &burst_output_compatible,
+                .start_impl = &ring_burst_policy_start,
+                .stop_impl = &ring_policy_stop,
+                .try_send_impl = &ring_policy_try_send,
+                .send_blocking_impl = &ring_policy_send_blocking,
+                .emit_next_impl = &ring_burst_policy_emit_next,
+                .pending_items_impl = &ring_policy_pending_items,
+            };
+            return ops;
+        }
+
         struct PushSourceNodeContext
         {
             const TSValueTypeMetaData *output_schema{nullptr};
@@ -1106,20 +1460,53 @@ namespace hgraph
             output_schema.authored_delta_schema, max_pending);
     }
 
-    PushSourcePolicy make_push_source_burst_policy(
-        const TSValueTypeMetaData &output_schema, std::size_t max_pending)
+    namespace
     {
-        const auto *value_schema = output_schema.value_schema;
-        if (output_schema.kind != TSTypeKind::TS || value_schema == nullptr ||
-            value_schema->try_value_kind() != ValueTypeKind::List ||
-            value_schema->fixed_size != 0 || !value_schema->is_variadic_tuple() ||
-            value_schema->is_mutable() || value_schema->is_nullable() ||
-            value_schema->element_type == nullptr)
+        [[nodiscard]] const ValueTypeMetaData &burst_element_schema(const TSValueTypeMetaData &output_schema)
         {
-            throw std::invalid_argument("Burst push source requires TS[tuple[SCALAR, ...]] output");
+            const auto *value_schema = output_schema.value_schema;
+            if (output_schema.kind != TSTypeKind::TS || value_schema == nullptr ||
+                value_schema->try_value_kind() != ValueTypeKind::List ||
+                value_schema->fixed_size != 0 || !value_schema->is_variadic_tuple() ||
+                value_schema->is_mutable() || value_schema->is_nullable() ||
+                value_schema->element_type == nullptr)
+            {
+                throw std::invalid_argument("Burst push source requires TS[tuple[SCALAR, ...]] output");
+            }
+            return *value_schema->element_type;
+        }
+
+        void require_ring_capacity(std::size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("Ring push-source policy requires a non-zero capacity");
+            }
         }
+    }  // namespace
+
+    PushSourcePolicy make_push_source_burst_policy(
+        const TSValueTypeMetaData &output_schema, std::size_t max_pending)
+    {
+        return make_policy(
+            burst_policy_ops(), burst_element_schema(output_schema), nullptr, max_pending);
+    }
+
+    PushSourcePolicy make_push_source_ring_queue_policy(
+        const TSValueTypeMetaData &output_schema, std::size_t capacity)
+    {
+        require_ring_capacity(capacity);
+        return make_policy(
+            ring_queue_policy_ops(), *output_schema.delta_value_schema,
+            output_schema.authored_delta_schema, capacity);
+    }
+
+    PushSourcePolicy make_push_source_ring_burst_policy(
+        const TSValueTypeMetaData &output_schema, std::size_t capacity)
+    {
+        require_ring_capacity(capacity);
         return make_policy(
-            burst_policy_ops(), *value_schema->element_type, nullptr, max_pending);
+            ring_burst_policy_ops(), burst_element_schema(output_schema), nullptr, capacity);
     }
 
     PushSourcePolicy make_push_source_conflating_policy(const ValueTypeMetaData &sender_schema)
@@ -86,9 +86,9 @@ namespace hgraph
                 destroy_combiners();
             }
 
-            void initialise(MemoryUtils::StorageLayout graph_layout)
+            void initialise(MemoryUtils::StorageLayout graph_layout, const MemoryUtils::AllocatorOps &allocator)
             {
-                for (auto &bank : combiner_banks) { bank.bind_graph_layout(graph_layout); }
+                for (auto &bank : combiner_banks) { bank.bind_graph_layout(graph_layout, allocator); }
             }
 
             // Root-first (ascending heap index) teardown: a parent combiner's
@@ -1317,7 +1317,7 @@ namespace hgraph
             auto        reduce_view = view.as<ReduceNodeView>();
             const auto &context     = *static_cast<const ReduceNodeContext *>(reduce_view.internal_context());
             auto       &storage     = *MemoryUtils::cast<ReduceNodeStorage>(reduce_view.internal_storage());
-            storage.initialise(context.graph_layout);
+            storage.initialise(context.graph_layout, view.graph().storage_allocator());
 
             const bool resuming = storage.resume_candidate_plus_one != 0;
             if (!resuming)
@@ -1,5 +1,6 @@
 #include <hgraph/runtime/registry_snapshot.h>
 #include <hgraph/types/metadata/type_record_registry.h>
+#include <hgraph/types/operator_dispatch.h>
 #include <hgraph/types/utils/counted_mutex.h>
 
 #include "registry_snapshot_detail.h"
@@ -8,6 +9,7 @@ namespace hgraph
 {
     RuntimeRegistrySnapshot runtime_registry_snapshot()
     {
+        const OperatorResolutionCacheStats resolution = OperatorRegistry::instance().resolution_cache_stats();
         return RuntimeRegistrySnapshot{
             .node_runtime_types = detail::node_runtime_type_count(),
             .graph_programs = detail::graph_program_count(),
@@ -15,6 +17,9 @@ namespace hgraph
             .executor_runtime_types = detail::executor_runtime_type_count(),
             .type_records = TypeRecordRegistry::instance().size(),
             .type_system_lock_acquisitions = type_system_lock_count(),
+            .operator_resolution_cache_entries = resolution.entries,
+            .operator_resolution_cache_hits = resolution.hits,
+            .operator_resolution_cache_misses = resolution.misses,
         };
     }
 }  // namespace hgraph
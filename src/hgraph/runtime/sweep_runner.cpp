@@ -0,0 +1,76 @@
+#include <hgraph/runtime/sweep_runner.h>
+
+#include "evaluation_thread_pool.h"
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace hgraph
+{
+    namespace
+    {
+        [[nodiscard]] std::size_t sweep_concurrency(std::size_t threads) noexcept
+        {
+            if (threads != 0) { return threads; }
+            return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+    }  // namespace
+
+    SweepRunner::SweepRunner(GraphExecutorBuilder builder, std::size_t threads)
+        : builder_(std::move(builder))
+    {
+        if (builder_.mode() != GraphExecutorMode::Simulation)
+        {
+            throw std::invalid_argument("SweepRunner requires a simulation graph executor builder");
+        }
+        builder_.parallel_evaluation(0);
+        // Compile every lazily built record now, on this thread: runs only
+        // read them afterwards.
+        static_cast<void>(builder_.type());
+        static_cast<void>(builder_.graph_type());
+        static_cast<void>(builder_.graph_builder().type_realization());
+        // Each run is a whole executor, so its thread is that run's run
+        // thread rather than a pool item.
+        pool_ = std::make_unique<runtime_detail::EvaluationThreadPool>(sweep_concurrency(threads), true);
+    }
+
+    SweepRunner::~SweepRunner() = default;
+
+    std::size_t SweepRunner::threads() const noexcept { return pool_->concurrency(); }
+
+    std::vector<SweepResult> SweepRunner::run(std::span<const SweepRun> runs, const SweepCollector &collect)
+    {
+        std::vector<SweepResult> results(runs.size());
+        std::mutex               construct_mutex;
+        pool_->parallel_for(runs.size(), [&](std::size_t index) {
+            const SweepRun &run    = runs[index];
+            SweepResult    &result = results[index];
+            try
+            {
+                // Built in place: the root graph keeps a pointer to its executor.
+                std::optional<GraphExecutorValue> executor;
+                {
+                    std::lock_guard lock{construct_mutex};
+                    executor.emplace(builder_, run.start_time.value_or(builder_.start_time()),
+                                     run.end_time.value_or(builder_.end_time()));
+                }
+                const GraphExecutorView view        = executor->view();
+                const GlobalStateView   run_globals = view.graph().global_state();
+                for (const auto &[key, value] : run.global_state) { run_globals.set(key, value); }
+
+                view.run();
+
+                result.global_state.view().copy_from(run_globals);
+                if (collect) { result.value = collect(index, view); }
+            }
+            catch (...)
+            {
+                result.error = std::current_exception();
+            }
+        });
+        return results;
+    }
+}  // namespace hgraph
@@ -18,15 +18,44 @@ constexpr std::string_view switch_storage_field_name{"switch"};
 constexpr std::string_view switch_graph_memory_field_name{
     "switch_graph_memory"};
 
+/** A stopped, still-constructed branch graph kept for restart. */
+struct WarmBranch {
+  std::size_t slot{0};
+  const SingleNestedGraphNodeSpec *spec{nullptr};
+};
+
 struct SwitchNodeStorage {
   std::array<GraphValue, 2> graphs{};
+  /** Slots ``2..`` when warm branches are enabled, allocated on first use. */
+  std::unique_ptr<GraphValue[]> warm_graphs{};
   std::optional<std::size_t> active_slot{};
   std::optional<std::size_t> previous_slot{};
+  /** Warm branches, least recently used first. */
+  std::vector<WarmBranch> warm{};
+  std::size_t warm_restarts{0};
   Value active_key{};
   const SingleNestedGraphNodeSpec *active_spec{nullptr};
 
+  [[nodiscard]] GraphValue &graph(std::size_t slot) noexcept {
+    return slot < graphs.size() ? graphs[slot]
+                                : warm_graphs[slot - graphs.size()];
+  }
+
+  [[nodiscard]] const GraphValue &graph(std::size_t slot) const noexcept {
+    return slot < graphs.size() ? graphs[slot]
+                                : warm_graphs[slot - graphs.size()];
+  }
+
+  [[nodiscard]] bool has_graph(std::size_t slot) const noexcept {
+    if (slot < graphs.size()) {
+      return graphs[slot].has_value();
+    }
+    return warm_graphs != nullptr &&
+           warm_graphs[slot - graphs.size()].has_value();
+  }
+
   [[nodiscard]] GraphValue *active_graph() noexcept {
-    return active_slot.has_value() ? &graphs[*active_slot] : nullptr;
+    return active_slot.has_value() ? &graph(*active_slot) : nullptr;
   }
 };
 
@@ -36,6 +65,12 @@ struct SwitchNodeContext {
   std::size_t graph_memory_offset{0};
   std::size_t graph_slot_stride{0};
   MemoryUtils::StorageLayout graph_slot_layout{};
+
+  /** The active graph, ``warm_branches`` warm graphs, and the slot a new
+      branch is built in while the active one still runs. */
+  [[nodiscard]] std::size_t slot_count() const noexcept {
+    return spec.warm_branches + 2;
+  }
 };
 
 [[nodiscard]] MemoryUtils::StorageLayout
@@ -82,21 +117,46 @@ register_switch_node_context(SwitchNodeSpec spec, std::size_t storage_offset,
   return result;
 }
 
+/**
+ * Storage a stopped branch graph holds beyond the switch node's static
+ * bytes: its nodes' dynamic storage, and its graph storage when that lives
+ * outside the in-place slot. Its stopped nodes are no longer observed, so
+ * the switch reports this for them.
+ */
+[[nodiscard]] NodeStorageMetrics
+stopped_graph_storage_metrics(const GraphValue &graph) noexcept {
+  NodeStorageMetrics result{};
+  if (!graph.uses_external_storage()) {
+    result.dynamic_live_bytes = graph.type().checked_plan().layout.size;
+    result.dynamic_reserved_bytes = result.dynamic_live_bytes;
+  }
+  const GraphView view = graph.view();
+  for (std::size_t index = 0; index < view.node_count(); ++index) {
+    const NodeStorageMetrics node = view.node_at(index).storage_metrics();
+    result.dynamic_live_bytes += node.dynamic_live_bytes;
+    result.dynamic_reserved_bytes += node.dynamic_reserved_bytes;
+  }
+  return result;
+}
+
 [[nodiscard]] NodeStorageMetrics switch_storage_metrics(
     const void *raw_context, const void *memory) noexcept {
   const auto &context = *static_cast<const SwitchNodeContext *>(raw_context);
   const auto &storage = *MemoryUtils::cast<const SwitchNodeStorage>(
       MemoryUtils::advance(memory, context.storage_offset));
-  std::size_t count = 0;
-  for (const GraphValue &graph : storage.graphs) {
-    if (graph.has_value()) {
-      ++count;
+  NodeStorageMetrics result{.nested_graph_capacity = context.slot_count()};
+  for (std::size_t slot = 0; slot < context.slot_count(); ++slot) {
+    if (storage.has_graph(slot)) {
+      ++result.nested_graph_count;
     }
   }
-  return NodeStorageMetrics{
-      .nested_graph_count = count,
-      .nested_graph_capacity = storage.graphs.size(),
-  };
+  for (const WarmBranch &warm : storage.warm) {
+    const NodeStorageMetrics graph =
+        stopped_graph_storage_metrics(storage.graph(warm.slot));
+    result.dynamic_live_bytes += graph.dynamic_live_bytes;
+    result.dynamic_reserved_bytes += graph.dynamic_reserved_bytes;
+  }
+  return result;
 }
 
 void visit_switch_children(const void *raw_context, const NodeBuilder &,
@@ -288,6 +348,27 @@ select_branch(const SwitchNodeContext &context, const Value &key) {
   return nullptr;
 }
 
+/**
+ * Keep a just-stopped branch graph. Without warm branches it waits in the
+ * previous slot: a consumer may still read its terminal this cycle, so its
+ * destructor runs on the following switch. With warm branches it joins the
+ * LRU as most recently used, and the least recently used graph beyond the
+ * bound is destroyed at once; it was retired on an earlier switch, so
+ * nothing reads it any more.
+ */
+void retain_retired(const SwitchNodeContext &context, SwitchNodeStorage &storage,
+                    std::size_t slot, const SingleNestedGraphNodeSpec *spec) {
+  if (context.spec.warm_branches == 0 || spec == nullptr) {
+    storage.previous_slot = slot;
+    return;
+  }
+  storage.warm.push_back(WarmBranch{.slot = slot, .spec = spec});
+  if (storage.warm.size() > context.spec.warm_branches) {
+    storage.graph(storage.warm.front().slot) = GraphValue{};
+    storage.warm.erase(storage.warm.begin());
+  }
+}
+
 void switch_teardown(const NodeView &view, const SwitchNodeContext &context,
                      SwitchNodeStorage &storage, DateTime evaluation_time,
                      bool reset_output = true) {
@@ -302,36 +383,69 @@ void switch_teardown(const NodeView &view, const SwitchNodeContext &context,
   if (reset_output) {
     reset_switch_output(view, evaluation_time);
   }
-  storage.previous_slot = storage.active_slot;
+  retain_retired(context, storage, *storage.active_slot, storage.active_spec);
   storage.active_slot.reset();
   storage.active_key = Value{};
   storage.active_spec = nullptr;
 }
 
+/** Take the warm graph of ``spec`` out of the LRU, if one is kept. */
+[[nodiscard]] std::optional<std::size_t>
+take_warm_branch(SwitchNodeStorage &storage,
+                 const SingleNestedGraphNodeSpec &spec) {
+  const auto found = std::ranges::find(storage.warm, &spec, &WarmBranch::spec);
+  if (found == storage.warm.end()) {
+    return std::nullopt;
+  }
+  const std::size_t slot = found->slot;
+  storage.warm.erase(found);
+  return slot;
+}
+
+[[nodiscard]] std::size_t free_slot(const SwitchNodeContext &context,
+                                    const SwitchNodeStorage &storage) {
+  for (std::size_t slot = 0; slot < context.slot_count(); ++slot) {
+    if (!storage.has_graph(slot)) {
+      return slot;
+    }
+  }
+  throw std::logic_error("switch_ has no free branch graph slot");
+}
+
 void activate_branch(const NodeView &view, const SwitchNodeContext &context,
                      SwitchNodeStorage &storage,
                      const SingleNestedGraphNodeSpec &spec, Value key,
-                     DateTime evaluation_time) {
+                     DateTime evaluation_time, bool allow_warm) {
+  // The previous slot holds the graph retired on the previous switch. Its
+  // stop phase has already completed, so it can now be destructed and the
+  // same fixed memory reused for the new branch.
+  if (storage.previous_slot.has_value()) {
+    storage.graph(*storage.previous_slot) = GraphValue{};
+    storage.previous_slot.reset();
+  }
+  if (context.spec.warm_branches != 0 && storage.warm_graphs == nullptr) {
+    storage.warm_graphs =
+        std::make_unique<GraphValue[]>(context.spec.warm_branches);
+  }
+
+  // A warm graph is restarted in place: start rebinds the edges its stop
+  // tore down, and the boundary is bound and sampled below exactly as for
+  // a new graph.
+  const std::optional<std::size_t> warm_slot =
+      allow_warm ? take_warm_branch(storage, spec) : std::nullopt;
   const std::size_t next_slot =
-      storage.active_slot.has_value() ? 1U - *storage.active_slot : 0U;
-
-  // This slot contains the graph retired on the previous switch. Its
-  // stop phase has already completed, so it can now be destructed and
-  // the same fixed memory reused for the new branch.
-  if (storage.previous_slot.has_value() &&
-      *storage.previous_slot != next_slot) {
-    throw std::logic_error(
-        "switch_ previous graph does not occupy the reusable slot");
-  }
-  storage.graphs[next_slot] = GraphValue{};
-  storage.previous_slot.reset();
-  storage.graphs[next_slot] = spec.graph_builder.make_nested_graph(
-      view.pointer(), switch_graph_memory(view, context, next_slot),
-      context.graph_slot_layout);
-
-  auto next = storage.graphs[next_slot].view();
-  auto construction_rollback =
-      UnwindCleanupGuard([&] { storage.graphs[next_slot] = GraphValue{}; });
+      warm_slot.has_value() ? *warm_slot : free_slot(context, storage);
+  if (warm_slot.has_value()) {
+    ++storage.warm_restarts;
+  } else {
+    storage.graph(next_slot) = spec.graph_builder.make_nested_graph(
+        view.pointer(), switch_graph_memory(view, context, next_slot),
+        context.graph_slot_layout);
+  }
+
+  auto next = storage.graph(next_slot).view();
+  auto construction_rollback = UnwindCleanupGuard(
+      [&] { storage.graph(next_slot) = GraphValue{}; });
   bind_branch_inputs(view, spec, next, evaluation_time, true);
   construction_rollback.release();
 
@@ -340,8 +454,9 @@ void activate_branch(const NodeView &view, const SwitchNodeContext &context,
     bind_branch_output(view, context, spec, next, evaluation_time, true);
     if (active != nullptr && active->has_value()) {
       active->view().stop(evaluation_time);
+      retain_retired(context, storage, *storage.active_slot,
+                     storage.active_spec);
     }
-    storage.previous_slot = storage.active_slot;
     storage.active_slot.reset();
     storage.active_key = Value{};
     storage.active_spec = nullptr;
@@ -396,8 +511,10 @@ bool switch_evaluate(const NodeView &view, DateTime evaluation_time) {
             key_value.to_string() + " (and no default branch)");
       }
 
+      // A reload of the same key builds a fresh graph rather than
+      // restarting a warm one.
       activate_branch(view, context, storage, *spec, std::move(key_value),
-                      evaluation_time);
+                      evaluation_time, !same_key);
     }
   }
 
@@ -453,7 +570,7 @@ bool SwitchNodeView::has_active_branch() const noexcept {
 
 GraphValue &SwitchNodeView::active_graph_value() const noexcept {
   auto &storage = *MemoryUtils::cast<SwitchNodeStorage>(storage_);
-  return storage.graphs[*storage.active_slot];
+  return storage.graph(*storage.active_slot);
 }
 
 const Value &SwitchNodeView::active_key() const noexcept {
@@ -461,15 +578,46 @@ const Value &SwitchNodeView::active_key() const noexcept {
 }
 
 std::size_t SwitchNodeView::stored_graph_count() const noexcept {
+  const auto &context = *static_cast<const SwitchNodeContext *>(context_);
   const auto &storage = *MemoryUtils::cast<SwitchNodeStorage>(storage_);
-  return static_cast<std::size_t>(storage.graphs[0].has_value()) +
-         static_cast<std::size_t>(storage.graphs[1].has_value());
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < context.slot_count(); ++slot) {
+    count += static_cast<std::size_t>(storage.has_graph(slot));
+  }
+  return count;
+}
+
+std::size_t SwitchNodeView::warm_graph_count() const noexcept {
+  return MemoryUtils::cast<SwitchNodeStorage>(storage_)->warm.size();
+}
+
+std::size_t SwitchNodeView::warm_graph_capacity() const noexcept {
+  return static_cast<const SwitchNodeContext *>(context_)->spec.warm_branches;
+}
+
+std::size_t SwitchNodeView::warm_graph_bytes() const noexcept {
+  const auto &storage = *MemoryUtils::cast<SwitchNodeStorage>(storage_);
+  std::size_t bytes = 0;
+  for (const WarmBranch &warm : storage.warm) {
+    const GraphValue &graph = storage.graph(warm.slot);
+    bytes += stopped_graph_storage_metrics(graph).dynamic_live_bytes;
+    if (graph.uses_external_storage()) {
+      bytes += graph.type().checked_plan().layout.size;
+    }
+  }
+  return bytes;
+}
+
+std::size_t SwitchNodeView::warm_restart_count() const noexcept {
+  return MemoryUtils::cast<SwitchNodeStorage>(storage_)->warm_restarts;
 }
 
 bool SwitchNodeView::child_graphs_use_in_place_storage() const noexcept {
+  const auto &context = *static_cast<const SwitchNodeContext *>(context_);
   const auto &storage = *MemoryUtils::cast<SwitchNodeStorage>(storage_);
-  for (const GraphValue &graph : storage.graphs) {
-    if (graph.has_value() && !graph.uses_external_storage()) {
+  for (std::size_t slot = 0; slot < context.slot_count(); ++slot) {
+    if (storage.has_graph(slot) &&
+        !storage.graph(slot).uses_external_storage()) {
       return false;
     }
   }
@@ -527,7 +675,8 @@ NodeBuilder switch_node(NodeTypeMetaData meta, SwitchNodeSpec spec) {
       switch_graph_slot_layout(spec);
   const auto &graph_slot_plan =
       MemoryUtils::raw_storage_plan(graph_slot_layout);
-  const auto &graph_memory_plan = MemoryUtils::array_plan(graph_slot_plan, 2);
+  const auto &graph_memory_plan =
+      MemoryUtils::array_plan(graph_slot_plan, spec.warm_branches + 2);
   const std::array fields{
       NodeStorageField{
           .name = switch_graph_memory_field_name,
@@ -0,0 +1,123 @@
+#include "thread_affinity.h"
+
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace hgraph::runtime_detail
+{
+    namespace
+    {
+        [[maybe_unused]] [[noreturn]] void throw_unaddressable(std::size_t cpu)
+        {
+            throw std::invalid_argument("evaluation CPU " + std::to_string(cpu) +
+                                        " cannot be addressed on this platform");
+        }
+
+#if defined(__linux__)
+        [[nodiscard]] std::vector<std::size_t> current_cpus()
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (const int error = pthread_getaffinity_np(pthread_self(), sizeof(set), &set); error != 0)
+            {
+                throw std::system_error(error, std::generic_category(), "pthread_getaffinity_np");
+            }
+            std::vector<std::size_t> cpus;
+            for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &set)) { cpus.push_back(cpu); }
+            }
+            return cpus;
+        }
+
+        void set_cpus(std::span<const std::size_t> cpus)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (const std::size_t cpu : cpus)
+            {
+                if (cpu >= CPU_SETSIZE) { throw_unaddressable(cpu); }
+                CPU_SET(cpu, &set);
+            }
+            if (const int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); error != 0)
+            {
+                throw std::system_error(error, std::generic_category(), "pthread_setaffinity_np");
+            }
+        }
+#elif defined(_WIN32)
+        constexpr std::size_t mask_bits = sizeof(DWORD_PTR) * 8;
+
+        [[nodiscard]] DWORD_PTR to_mask(std::span<const std::size_t> cpus)
+        {
+            DWORD_PTR mask = 0;
+            for (const std::size_t cpu : cpus)
+            {
+                if (cpu >= mask_bits) { throw_unaddressable(cpu); }
+                mask |= DWORD_PTR{1} << cpu;
+            }
+            return mask;
+        }
+
+        /** Windows reports the old mask only when setting a new one. */
+        [[nodiscard]] std::vector<std::size_t> exchange_cpus(std::span<const std::size_t> cpus)
+        {
+            const DWORD_PTR previous = SetThreadAffinityMask(GetCurrentThread(), to_mask(cpus));
+            if (previous == 0)
+            {
+                throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                        "SetThreadAffinityMask");
+            }
+            std::vector<std::size_t> result;
+            for (std::size_t cpu = 0; cpu < mask_bits; ++cpu)
+            {
+                if ((previous >> cpu) & 1U) { result.push_back(cpu); }
+            }
+            return result;
+        }
+#endif
+    }  // namespace
+
+    ThreadAffinityScope::ThreadAffinityScope(std::span<const std::size_t> cpus)
+    {
+        if (cpus.empty()) { return; }
+#if defined(__linux__)
+        std::vector<std::size_t> previous = current_cpus();
+        set_cpus(cpus);
+        previous_ = std::move(previous);
+#elif defined(_WIN32)
+        previous_ = exchange_cpus(cpus);
+#else
+        throw std::invalid_argument("evaluation CPU affinity is not supported on this platform");
+#endif
+    }
+
+    ThreadAffinityScope::~ThreadAffinityScope()
+    {
+        if (previous_.empty()) { return; }
+        // Best effort: the previous mask was accepted once, and a destructor
+        // has no caller to report a refusal to.
+        try
+        {
+#if defined(__linux__)
+            set_cpus(previous_);
+#elif defined(_WIN32)
+            static_cast<void>(exchange_cpus(previous_));
+#endif
+        }
+        catch (...)
+        {
+        }
+    }
+}  // namespace hgraph::runtime_detail
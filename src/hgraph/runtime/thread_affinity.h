@@ -0,0 +1,57 @@
+#ifndef HGRAPH_RUNTIME_THREAD_AFFINITY_H
+#define HGRAPH_RUNTIME_THREAD_AFFINITY_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace hgraph::runtime_detail
+{
+    /** Hint to the core that the caller is in a polling loop: ``pause`` on
+        x86 and ``yield`` on ARM, which ease pipeline and SMT-sibling pressure
+        without giving up the core. */
+    inline void cpu_relax() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /**
+     * Pins the calling thread to a set of CPUs for the scope's lifetime and
+     * restores its previous affinity on destruction. An empty set leaves the
+     * thread untouched.
+     *
+     * Throws ``std::invalid_argument`` for a CPU the platform cannot address,
+     * or on a platform without thread affinity (anything but Linux and
+     * Windows), and ``std::system_error`` when the OS rejects the mask.
+     */
+    class ThreadAffinityScope
+    {
+      public:
+        explicit ThreadAffinityScope(std::span<const std::size_t> cpus);
+        ~ThreadAffinityScope();
+
+        ThreadAffinityScope(const ThreadAffinityScope &)            = delete;
+        ThreadAffinityScope &operator=(const ThreadAffinityScope &) = delete;
+        ThreadAffinityScope(ThreadAffinityScope &&)                 = delete;
+        ThreadAffinityScope &operator=(ThreadAffinityScope &&)      = delete;
+
+      private:
+        /** CPUs the thread could run on before pinning; empty when nothing
+            was pinned. */
+        std::vector<std::size_t> previous_{};
+    };
+}  // namespace hgraph::runtime_detail
+
+#endif  // HGRAPH_RUNTIME_THREAD_AFFINITY_H
@@ -240,7 +240,7 @@ namespace hgraph
             auto        typed   = view.as<TslMapNodeView>();
             const auto &context = *static_cast<const TslMapNodeContext *>(typed.internal_context());
             auto       &storage = *MemoryUtils::cast<TslMapNodeStorage>(typed.internal_storage());
-            storage.entries.bind_graph_layout(context.graph_layout);
+            storage.entries.bind_graph_layout(context.graph_layout, view.graph().storage_allocator());
 
             const bool resuming         = storage.resume_index != TslMapNodeStorage::npos;
             bool       bindings_changed = false;
@@ -184,7 +184,26 @@ namespace hgraph::ts_data_plan_factory_detail
             [[nodiscard]] const void *last_element() const noexcept
             {
                 if (size_ == 0) { return nullptr; }
-                return value_slot((head_ + size_ - 1) % capacity_);
+                return value_slot(physical_index(size_ - 1));
+            }
+
+            /** The live slots as the run from the head to the end of the
+                ring, then the run that wrapped to its start. */
+            [[nodiscard]] TSWSegments segments() const noexcept
+            {
+                TSWSegments result{.value_stride = value_stride()};
+                if (size_ == 0) { return result; }
+                const std::size_t first = std::min(size_, capacity_ - head_);
+                result.values[0]        = value_bytes_ + head_ * result.value_stride;
+                result.times[0]         = MemoryUtils::cast<DateTime>(time_slot(head_));
+                result.sizes[0]         = first;
+                if (first < size_)
+                {
+                    result.values[1] = value_bytes_;
+                    result.times[1]  = MemoryUtils::cast<DateTime>(time_slot(0));
+                    result.sizes[1]  = size_ - first;
+                }
+                return result;
             }
 
           protected:
@@ -199,7 +218,7 @@ namespace hgraph::ts_data_plan_factory_detail
                     throw std::logic_error("TSW storage append requires available capacity");
                 }
 
-                const auto physical = (head_ + size_) % capacity_;
+                const auto physical = physical_index(size_);
                 copy_construct_slot(physical, source.data(), modified_time);
                 ++size_;
             }
@@ -213,7 +232,7 @@ namespace hgraph::ts_data_plan_factory_detail
                     throw std::logic_error("TSW storage append requires available capacity");
                 }
 
-                const auto physical = (head_ + size_) % capacity_;
+                const auto physical = physical_index(size_);
                 move_construct_slot(physical, const_cast<void *>(source.data()), modified_time);
                 ++size_;
             }
@@ -227,7 +246,7 @@ namespace hgraph::ts_data_plan_factory_detail
                 record_evicted(value_slot(physical), modified_time);
                 copy_assign_value_slot(physical, source.data());
                 copy_assign_time_slot(physical, modified_time);
-                head_ = (head_ + 1) % capacity_;
+                head_ = physical_index(1);
             }
 
             /** Stash the element a push is about to drop (hgraph's removed_value). */
@@ -294,9 +313,12 @@ namespace hgraph::ts_data_plan_factory_detail
                 return *MemoryUtils::cast<DateTime>(time_slot(physical));
             }
 
+            /** Ring position of a logical index no greater than the capacity;
+                one conditional subtraction rather than a division. */
             [[nodiscard]] std::size_t physical_index(std::size_t logical) const noexcept
             {
-                return capacity_ == 0 ? 0 : (head_ + logical) % capacity_;
+                const std::size_t physical = head_ + logical;
+                return physical >= capacity_ ? physical - capacity_ : physical;
             }
 
             void validate_source(const ValueView &source) const
@@ -385,7 +407,7 @@ namespace hgraph::ts_data_plan_factory_detail
                 while (size_ > 0 && time_at_physical(head_) < cutoff)
                 {
                     destroy_slot(head_);
-                    head_ = capacity_ == 0 ? 0 : (head_ + 1) % capacity_;
+                    head_ = physical_index(1);
                     --size_;
                 }
                 if (size_ == 0) { head_ = 0; }
@@ -876,6 +898,7 @@ namespace hgraph::ts_data_plan_factory_detail
                 ops.capacity_impl    = nullptr;
                 ops.full_impl        = nullptr;
                 ops.push_impl        = &window_push;
+                ops.segments_impl    = &window_segments;
                 ops.clear_impl       = &window_clear;
                 ops.cleared_time_impl = &window_cleared_time;
                 ops.evicted_time_impl    = &window_evicted_time;
@@ -919,6 +942,9 @@ namespace hgraph::ts_data_plan_factory_detail
                 value_ops.copy_construct_view_impl = &window_value_copy_construct_view;
                 value_ops.copy_assign_view_impl    = &window_value_copy_assign_view;
                 value_ops.dynamic_storage_metrics_impl = &window_dynamic_storage_metrics;
+#if HGRAPH_ENABLE_PYTHON_USER_NODES
+                value_ops.to_python_view_impl = &window_value_to_python_view;
+#endif
             }
 
             [[nodiscard]] static const TSWContextBase *ctx(const void *context) noexcept
@@ -1022,6 +1048,11 @@ namespace hgraph::ts_data_plan_factory_detail
                                  storage<Storage>(window_value_memory(context, memory)).time_element_at(index)};
             }
 
+            [[nodiscard]] static TSWSegments window_segments(const void *context, const void *memory) noexcept
+            {
+                return storage<Storage>(window_value_memory(context, memory)).segments();
+            }
+
             static void window_push(const void *context, void *memory, const ValueView &source,
                                     DateTime modified_time)
             {
@@ -1351,11 +1382,14 @@ namespace hgraph::ts_data_plan_factory_detail
                 const auto &window = storage<Storage>(memory);
                 if (ops.can_to_python_buffer(binding))
                 {
+                    const TSWSegments runs = window.segments();
                     return ops.to_python_buffer(binding,
                                                 ValueArraySource{
                                                     .owner      = memory,
                                                     .size       = window.size(),
                                                     .element_at = &window_buffer_element_at,
+                                                    .first      = {runs.values[0], runs.sizes[0], runs.value_stride},
+                                                    .second     = {runs.values[1], runs.sizes[1], runs.value_stride},
                                                 });
                 }
 
@@ -1367,6 +1401,17 @@ namespace hgraph::ts_data_plan_factory_detail
                 return result;
             }
 
+            /** Read-only NumPy view while the window occupies one run;
+                a wrapped window has no single view. */
+            [[nodiscard]] static nb::object window_value_to_python_view(const void *context, const void *memory)
+            {
+                if (memory == nullptr) { throw std::runtime_error("TSW value to_python requires live storage"); }
+                const TSWSegments runs = storage<Storage>(memory).segments();
+                if (runs.sizes[1] != 0) { return nb::object{}; }
+                return ctx(context)->layout->element_binding.ops_ref().to_python_span_view(
+                    ValueArraySpan{runs.values[0], runs.sizes[0], runs.value_stride});
+            }
+
             [[nodiscard]] static const void *window_buffer_element_at(const void *owner, std::size_t index)
             {
                 return storage<Storage>(owner).element_at(index);
@@ -544,7 +544,8 @@ namespace hgraph
 #if HGRAPH_ENABLE_PYTHON_USER_NODES
                 ops.to_python_impl        = &enum_to_python;
                 ops.from_python_impl      = &enum_from_python;
-                ops.to_python_buffer_impl = nullptr;
+                ops.to_python_buffer_impl    = nullptr;
+                ops.to_python_span_view_impl = nullptr;
 #endif
                 return ops;
             });
@@ -994,44 +994,52 @@ array_dynamic_storage_metrics(const void *context,
 }
 
 #if HGRAPH_ENABLE_PYTHON_USER_NODES
-[[nodiscard]] nb::object array_value_to_python(const void *context,
-                                               const void *memory) {
-  if (memory == nullptr) {
-    throw std::runtime_error("array to_python requires live value memory");
+[[nodiscard]] ValueArraySpan array_value_span(const void *context,
+                                              const void *memory) {
+  const auto *state = static_cast<const ArrayIndexedContext *>(context);
+  return ValueArraySpan{
+      .data = static_cast<const std::byte *>(memory) + state->data_offset,
+      .size = array_indexed_size(context, memory),
+      .stride = state->stride,
+  };
+}
+
+// The NumPy copy for buffer-compatible elements; invalid otherwise.
+[[nodiscard]] nb::object array_value_to_python_buffer(const void *context,
+                                                      const void *memory) {
+  const auto *state = static_cast<const ArrayIndexedContext *>(context);
+  const auto &ops = state->element_binding.ops_ref();
+  if (!ops.can_to_python_buffer(state->element_binding)) {
+    return nb::object{};
   }
+  struct ArrayBufferOwner {
+    const void *memory{nullptr};
+    const ArrayIndexedContext *state{nullptr};
+  };
+  const ArrayBufferOwner owner{memory, state};
+  const auto element_at = [](const void *owner_memory,
+                             std::size_t index) -> const void * {
+    const auto *owner_state =
+        static_cast<const ArrayBufferOwner *>(owner_memory);
+    return static_cast<const std::byte *>(owner_state->memory) +
+           owner_state->state->data_offset +
+           index * owner_state->state->stride;
+  };
+  const ValueArraySpan span = array_value_span(context, memory);
+  return ops.to_python_buffer(state->element_binding,
+                              ValueArraySource{
+                                  .owner = &owner,
+                                  .size = span.size,
+                                  .element_at = element_at,
+                                  .first = span,
+                              });
+}
+
+[[nodiscard]] nb::list array_value_to_python_list(const void *context,
+                                                  const void *memory) {
   const auto *state = static_cast<const ArrayIndexedContext *>(context);
   const auto &ops = state->element_binding.ops_ref();
   const auto size = array_indexed_size(context, memory);
-  if (ops.can_to_python_buffer(state->element_binding)) {
-    struct ArrayBufferOwner {
-      const void *memory{nullptr};
-      const ArrayIndexedContext *state{nullptr};
-    };
-    const ArrayBufferOwner owner{memory, state};
-    const auto element_at = [](const void *owner_memory,
-                               std::size_t index) -> const void * {
-      const auto *owner_state =
-          static_cast<const ArrayBufferOwner *>(owner_memory);
-      return static_cast<const std::byte *>(owner_state->memory) +
-             owner_state->state->data_offset +
-             index * owner_state->state->stride;
-    };
-    return ops.to_python_buffer(
-        state->element_binding,
-        ValueArraySource{
-            .owner = &owner,
-            .size = size,
-            .element_at = element_at,
-            .first =
-                ValueArraySpan{
-                    .data = static_cast<const std::byte *>(memory) +
-                            state->data_offset,
-                    .size = size,
-                    .stride = state->stride,
-                },
-        });
-  }
-
   nb::list result;
   for (std::size_t index = 0; index < size; ++index) {
     const auto *child = static_cast<const std::byte *>(memory) +
@@ -1041,10 +1049,42 @@ array_dynamic_storage_metrics(const void *context,
   return result;
 }
 
+[[nodiscard]] nb::object array_value_to_python(const void *context,
+                                               const void *memory) {
+  if (memory == nullptr) {
+    throw std::runtime_error("array to_python requires live value memory");
+  }
+  if (nb::object buffer = array_value_to_python_buffer(context, memory);
+      buffer.is_valid()) {
+    return buffer;
+  }
+  return array_value_to_python_list(context, memory);
+}
+
+// A numeric buffer is already an ndarray; only the element-wise fallback
+// goes through numpy.asarray.
 [[nodiscard]] nb::object array_value_to_numpy(const void *context,
                                               const void *memory) {
-  nb::object value = array_value_to_python(context, memory);
-  return nb::module_::import_("numpy").attr("asarray")(std::move(value));
+  if (memory == nullptr) {
+    throw std::runtime_error("array to_python requires live value memory");
+  }
+  if (nb::object buffer = array_value_to_python_buffer(context, memory);
+      buffer.is_valid()) {
+    return buffer;
+  }
+  return nb::module_::import_("numpy").attr("asarray")(
+      array_value_to_python_list(context, memory));
+}
+
+// Read-only NumPy view over the inline elements; see ValueOps.
+[[nodiscard]] nb::object array_value_to_python_view(const void *context,
+                                                    const void *memory) {
+  if (memory == nullptr) {
+    throw std::runtime_error("array to_python requires live value memory");
+  }
+  const auto *state = static_cast<const ArrayIndexedContext *>(context);
+  return state->element_binding.ops_ref().to_python_span_view(
+      array_value_span(context, memory));
 }
 
 void array_value_from_python(const void *context, const ValueTypeRef &,
@@ -1680,6 +1720,9 @@ struct ArrayIndexedOpsEntry {
     };
     ops.resize = bounded ? &array_indexed_resize : nullptr;
     ops.dynamic_storage_metrics_impl = &array_dynamic_storage_metrics;
+#if HGRAPH_ENABLE_PYTHON_USER_NODES
+    ops.to_python_view_impl = &array_value_to_python_view;
+#endif
   }
 };
 
@@ -328,7 +328,8 @@ namespace hgraph
                        std::string &why,
                        GlobalStateView global_state,
                        Wiring *wiring,
-                       bool &requires_rejected)
+                       bool &requires_rejected,
+                       bool &context_rejected)
         {
             if (output_required.has_value() && impl.has_output != *output_required)
             {
@@ -562,12 +563,17 @@ namespace hgraph
                         return true;
                     },
                     [&](const char *message) { why = fmt::format("default type resolution failed: {}", message); });
-                if (!resolved) { return false; }
+                if (!resolved)
+                {
+                    context_rejected = true;
+                    return false;
+                }
             }
 
             if (impl.has_output && ts_pattern_resolve(impl.output, map) == nullptr)
             {
-                why = "output type could not be resolved";
+                why              = "output type could not be resolved";
+                context_rejected = true;
                 return false;
             }
 
@@ -581,11 +587,16 @@ namespace hgraph
                         why   = fmt::format("requires predicate threw: {}", message);
                         threw = true;
                     });
-                if (threw) { return false; }
+                if (threw)
+                {
+                    context_rejected = true;
+                    return false;
+                }
                 if (!accepted)
                 {
                     why               = "rejected by requires predicate";
                     requires_rejected = true;
+                    context_rejected  = true;
                     return false;
                 }
             }
@@ -605,6 +616,7 @@ namespace hgraph
     void OperatorRegistry::register_overload(OperatorImpl impl)
     {
         overloads_[impl.name].push_back(std::move(impl));
+        resolution_cache_.clear();
     }
 
     void OperatorRegistry::register_installer(std::string_view key, std::function<void()> installer)
@@ -884,6 +896,7 @@ namespace hgraph
     void OperatorRegistry::reset() noexcept
     {
         overloads_.clear();
+        resolution_cache_.clear();
         mesh_scopes_.clear();
         context_scopes_.clear();
         record_replay::reset();   // config + mode scopes (types/record_replay.h)
@@ -959,8 +972,103 @@ namespace hgraph
             }
             for (const TypePattern &child : pattern.children) { collect_size_vars(child, names); }
         }
+
+        [[nodiscard]] constexpr std::size_t combine_hash(std::size_t seed, std::size_t value) noexcept
+        {
+            return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U));
+        }
+
+        /** Hash of a call's canonical signature, or nullopt when the call
+            cannot be remembered (a packed variadic tail, or a scalar whose
+            value does not hash). */
+        [[nodiscard]] std::optional<std::size_t> resolution_signature_hash(
+            std::string_view name, std::span<const WiringArg> args, std::span<const std::size_t> size_hints,
+            const TSValueTypeMetaData *expected_output, std::optional<bool> output_required) noexcept
+        {
+            return fallback_on_exception<std::optional<std::size_t>>(std::nullopt, [&]() -> std::optional<std::size_t> {
+                std::size_t seed = std::hash<std::string_view>{}(name);
+                for (const WiringArg &arg : args)
+                {
+                    if (arg.from_variadic_tail) { return std::nullopt; }
+                    seed = combine_hash(seed, static_cast<std::size_t>(arg.kind));
+                    seed = combine_hash(seed, std::hash<std::string_view>{}(arg.name));
+                    if (arg.kind == WiringArg::Kind::TimeSeries)
+                    {
+                        seed = combine_hash(seed, std::hash<const void *>{}(arg.port.schema));
+                        continue;
+                    }
+                    seed = combine_hash(seed, std::hash<const void *>{}(arg.scalar_meta));
+                    if (arg.scalar_value.has_value()) { seed = combine_hash(seed, arg.scalar_value.hash()); }
+                }
+                for (const std::size_t hint : size_hints) { seed = combine_hash(seed, hint); }
+                seed = combine_hash(seed, std::hash<const void *>{}(expected_output));
+                return combine_hash(seed, output_required.has_value() ? 1U + *output_required : 0U);
+            });
+        }
+
+        [[nodiscard]] bool same_scalar(const Value &lhs, const Value &rhs)
+        {
+            if (lhs.has_value() != rhs.has_value()) { return false; }
+            return !lhs.has_value() || lhs.equals(rhs);
+        }
     }  // namespace
 
+    bool OperatorRegistry::ResolutionKeyEqual::operator()(const ResolutionKey &lhs, const ResolutionKey &rhs) const
+    {
+        if (lhs.hash != rhs.hash || lhs.name != rhs.name || lhs.expected_output != rhs.expected_output ||
+            lhs.output_required != rhs.output_required || lhs.size_hints != rhs.size_hints ||
+            lhs.args.size() != rhs.args.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.args.size(); ++i)
+        {
+            const ResolutionKeyArg &a = lhs.args[i];
+            const ResolutionKeyArg &b = rhs.args[i];
+            if (a.kind != b.kind || a.name != b.name || a.ts_schema != b.ts_schema || a.scalar_meta != b.scalar_meta ||
+                !same_scalar(a.scalar_value, b.scalar_value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool OperatorRegistry::ResolutionKeyEqual::operator()(const ResolutionCall &lhs, const ResolutionKey &rhs) const
+    {
+        if (lhs.hash != rhs.hash || lhs.name != rhs.name || lhs.expected_output != rhs.expected_output ||
+            lhs.output_required != rhs.output_required ||
+            !std::equal(lhs.size_hints.begin(), lhs.size_hints.end(), rhs.size_hints.begin(), rhs.size_hints.end()) ||
+            lhs.args.size() != rhs.args.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.args.size(); ++i)
+        {
+            const WiringArg        &a = lhs.args[i];
+            const ResolutionKeyArg &b = rhs.args[i];
+            if (a.kind != b.kind || a.name != b.name) { return false; }
+            if (a.kind == WiringArg::Kind::TimeSeries)
+            {
+                if (a.port.schema != b.ts_schema) { return false; }
+            }
+            else if (a.scalar_meta != b.scalar_meta || !same_scalar(a.scalar_value, b.scalar_value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    OperatorResolutionCacheStats OperatorRegistry::resolution_cache_stats() const noexcept
+    {
+        return OperatorResolutionCacheStats{
+            .entries = resolution_cache_.size(),
+            .hits    = resolution_cache_hits_,
+            .misses  = resolution_cache_misses_,
+        };
+    }
+
     ResolvedOperatorCall OperatorRegistry::resolve(
         std::string_view name,
         std::span<const WiringArg> args,
@@ -1021,6 +1129,88 @@ namespace hgraph
             throw OperatorResolutionError(std::move(message));
         }
 
+        // Caller-pinned SIZE variables (op[SIZE: Size[4]]): bind the impl's
+        // size vars positionally from the hints.
+        const auto bind_size_hints = [&](const OperatorImpl &impl, ResolutionMap &map) {
+            if (size_hints.empty()) { return; }
+            std::vector<std::string> size_names;
+            for (const ParamPattern &param : impl.params)
+            {
+                if (param.kind == ParamPattern::Kind::Input) { collect_size_vars(param.ts, size_names); }
+            }
+            if (impl.has_output) { collect_size_vars(impl.output, size_names); }
+            for (std::size_t index = 0; index < size_names.size() && index < size_hints.size(); ++index)
+            {
+                map.bind_size(size_names[index], size_hints[index]);
+            }
+        };
+
+        // Materialise the winner's kwargs: ports pass through; plain VALUES
+        // lift to const sources (Python's scalar-kwargs rule). Only the
+        // winning candidate wires nodes - losers never touch the graph.
+        const auto finish = [&](const OperatorImpl &impl, ResolutionMap map,
+                                NormalizedCall call) -> ResolvedOperatorCall {
+            std::vector<std::pair<std::string, WiringPortRef>> kwargs;
+            kwargs.reserve(call.kwargs.size());
+            for (auto &[kw_name, kw_arg] : call.kwargs)
+            {
+                if (kw_arg.kind == WiringArg::Kind::TimeSeries)
+                {
+                    kwargs.emplace_back(kw_name, kw_arg.port);
+                    continue;
+                }
+                if (wiring == nullptr)
+                {
+                    throw OperatorResolutionError(fmt::format(
+                        "keyword argument '{}' of '{}' is a plain value and no wiring context is "
+                        "available to lift it to a const source",
+                        kw_name, name));
+                }
+                WiringArg positional = kw_arg;
+                positional.name.clear();   // const takes the value positionally
+                ResolvedOperatorCall lifted =
+                    resolve("const", std::span<const WiringArg>{&positional, 1}, true, nullptr, {}, global_state);
+                OperatorWireResult source = lifted.impl->wire(*wiring, lifted.map, lifted.args, lifted.kwargs);
+                kwargs.emplace_back(kw_name, source.output.erased());
+            }
+            return ResolvedOperatorCall{&impl, std::move(map), std::move(call.args), std::move(kwargs)};
+        };
+
+        // A remembered selection is re-matched on its own: the map, defaults
+        // and predicates are recomputed, only the candidate walk is skipped.
+        std::optional<std::size_t> signature;
+        if (!diagnostics_enabled && initial_resolution == nullptr)
+        {
+            signature = resolution_signature_hash(name, args, size_hints, expected_output, output_required);
+        }
+        const ResolutionCall call_signature{name, args, size_hints, expected_output, output_required,
+                                            signature.value_or(0)};
+        if (signature.has_value())
+        {
+            if (auto cached = resolution_cache_.find(call_signature); cached != resolution_cache_.end())
+            {
+                const OperatorImpl &impl = it->second[cached->second];
+                NormalizedCall      call;
+                ResolutionMap       map;
+                std::string         why;
+                int                 rank_adjustment   = 0;
+                bool                requires_rejected = false;
+                bool                context_rejected  = false;
+                if (normalize_call(impl, args, call, why))
+                {
+                    bind_size_hints(impl, map);
+                    if (try_match(impl, call.args, call.kwargs, output_required, expected_output, map,
+                                  rank_adjustment, why, global_state, wiring, requires_rejected, context_rejected))
+                    {
+                        ++resolution_cache_hits_;
+                        return finish(impl, std::move(map), std::move(call));
+                    }
+                }
+                resolution_cache_.erase(cached);
+            }
+            ++resolution_cache_misses_;
+        }
+
         struct Survivor
         {
             const OperatorImpl *impl;
@@ -1032,6 +1222,7 @@ namespace hgraph
         std::vector<Survivor>    survivors;
         std::vector<std::string> rejected;
         bool                     any_requires_rejected = false;
+        bool                     any_context_rejected  = false;
         for (const OperatorImpl &impl : it->second)
         {
             NormalizedCall call;
@@ -1054,26 +1245,12 @@ namespace hgraph
             ResolutionMap map = initial_resolution != nullptr
                                     ? *initial_resolution
                                     : ResolutionMap{};
-            // Caller-pinned SIZE variables (op[SIZE: Size[4]]): bind the
-            // impl's size vars positionally from the hints.
-            if (!size_hints.empty())
-            {
-                std::vector<std::string> size_names;
-                for (const ParamPattern &param : impl.params)
-                {
-                    if (param.kind == ParamPattern::Kind::Input) { collect_size_vars(param.ts, size_names); }
-                }
-                if (impl.has_output) { collect_size_vars(impl.output, size_names); }
-                for (std::size_t index = 0; index < size_names.size() && index < size_hints.size(); ++index)
-                {
-                    map.bind_size(size_names[index], size_hints[index]);
-                }
-            }
+            bind_size_hints(impl, map);
             // Each default an overload falls back on makes it a little less
             // specific than one whose parameters were all supplied.
             int rank_adjustment = call.defaults_used;
             if (try_match(impl, call.args, call.kwargs, output_required, expected_output, map, rank_adjustment, why,
-                          global_state, wiring, any_requires_rejected))
+                          global_state, wiring, any_requires_rejected, any_context_rejected))
             {
                 survivors.push_back({&impl, std::move(map), std::move(call), impl.rank + rank_adjustment});
             }
@@ -1142,9 +1319,6 @@ namespace hgraph
             throw OperatorResolutionError(std::move(message));
         }
 
-        // Materialise the winner's kwargs: ports pass through; plain VALUES
-        // lift to const sources (Python's scalar-kwargs rule). Only the
-        // winning candidate wires nodes - losers never touch the graph.
         Survivor &winner = survivors[0];
         if (diagnostics_enabled)
         {
@@ -1155,31 +1329,32 @@ namespace hgraph
             };
             emit_diagnostic();
         }
-        std::vector<std::pair<std::string, WiringPortRef>> kwargs;
-        kwargs.reserve(winner.call.kwargs.size());
-        for (auto &[kw_name, kw_arg] : winner.call.kwargs)
+        if (signature.has_value() && !any_context_rejected)
         {
-            if (kw_arg.kind == WiringArg::Kind::TimeSeries)
-            {
-                kwargs.emplace_back(kw_name, kw_arg.port);
-                continue;
-            }
-            if (wiring == nullptr)
+            if (resolution_cache_.size() >= max_resolution_cache_entries) { resolution_cache_.clear(); }
+            ResolutionKey key{
+                .name            = std::string{name},
+                .size_hints      = {size_hints.begin(), size_hints.end()},
+                .expected_output = expected_output,
+                .output_required = output_required,
+                .hash            = *signature,
+            };
+            key.args.reserve(args.size());
+            for (const WiringArg &arg : args)
             {
-                throw OperatorResolutionError(fmt::format(
-                    "keyword argument '{}' of '{}' is a plain value and no wiring context is "
-                    "available to lift it to a const source",
-                    kw_name, name));
+                ResolutionKeyArg &entry = key.args.emplace_back();
+                entry.kind = arg.kind;
+                entry.name = arg.name;
+                if (arg.kind == WiringArg::Kind::TimeSeries) { entry.ts_schema = arg.port.schema; }
+                else
+                {
+                    entry.scalar_meta  = arg.scalar_meta;
+                    entry.scalar_value = arg.scalar_value;
+                }
             }
-            WiringArg positional = kw_arg;
-            positional.name.clear();   // const takes the value positionally
-            ResolvedOperatorCall lifted =
-                resolve("const", std::span<const WiringArg>{&positional, 1}, true, nullptr, {}, global_state);
-            OperatorWireResult source = lifted.impl->wire(*wiring, lifted.map, lifted.args, lifted.kwargs);
-            kwargs.emplace_back(kw_name, source.output.erased());
+            resolution_cache_.insert_or_assign(std::move(key),
+                                               static_cast<std::size_t>(winner.impl - it->second.data()));
         }
-
-        return ResolvedOperatorCall{winner.impl, std::move(winner.map), std::move(winner.call.args),
-                                    std::move(kwargs)};
+        return finish(*winner.impl, std::move(winner.map), std::move(winner.call));
     }
 }  // namespace hgraph
@@ -183,6 +183,7 @@ namespace hgraph::ts_data_detail
         ValueView sentinel_window_element(const void *, const void *, std::size_t) noexcept { return {}; }
         DateTime sentinel_window_time(const void *, const void *, std::size_t) noexcept { return MIN_DT; }
         bool     sentinel_window_full(const void *, const void *) noexcept { return false; }
+        TSWSegments sentinel_window_segments(const void *, const void *) noexcept { return {}; }
 
         void install_sentinel_slot_surface(TSSDataOps &table) noexcept
         {
@@ -277,6 +278,7 @@ namespace hgraph::ts_data_detail
             t.time_element_at_impl      = &sentinel_window_element;
             t.capacity_impl             = &sentinel_zero;
             t.full_impl                 = &sentinel_window_full;
+            t.segments_impl             = &sentinel_window_segments;
             return t;
         }();
         return table;
@@ -484,6 +486,8 @@ namespace hgraph::ts_data_detail
     }
 
     void missing_window_clear(const void *, void *, DateTime) { missing_ts_data_op("window clear"); }
+
+    TSWSegments missing_window_segments(const void *, const void *) { missing_ts_data_op("window segments"); }
 }  // namespace hgraph::ts_data_detail
 
 namespace hgraph
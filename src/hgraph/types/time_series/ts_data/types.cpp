@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <mutex>
 #include <ranges>
 #include <stdexcept>
 #include <utility>
@@ -15,6 +16,53 @@
 
 namespace hgraph
 {
+    namespace
+    {
+        thread_local std::mutex *active_notification_mutex = nullptr;
+
+        /** Holds the installed notification mutex for the outermost shared
+            TSData operation on this thread; a no-op without a scope. */
+        class SharedNotificationGuard
+        {
+          public:
+            SharedNotificationGuard() noexcept
+                : mutex_(std::exchange(active_notification_mutex, nullptr))
+            {
+                if (mutex_ != nullptr) { mutex_->lock(); }
+            }
+
+            ~SharedNotificationGuard() noexcept
+            {
+                if (mutex_ != nullptr)
+                {
+                    mutex_->unlock();
+                    active_notification_mutex = mutex_;
+                }
+            }
+
+            SharedNotificationGuard(const SharedNotificationGuard &)            = delete;
+            SharedNotificationGuard &operator=(const SharedNotificationGuard &) = delete;
+
+          private:
+            std::mutex *mutex_;
+        };
+    }  // namespace
+
+    TSNotificationLockScope::TSNotificationLockScope(std::mutex &mutex) noexcept
+        : previous_(std::exchange(active_notification_mutex, &mutex))
+    {
+    }
+
+    TSNotificationLockScope::~TSNotificationLockScope() noexcept
+    {
+        active_notification_mutex = previous_;
+    }
+
+    bool TSNotificationLockScope::active() noexcept
+    {
+        return active_notification_mutex != nullptr;
+    }
+
     TSDataObserverSet::TSDataObserverSet(const TSDataObserverSet &) noexcept
     {
     }
@@ -82,6 +130,7 @@ namespace hgraph
     void TSDataObserverSet::subscribe(Notifiable *observer)
     {
         if (observer == nullptr) { return; }
+        SharedNotificationGuard shared_notification;
 
         if (observers_.empty())
         {
@@ -114,6 +163,7 @@ namespace hgraph
     void TSDataObserverSet::unsubscribe(Notifiable *observer)
     {
         if (observer == nullptr) { return; }
+        SharedNotificationGuard shared_notification;
 
         if (auto *entry = single(); entry != nullptr)
         {
@@ -148,6 +198,7 @@ namespace hgraph
     void TSDataObserverSet::replace(Notifiable *observer, Notifiable *replacement) noexcept
     {
         if (observer == nullptr || replacement == nullptr || observer == replacement) { return; }
+        SharedNotificationGuard shared_notification;
 
         if (auto *entry = single(); entry != nullptr)
         {
@@ -195,6 +246,17 @@ namespace hgraph
         }
     }
 
+    void TSDataObserverSet::notify_locked(DateTime modified_time) const
+    {
+        SharedNotificationGuard shared_notification;
+        if (auto *entry = single(); entry != nullptr)
+        {
+            entry->notify(modified_time);
+            return;
+        }
+        notify_many(modified_time);
+    }
+
     void TSDataObserverSet::invalidate(const TSDataTracking *source) noexcept
     {
         ObserverStorage detached = std::exchange(observers_, ObserverStorage{});
@@ -421,6 +483,7 @@ namespace hgraph
 
     void TSParentLink::notify_child_modified(DateTime mutation_time) const
     {
+        SharedNotificationGuard shared_notification;
         if (!has_ts_data_parent())
         {
             if (has_node_endpoint_parent())
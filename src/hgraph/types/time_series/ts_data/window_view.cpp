@@ -295,6 +295,19 @@ namespace hgraph
         return values().end();
     }
 
+    TSWSegments TSWDataView::segments() const
+    {
+        const auto &ops = window_ops();
+        return ops.segments_impl(ops.context, storage_.data());
+    }
+
+    std::array<std::span<const DateTime>, 2> TSWDataView::time_spans() const
+    {
+        const TSWSegments runs = segments();
+        return {std::span<const DateTime>{runs.times[0], runs.sizes[0]},
+                std::span<const DateTime>{runs.times[1], runs.sizes[1]}};
+    }
+
     TSWDataMutationView TSWDataView::begin_mutation(DateTime evaluation_time) const
     {
         return TSWDataMutationView{storage_, evaluation_time, TrustedStorageTag{}};
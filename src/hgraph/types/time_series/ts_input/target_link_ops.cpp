@@ -1048,6 +1048,12 @@ namespace hgraph::detail
             return target_link_window_view(context, memory).time_value_at(index);
         }
 
+        [[nodiscard]] TSWSegments target_link_window_segments(const void *context, const void *memory)
+        {
+            auto target = target_link_target_view(context, memory);
+            return target.as_window().segments();
+        }
+
         [[nodiscard]] DateTime target_link_window_cleared_time(const void *context,
                                                                 const void *memory) noexcept
         {
@@ -1530,6 +1536,7 @@ namespace hgraph::detail
                 context->ops.capacity_impl = &target_link_window_capacity;
                 context->ops.full_impl = &target_link_window_full;
                 context->ops.push_impl = &target_link_window_push;
+                context->ops.segments_impl = &target_link_window_segments;
                 context->ops.cleared_time_impl = &target_link_window_cleared_time;
                 context->ops.evicted_time_impl = &target_link_window_evicted_time;
                 context->ops.evicted_element_impl = &target_link_window_evicted_element;
@@ -1553,6 +1560,7 @@ namespace hgraph::detail
             context->ops.capacity_impl = &target_link_window_capacity;
             context->ops.full_impl = &target_link_window_full;
             context->ops.push_impl = &target_link_window_push;
+            context->ops.segments_impl = &target_link_window_segments;
             context->ops.cleared_time_impl = &target_link_window_cleared_time;
             context->ops.evicted_time_impl = &target_link_window_evicted_time;
             context->ops.evicted_element_impl = &target_link_window_evicted_element;
@@ -0,0 +1,130 @@
+#include <hgraph/types/utils/storage_arena.h>
+
+#include "../../runtime/evaluation_thread_pool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+namespace hgraph
+{
+    namespace
+    {
+        [[nodiscard]] constexpr std::size_t round_up(std::size_t value, std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /** Bytes a chunk-served block occupies: its size class. */
+        [[nodiscard]] constexpr std::size_t slab_size(MemoryUtils::StorageLayout layout) noexcept
+        {
+            return round_up(std::max<std::size_t>(layout.size, 1),
+                            std::max(StorageArena::granule, layout.alignment));
+        }
+    }  // namespace
+
+    StorageArena::StorageArena(std::size_t chunk_bytes)
+        : chunk_bytes_(round_up(std::max(chunk_bytes, min_chunk_bytes), granule))
+    {
+        ops_ = MemoryUtils::AllocatorOps{
+            .allocate   = &StorageArena::allocate_hook,
+            .deallocate = &StorageArena::deallocate_hook,
+            .context    = this,
+        };
+        free_lists_.resize(large_block_bytes() / granule, nullptr);
+    }
+
+    StorageArena::~StorageArena()
+    {
+        for (void *chunk : chunks_) { ::operator delete(chunk, std::align_val_t{max_slab_alignment}); }
+    }
+
+    DynamicStorageMetrics StorageArena::metrics() const noexcept
+    {
+        return DynamicStorageMetrics{
+            .live_bytes     = live_bytes_,
+            .reserved_bytes = chunks_.size() * chunk_bytes_ + large_bytes_,
+        };
+    }
+
+    void *StorageArena::allocate_hook(MemoryUtils::StorageLayout layout, void *context)
+    {
+        return static_cast<StorageArena *>(context)->allocate(layout);
+    }
+
+    void StorageArena::deallocate_hook(void *memory, MemoryUtils::StorageLayout layout, void *context) noexcept
+    {
+        static_cast<StorageArena *>(context)->deallocate(memory, layout);
+    }
+
+    bool StorageArena::served_from_chunks(MemoryUtils::StorageLayout layout) const noexcept
+    {
+        return layout.alignment <= max_slab_alignment && slab_size(layout) <= large_block_bytes();
+    }
+
+    void *StorageArena::allocate(MemoryUtils::StorageLayout layout)
+    {
+        assert(!runtime_detail::EvaluationThreadPool::in_job() && "StorageArena used from an evaluation pool item");
+        if (!layout.valid()) { throw std::logic_error("StorageArena requires a valid layout"); }
+        if (!served_from_chunks(layout))
+        {
+            void *memory = MemoryUtils::allocator().allocate_storage(layout);
+            large_bytes_ += layout.size;
+            live_bytes_ += layout.size;
+            return memory;
+        }
+
+        const std::size_t size = slab_size(layout);
+        FreeBlock *&head = free_lists_[size / granule - 1];
+        void *memory = nullptr;
+        if (head != nullptr && reinterpret_cast<std::uintptr_t>(head) % layout.alignment == 0)
+        {
+            memory = head;
+            head   = head->next;
+        }
+        else
+        {
+            memory = bump(size, std::max(granule, layout.alignment));
+        }
+        live_bytes_ += size;
+        return memory;
+    }
+
+    void StorageArena::deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept
+    {
+        assert(!runtime_detail::EvaluationThreadPool::in_job() && "StorageArena used from an evaluation pool item");
+        if (!served_from_chunks(layout))
+        {
+            MemoryUtils::allocator().deallocate_storage(memory, layout);
+            large_bytes_ -= layout.size;
+            live_bytes_ -= layout.size;
+            return;
+        }
+
+        const std::size_t size = slab_size(layout);
+        FreeBlock *&head = free_lists_[size / granule - 1];
+        head = ::new (memory) FreeBlock{head};
+        live_bytes_ -= size;
+    }
+
+    void *StorageArena::bump(std::size_t size, std::size_t alignment)
+    {
+        auto *aligned = reinterpret_cast<std::byte *>(
+            round_up(reinterpret_cast<std::uintptr_t>(cursor_), alignment));
+        if (cursor_ == nullptr || aligned + size > limit_)
+        {
+            // The tail of the exhausted chunk is abandoned; blocks are at most a
+            // quarter of a chunk, so at most that fraction of a chunk is lost.
+            chunks_.reserve(chunks_.size() + 1);
+            void *chunk = ::operator new(chunk_bytes_, std::align_val_t{max_slab_alignment});
+            chunks_.push_back(chunk);
+            cursor_ = static_cast<std::byte *>(chunk);
+            limit_  = cursor_ + chunk_bytes_;
+            aligned = cursor_;
+        }
+        cursor_ = aligned + size;
+        return aligned;
+    }
+}  // namespace hgraph
@@ -0,0 +1,388 @@
+#ifndef HGRAPH_TYPES_VALUE_IMPL_JSON_SCAN_H
+#define HGRAPH_TYPES_VALUE_IMPL_JSON_SCAN_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HGRAPH_JSON_SCAN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HGRAPH_JSON_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * Structural scanning for the JSON reader: the stage-1 half of a
+ * simdjson-style parser, kept in-tree.
+ *
+ * The schema-directed reader stays a recursive descent; these routines only
+ * take over the byte-at-a-time loops inside it. Whitespace runs and string
+ * bodies are scanned sixteen bytes at a time, and a value the schema does
+ * not want (an unknown bundle field) is skipped by classifying 64-byte
+ * blocks into quote, backslash, bracket and scalar bitmasks, resolving
+ * escapes and string interiors with bit arithmetic, counting brackets from
+ * the surviving bits and checking each run of scalar bytes as a token.
+ *
+ * SSE2 is used on x86-64, NEON on AArch64, and eight-byte SWAR elsewhere.
+ */
+namespace hgraph::json_detail::scan
+{
+    inline constexpr std::size_t npos = std::string_view::npos;
+
+    [[nodiscard]] constexpr bool is_whitespace(char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    /** A byte the reader takes into a number token. */
+    [[nodiscard]] constexpr bool is_number_char(char c) noexcept
+    {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+    }
+
+    /** Whether ``token`` is a scalar the reader's skip accepts: a literal, or
+        a non-empty run of number bytes. */
+    [[nodiscard]] constexpr bool is_scalar_token(std::string_view token) noexcept
+    {
+        if (token == "true" || token == "false" || token == "null") { return true; }
+        if (token.empty()) { return false; }
+        for (const char c : token)
+        {
+            if (!is_number_char(c)) { return false; }
+        }
+        return true;
+    }
+
+    namespace detail
+    {
+        inline constexpr std::size_t lane = 16;
+
+#if HGRAPH_JSON_SCAN_SSE2
+        [[nodiscard]] inline __m128i load(const char *bytes) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+        }
+
+        [[nodiscard]] inline std::uint32_t bits(__m128i matches) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+        }
+
+        [[nodiscard]] inline std::uint32_t equal(__m128i bytes, char c) noexcept
+        {
+            return bits(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(c)));
+        }
+#elif HGRAPH_JSON_SCAN_NEON
+        [[nodiscard]] inline uint8x16_t load(const char *bytes) noexcept
+        {
+            return vld1q_u8(reinterpret_cast<const std::uint8_t *>(bytes));
+        }
+
+        /** One bit per byte of a 0x00/0xFF match vector. */
+        [[nodiscard]] inline std::uint32_t bits(uint8x16_t matches) noexcept
+        {
+            static constexpr std::uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                                         1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t weighted = vandq_u8(matches, vld1q_u8(weights));
+            const std::uint32_t low   = vaddv_u8(vget_low_u8(weighted));
+            const std::uint32_t high  = vaddv_u8(vget_high_u8(weighted));
+            return low | (high << 8);
+        }
+
+        [[nodiscard]] inline std::uint32_t equal(uint8x16_t bytes, char c) noexcept
+        {
+            return bits(vceqq_u8(bytes, vdupq_n_u8(static_cast<std::uint8_t>(c))));
+        }
+#endif
+
+        /** High bit set in each byte of ``word`` that equals ``c``. */
+        [[nodiscard]] inline std::uint64_t swar_equal(std::uint64_t word, char c) noexcept
+        {
+            constexpr std::uint64_t ones = 0x0101010101010101ULL;
+            constexpr std::uint64_t high = 0x8080808080808080ULL;
+            const std::uint64_t x = word ^ (ones * static_cast<std::uint8_t>(c));
+            // Exact per byte: no borrow can cross from one byte into the next.
+            return ~(((x & ~high) + ~high) | x) & high;
+        }
+
+        /** Gather the high bit of each byte of ``word`` into the low eight bits. */
+        [[nodiscard]] inline std::uint32_t swar_bits(std::uint64_t word) noexcept
+        {
+            return static_cast<std::uint32_t>(((word >> 7) * 0x0102040810204080ULL) >> 56);
+        }
+
+        [[nodiscard]] inline std::uint64_t load_word(const char *bytes) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            if constexpr (std::endian::native == std::endian::big) { word = std::byteswap(word); }
+            return word;
+        }
+
+        /** Bit ``i`` set where ``bytes[i]`` is ``a`` or ``b``, for sixteen bytes. */
+        [[nodiscard]] inline std::uint32_t either(const char *bytes, char a, char b) noexcept
+        {
+#if HGRAPH_JSON_SCAN_SSE2 || HGRAPH_JSON_SCAN_NEON
+            const auto chunk = load(bytes);
+            return equal(chunk, a) | equal(chunk, b);
+#else
+            std::uint32_t result = 0;
+            for (std::size_t half = 0; half < 2; ++half)
+            {
+                const std::uint64_t word = load_word(bytes + half * 8);
+                result |= swar_bits(swar_equal(word, a) | swar_equal(word, b)) << (half * 8);
+            }
+            return result;
+#endif
+        }
+
+        /** Bit ``i`` set where ``bytes[i]`` is not JSON whitespace, for sixteen bytes. */
+        [[nodiscard]] inline std::uint32_t non_whitespace(const char *bytes) noexcept
+        {
+#if HGRAPH_JSON_SCAN_SSE2 || HGRAPH_JSON_SCAN_NEON
+            const auto chunk = load(bytes);
+            return ~(equal(chunk, ' ') | equal(chunk, '\t') | equal(chunk, '\n') | equal(chunk, '\r')) &
+                   0xFFFFu;
+#else
+            std::uint32_t result = 0;
+            for (std::size_t half = 0; half < 2; ++half)
+            {
+                const std::uint64_t word = load_word(bytes + half * 8);
+                const std::uint64_t ws   = swar_equal(word, ' ') | swar_equal(word, '\t') |
+                                         swar_equal(word, '\n') | swar_equal(word, '\r');
+                result |= (~swar_bits(ws) & 0xFFu) << (half * 8);
+            }
+            return result;
+#endif
+        }
+
+        /** Classification of one 64-byte block, one bit per byte. */
+        struct BlockMasks
+        {
+            std::uint64_t quote{0};
+            std::uint64_t backslash{0};
+            /** ``{`` or ``[``. */
+            std::uint64_t open{0};
+            /** ``}`` or ``]``. */
+            std::uint64_t close{0};
+            /** ``{`` or ``}``; tells the two bracket kinds apart. */
+            std::uint64_t brace{0};
+            /** Neither whitespace, a quote, a bracket, ``,`` nor ``:`` - outside
+                a string, the bytes of a scalar token. */
+            std::uint64_t scalar{0};
+        };
+
+        [[nodiscard]] inline BlockMasks classify(const char *block) noexcept
+        {
+            BlockMasks masks;
+            for (std::size_t offset = 0; offset < 64; offset += lane)
+            {
+                const char   *bytes = block + offset;
+                std::uint64_t quote, backslash, open_brace, open_bracket, close_brace, close_bracket,
+                    separator;
+#if HGRAPH_JSON_SCAN_SSE2 || HGRAPH_JSON_SCAN_NEON
+                const auto chunk = load(bytes);
+                quote            = equal(chunk, '"');
+                backslash        = equal(chunk, '\\');
+                open_brace       = equal(chunk, '{');
+                open_bracket     = equal(chunk, '[');
+                close_brace      = equal(chunk, '}');
+                close_bracket    = equal(chunk, ']');
+                separator = equal(chunk, ',') | equal(chunk, ':') | (~non_whitespace(bytes) & 0xFFFFu);
+#else
+                quote = backslash = open_brace = open_bracket = close_brace = close_bracket = separator = 0;
+                for (std::size_t half = 0; half < 2; ++half)
+                {
+                    const std::uint64_t word  = load_word(bytes + half * 8);
+                    const unsigned      shift = static_cast<unsigned>(half * 8);
+                    quote |= std::uint64_t{swar_bits(swar_equal(word, '"'))} << shift;
+                    backslash |= std::uint64_t{swar_bits(swar_equal(word, '\\'))} << shift;
+                    open_brace |= std::uint64_t{swar_bits(swar_equal(word, '{'))} << shift;
+                    open_bracket |= std::uint64_t{swar_bits(swar_equal(word, '['))} << shift;
+                    close_brace |= std::uint64_t{swar_bits(swar_equal(word, '}'))} << shift;
+                    close_bracket |= std::uint64_t{swar_bits(swar_equal(word, ']'))} << shift;
+                    separator |= std::uint64_t{swar_bits(swar_equal(word, ',') | swar_equal(word, ':') |
+                                                         swar_equal(word, ' ') | swar_equal(word, '\t') |
+                                                         swar_equal(word, '\n') | swar_equal(word, '\r'))}
+                                 << shift;
+                }
+#endif
+                masks.quote |= quote << offset;
+                masks.backslash |= backslash << offset;
+                masks.open |= (open_brace | open_bracket) << offset;
+                masks.close |= (close_brace | close_bracket) << offset;
+                masks.brace |= (open_brace | close_brace) << offset;
+                masks.scalar |= (~(quote | open_brace | open_bracket | close_brace | close_bracket |
+                                   separator) &
+                                 0xFFFFu)
+                                << offset;
+            }
+            return masks;
+        }
+
+        /** Bit ``i`` is the xor of bits ``0..i``: turns quote positions into
+            an in-string mask (opening quote and body set, closing quote clear). */
+        [[nodiscard]] constexpr std::uint64_t prefix_xor(std::uint64_t bits) noexcept
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+
+        /** Check the scalar tokens of the block at ``base`` whose bytes are set
+            in ``scalar``. A token still running at the block's end is carried
+            in ``token_start`` (``npos`` when none); false on a bad token. */
+        [[nodiscard]] inline bool check_scalars(std::string_view text, std::size_t base, std::uint64_t scalar,
+                                                std::size_t &token_start) noexcept
+        {
+            if (token_start != npos && (scalar & 1) == 0)
+            {
+                if (!is_scalar_token(text.substr(token_start, base - token_start))) { return false; }
+                token_start = npos;
+            }
+            while (scalar != 0)
+            {
+                const unsigned first = static_cast<unsigned>(std::countr_zero(scalar));
+                const unsigned stop  = first + static_cast<unsigned>(std::countr_one(scalar >> first));
+                if (token_start == npos) { token_start = base + first; }
+                if (stop == 64) { return true; }
+                if (!is_scalar_token(text.substr(token_start, base + stop - token_start))) { return false; }
+                token_start = npos;
+                scalar &= ~((std::uint64_t{1} << stop) - 1);
+            }
+            return true;
+        }
+    }  // namespace detail
+
+    /** First position at or after ``pos`` that is not JSON whitespace, or
+        ``text.size()``. */
+    [[nodiscard]] inline std::size_t skip_whitespace(std::string_view text, std::size_t pos) noexcept
+    {
+        // Most positions hold no whitespace, or a single separating space.
+        if (pos >= text.size() || !is_whitespace(text[pos])) { return pos; }
+        if (++pos >= text.size() || !is_whitespace(text[pos])) { return pos; }
+        for (; pos + detail::lane <= text.size(); pos += detail::lane)
+        {
+            if (const std::uint32_t found = detail::non_whitespace(text.data() + pos); found != 0)
+            {
+                return pos + static_cast<std::size_t>(std::countr_zero(found));
+            }
+        }
+        while (pos < text.size() && is_whitespace(text[pos])) { ++pos; }
+        return pos;
+    }
+
+    /** First ``"`` or ``\`` at or after ``pos``, or ``npos``. */
+    [[nodiscard]] inline std::size_t find_quote_or_backslash(std::string_view text, std::size_t pos) noexcept
+    {
+        for (; pos + detail::lane <= text.size(); pos += detail::lane)
+        {
+            if (const std::uint32_t found = detail::either(text.data() + pos, '"', '\\'); found != 0)
+            {
+                return pos + static_cast<std::size_t>(std::countr_zero(found));
+            }
+        }
+        for (; pos < text.size(); ++pos)
+        {
+            if (text[pos] == '"' || text[pos] == '\\') { return pos; }
+        }
+        return npos;
+    }
+
+    /** Returned by ``skip_container`` for nesting deeper than it tracks; the
+        caller falls back to a recursive skip. */
+    inline constexpr std::size_t too_deep = npos - 1;
+
+    /** Returned by ``skip_container`` for a malformed scalar token. */
+    inline constexpr std::size_t bad_scalar = npos - 2;
+
+    /**
+     * Position just past the container that opens at ``text[pos]`` (``{`` or
+     * ``[``), or ``npos`` when it is unterminated or its brackets do not
+     * pair. Strings must terminate, every bracket outside a string must
+     * close with its own kind, and every scalar token must pass
+     * ``is_scalar_token``; the placement of ``,`` and ``:`` is not checked.
+     */
+    [[nodiscard]] inline std::size_t skip_container(std::string_view text, std::size_t pos) noexcept
+    {
+        static constexpr std::size_t max_depth = 1024;
+        // One bit per open container: set for an object, clear for an array.
+        std::array<std::uint64_t, max_depth / 64> kinds{};
+        std::size_t depth = 0;
+
+        std::uint64_t escape_carry = 0;  // bit 0: the next block opens escaped
+        std::uint64_t string_carry = 0;  // all ones: the next block opens inside a string
+        std::size_t   token_start  = npos;  // a scalar token running into the next block
+        char          padded[64];
+
+        for (std::size_t base = pos; base < text.size(); base += 64)
+        {
+            const std::size_t available = text.size() - base;
+            const char       *block     = text.data() + base;
+            if (available < 64)
+            {
+                std::memset(padded, ' ', sizeof(padded));
+                std::memcpy(padded, block, available);
+                block = padded;
+            }
+            const detail::BlockMasks masks = detail::classify(block);
+
+            // A character is escaped when an odd run of backslashes precedes
+            // it. Backslashes are rare, so they are resolved one by one.
+            std::uint64_t escaped   = escape_carry;
+            std::uint64_t backslash = masks.backslash;
+            escape_carry            = 0;
+            while (backslash != 0)
+            {
+                const std::uint64_t bit = backslash & (~backslash + 1);
+                backslash ^= bit;
+                if ((escaped & bit) != 0) { continue; }
+                if (bit == (std::uint64_t{1} << 63)) { escape_carry = 1; }
+                else { escaped |= bit << 1; }
+            }
+
+            const std::uint64_t in_string = detail::prefix_xor(masks.quote & ~escaped) ^ string_carry;
+            string_carry = static_cast<std::uint64_t>(static_cast<std::int64_t>(in_string) >> 63);
+
+            const std::uint64_t scalar = masks.scalar & ~in_string;
+            std::uint64_t       brackets = (masks.open | masks.close) & ~in_string;
+            while (brackets != 0)
+            {
+                const unsigned      index = static_cast<unsigned>(std::countr_zero(brackets));
+                const std::uint64_t bit   = std::uint64_t{1} << index;
+                brackets ^= bit;
+                const std::uint64_t object = (masks.brace & bit) != 0 ? 1 : 0;
+                if ((masks.open & bit) != 0)
+                {
+                    if (depth == max_depth) { return too_deep; }
+                    std::uint64_t &word = kinds[depth / 64];
+                    word = (word & ~(std::uint64_t{1} << (depth % 64))) | (object << (depth % 64));
+                    ++depth;
+                    continue;
+                }
+                if (depth == 0) { return npos; }
+                --depth;
+                if (((kinds[depth / 64] >> (depth % 64)) & 1) != object) { return npos; }
+                if (depth == 0)
+                {
+                    // Only the tokens before the closing bracket belong to it.
+                    return detail::check_scalars(text, base, scalar & (bit - 1), token_start) ? base + index + 1
+                                                                                               : bad_scalar;
+                }
+            }
+            if (!detail::check_scalars(text, base, scalar, token_start)) { return bad_scalar; }
+        }
+        return npos;
+    }
+}  // namespace hgraph::json_detail::scan
+
+#endif  // HGRAPH_TYPES_VALUE_IMPL_JSON_SCAN_H
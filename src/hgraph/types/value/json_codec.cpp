@@ -1,5 +1,7 @@
 #include <hgraph/types/value/json_codec.h>
 
+#include "impl/json_scan.h"
+
 #include <hgraph/types/metadata/value_plan_factory.h>
 #include <hgraph/types/metadata/type_realization.h>
 #include <hgraph/types/primitive_types.h>
@@ -155,7 +157,8 @@ namespace hgraph
         // ---------------------------------------------------------------
         // Reader — a minimal recursive-descent tokenizer. Parsing is
         // meta-directed: at every position the converter knows what shape it
-        // expects, so no DOM is built.
+        // expects, so no DOM is built. Whitespace, string bodies and skipped
+        // containers go through the vectorised scans in impl/json_scan.h.
         // ---------------------------------------------------------------
 
         struct Reader
@@ -168,15 +171,7 @@ namespace hgraph
                 throw std::invalid_argument(fmt::format("from_json: {} at offset {}", message, pos));
             }
 
-            void skip_ws() noexcept
-            {
-                while (pos < text.size())
-                {
-                    const char c = text[pos];
-                    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') { break; }
-                    ++pos;
-                }
-            }
+            void skip_ws() noexcept { pos = scan::skip_whitespace(text, pos); }
 
             [[nodiscard]] char peek()
             {
@@ -216,16 +211,43 @@ namespace hgraph
             {
                 expect('"');
                 std::string result;
+                append_string_body(result);
+                return result;
+            }
+
+            /** Read a string without copying it when it holds no escapes:
+                the view then points into ``text``. An escaped string is
+                decoded into ``scratch`` and the view points there. */
+            [[nodiscard]] std::string_view parse_string_view(std::string &scratch)
+            {
+                expect('"');
+                const std::size_t start = pos;
+                const std::size_t stop  = scan::find_quote_or_backslash(text, pos);
+                if (stop != scan::npos && text[stop] == '"')
+                {
+                    pos = stop + 1;
+                    return text.substr(start, stop - start);
+                }
+                scratch.clear();
+                append_string_body(scratch);
+                return scratch;
+            }
+
+            /** Decode from ``pos`` (just past an opening quote) through the
+                closing quote, appending whole unescaped runs at a time. */
+            void append_string_body(std::string &result)
+            {
                 while (true)
                 {
-                    if (pos >= text.size()) { fail("unterminated string"); }
-                    const char c = text[pos++];
-                    if (c == '"') { return result; }
-                    if (c != '\\')
+                    const std::size_t stop = scan::find_quote_or_backslash(text, pos);
+                    if (stop == scan::npos)
                     {
-                        result.push_back(c);
-                        continue;
+                        pos = text.size();
+                        fail("unterminated string");
                     }
+                    result.append(text.substr(pos, stop - pos));
+                    pos = stop + 1;
+                    if (text[stop] == '"') { return; }
                     if (pos >= text.size()) { fail("unterminated escape"); }
                     const char e = text[pos++];
                     switch (e)
@@ -276,48 +298,36 @@ namespace hgraph
                 const std::size_t start = pos;
                 while (pos < text.size())
                 {
-                    const char c = text[pos];
-                    if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
-                    {
-                        ++pos;
-                    }
+                    if (scan::is_number_char(text[pos])) { ++pos; }
                     else { break; }
                 }
                 if (pos == start) { fail("expected a number"); }
                 return text.substr(start, pos - start);
             }
 
-            /** Skip one complete JSON value (for unknown bundle fields). */
+            /** Skip one complete JSON value (for unknown bundle fields).
+                Containers are skipped by the structural scan, which checks
+                that strings terminate, brackets pair and scalar tokens are
+                literals or numbers, but not where commas and colons fall. */
             void skip_value()
             {
                 const char c = peek();
                 switch (c)
                 {
-                    case '{': {
-                        ++pos;
-                        if (consume_if('}')) { return; }
-                        while (true)
-                        {
-                            (void)parse_string();
-                            expect(':');
-                            skip_value();
-                            if (!consume_if(',')) { break; }
-                        }
-                        expect('}');
+                    case '{':
+                    case '[': {
+                        const std::size_t end = scan::skip_container(text, pos);
+                        if (end == scan::too_deep) { skip_container_recursively(c); }
+                        else if (end == scan::npos) { fail("unterminated or unbalanced value"); }
+                        else if (end == scan::bad_scalar) { fail("bad literal or number in skipped value"); }
+                        else { pos = end; }
                         return;
                     }
-                    case '[': {
-                        ++pos;
-                        if (consume_if(']')) { return; }
-                        while (true)
-                        {
-                            skip_value();
-                            if (!consume_if(',')) { break; }
-                        }
-                        expect(']');
+                    case '"': {
+                        std::string scratch;
+                        (void)parse_string_view(scratch);
                         return;
                     }
-                    case '"': (void)parse_string(); return;
                     case 't':
                         if (!consume_keyword("true")) { fail("bad literal"); }
                         return;
@@ -330,6 +340,27 @@ namespace hgraph
                     default: (void)parse_number_token(); return;
                 }
             }
+
+            /** Token-by-token skip for nesting deeper than the structural
+                scan tracks. */
+            void skip_container_recursively(char open)
+            {
+                ++pos;
+                const char close = open == '{' ? '}' : ']';
+                if (consume_if(close)) { return; }
+                while (true)
+                {
+                    if (open == '{')
+                    {
+                        std::string scratch;
+                        (void)parse_string_view(scratch);
+                        expect(':');
+                    }
+                    skip_value();
+                    if (!consume_if(',')) { break; }
+                }
+                expect(close);
+            }
         };
 
         // ---------------------------------------------------------------
@@ -349,11 +380,12 @@ namespace hgraph
 
         [[nodiscard]] double parse_float_token(std::string_view token, const Reader &reader)
         {
+            // from_chars is locale-independent and does not allocate, but
+            // takes no leading '+'; strip one so "+1.5" still reads.
+            if (token.starts_with('+') && !token.substr(1).starts_with('-')) { token.remove_prefix(1); }
             double value{};
-            std::istringstream stream{std::string{token}};
-            stream.imbue(std::locale::classic());
-            stream >> std::noskipws >> value;
-            if (!stream || !stream.eof())
+            const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (ec != std::errc{} || ptr != token.data() + token.size())
             {
                 const_cast<Reader &>(reader).fail("bad number");
             }
@@ -1638,11 +1670,12 @@ namespace hgraph
             probe.expect('{');
             const std::string discriminator{converter.meta->bundle_discriminator()};
             std::string       requested;
+            std::string       key_scratch;
             if (!probe.consume_if('}'))
             {
                 while (true)
                 {
-                    const std::string key = probe.parse_string();
+                    const std::string_view key = probe.parse_string_view(key_scratch);
                     probe.expect(':');
                     if (key == discriminator) { requested = probe.parse_string(); }
                     else { probe.skip_value(); }
@@ -1712,11 +1745,12 @@ namespace hgraph
             else
             {
                 reader.expect('{');
+                std::string key_scratch;
                 if (!reader.consume_if('}'))
                 {
                     while (true)
                     {
-                        const std::string key = reader.parse_string();
+                        const std::string_view key = reader.parse_string_view(key_scratch);
                         reader.expect(':');
                         std::size_t index = self.names.size();
                         for (std::size_t i = 0; i < self.names.size(); ++i)
@@ -1800,14 +1834,15 @@ namespace hgraph
                 realized_read_binding(*self.children[0]),
                 realized_read_binding(*self.children[1])};
             reader.expect('{');
+            std::string key_scratch;
             if (!reader.consume_if('}'))
             {
                 while (true)
                 {
                     // The key arrives as a JSON string; string-tagged keys use
                     // its content, other keys parse the content as their token.
-                    const std::string key_text = reader.parse_string();
-                    Value             key;
+                    const std::string_view key_text = reader.parse_string_view(key_scratch);
+                    Value                  key;
                     if (self.children[0]->atomic_tag == AtomicTag::Str) { key = Value{Str{key_text}}; }
                     else
                     {
@@ -325,6 +325,149 @@ namespace hgraph
                 });
         }
 
+        // ---------------------------------------------------------------
+        // Batch append thunks: one call appends a column's cells for a span
+        // of rows. Fixed-width and binary leaves reserve once and then write
+        // without a capacity check per cell; the structured leaves loop over
+        // their per-cell thunk. An unset leaf appends a null.
+        // ---------------------------------------------------------------
+
+        template <typename Builder, typename Get>
+        void append_fixed_batch(std::span<const ValueView> leaves, arrow::ArrayBuilder &builder, const Get &get,
+                                const char *what)
+        {
+            auto &typed = static_cast<Builder &>(builder);
+            check(typed.Reserve(static_cast<std::int64_t>(leaves.size())), what);
+            for (const ValueView &leaf : leaves)
+            {
+                if (leaf.has_value()) { typed.UnsafeAppend(get(leaf)); }
+                else { typed.UnsafeAppendNull(); }
+            }
+        }
+
+        template <typename Builder, typename Get>
+        void append_binary_batch(std::span<const ValueView> leaves, arrow::ArrayBuilder &builder, const Get &get,
+                                 const char *what)
+        {
+            auto        &typed = static_cast<Builder &>(builder);
+            std::int64_t bytes = 0;
+            for (const ValueView &leaf : leaves)
+            {
+                if (leaf.has_value()) { bytes += static_cast<std::int64_t>(get(leaf).size()); }
+            }
+            check(typed.Reserve(static_cast<std::int64_t>(leaves.size())), what);
+            // Refuses a total past the builder's offset width, so no single
+            // cell below can overflow it either.
+            check(typed.ReserveData(bytes), what);
+            for (const ValueView &leaf : leaves)
+            {
+                if (!leaf.has_value())
+                {
+                    typed.UnsafeAppendNull();
+                    continue;
+                }
+                const std::string_view value = get(leaf);
+                typed.UnsafeAppend(value.data(), static_cast<std::int32_t>(value.size()));
+            }
+        }
+
+        void append_batch_bool(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::BooleanBuilder>(
+                leaves, builder, [](const ValueView &leaf) { return leaf.checked_as<Bool>(); }, "append bool");
+        }
+
+        void append_batch_int(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::Int64Builder>(
+                leaves, builder, [](const ValueView &leaf) { return leaf.checked_as<Int>(); }, "append int");
+        }
+
+        void append_batch_float(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::DoubleBuilder>(
+                leaves, builder, [](const ValueView &leaf) { return leaf.checked_as<Float>(); }, "append float");
+        }
+
+        void append_batch_str(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_binary_batch<arrow::StringBuilder>(
+                leaves, builder, [](const ValueView &leaf) { return std::string_view{leaf.checked_as<Str>()}; },
+                "append str");
+        }
+
+        void append_batch_bytes(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_binary_batch<arrow::BinaryBuilder>(
+                leaves, builder,
+                [](const ValueView &leaf) { return std::string_view{leaf.checked_as<Bytes>().data}; },
+                "append bytes");
+        }
+
+        void append_batch_date(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::Date32Builder>(
+                leaves, builder,
+                [](const ValueView &leaf) {
+                    return static_cast<std::int32_t>(
+                        std::chrono::sys_days{leaf.checked_as<Date>()}.time_since_epoch().count());
+                },
+                "append date");
+        }
+
+        void append_batch_datetime(const Column &, std::span<const ValueView> leaves,
+                                   arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::TimestampBuilder>(
+                leaves, builder,
+                [](const ValueView &leaf) { return leaf.checked_as<DateTime>().time_since_epoch().count(); },
+                "append datetime");
+        }
+
+        void append_batch_timedelta(const Column &, std::span<const ValueView> leaves,
+                                    arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::DurationBuilder>(
+                leaves, builder, [](const ValueView &leaf) { return leaf.checked_as<TimeDelta>().count(); },
+                "append timedelta");
+        }
+
+        void append_batch_time(const Column &, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::Time64Builder>(
+                leaves, builder, [](const ValueView &leaf) { return leaf.checked_as<Time>().microseconds; },
+                "append time");
+        }
+
+        void append_batch_civil_datetime(const Column &, std::span<const ValueView> leaves,
+                                         arrow::ArrayBuilder &builder)
+        {
+            append_fixed_batch<arrow::TimestampBuilder>(
+                leaves, builder,
+                [](const ValueView &leaf) { return leaf.checked_as<CivilDateTime>().epoch_microseconds(); },
+                "append civil datetime");
+        }
+
+        template <Column::AppendFn Append>
+        void append_each(const Column &column, std::span<const ValueView> leaves, arrow::ArrayBuilder &builder)
+        {
+            check(builder.Reserve(static_cast<std::int64_t>(leaves.size())), "reserve column");
+            for (const ValueView &leaf : leaves)
+            {
+                if (leaf.has_value()) { Append(column, leaf, builder); }
+                else { append_null(builder); }
+            }
+        }
+
+        constexpr Column::AppendBatchFn append_batch_period               = &append_each<&append_period>;
+        constexpr Column::AppendBatchFn append_batch_zone_id              = &append_each<&append_zone_id>;
+        constexpr Column::AppendBatchFn append_batch_zoned_datetime       = &append_each<&append_zoned_datetime>;
+        constexpr Column::AppendBatchFn append_batch_instant_range        = &append_each<&append_instant_range>;
+        constexpr Column::AppendBatchFn append_batch_civil_date_range     = &append_each<&append_civil_date_range>;
+        constexpr Column::AppendBatchFn append_batch_instant_range_set    = &append_each<&append_instant_range_set>;
+        constexpr Column::AppendBatchFn append_batch_civil_date_range_set =
+            &append_each<&append_civil_date_range_set>;
+
         Value read_bool(const Column &, const arrow::Array &array, std::int64_t row)
         {
             return Value{Bool{static_cast<const arrow::BooleanArray &>(array).Value(row)}};
@@ -611,11 +754,13 @@ namespace hgraph
         {
             std::shared_ptr<arrow::DataType> type;
             Column::AppendFn                 append;
+            Column::AppendBatchFn            append_batch;
             Column::ReadFn                   read;
         };
 
         void append_sequence(const Column &, const ValueView &, arrow::ArrayBuilder &);
         Value read_sequence(const Column &, const arrow::Array &, std::int64_t);
+        constexpr Column::AppendBatchFn append_batch_sequence = &append_each<&append_sequence>;
 
 /**
  * The atomic leaves the table codec can carry, as ONE list: the dispatch in
@@ -651,7 +796,7 @@ namespace hgraph
 #define HGRAPH_TABLE_LEAF_DISPATCH(Type, ArrowType, Suffix)                       \
     if (meta == scalar_descriptor<Type>::value_meta())                            \
     {                                                                             \
-        return {ArrowType, &append_##Suffix, &read_##Suffix};                     \
+        return {ArrowType, &append_##Suffix, append_batch_##Suffix, &read_##Suffix}; \
     }
             HGRAPH_TABLE_ATOMIC_LEAVES(HGRAPH_TABLE_LEAF_DISPATCH)
 #undef HGRAPH_TABLE_LEAF_DISPATCH
@@ -659,7 +804,8 @@ namespace hgraph
                  (meta->value_kind() == ValueTypeKind::Tuple && meta->has(ValueTypeFlags::VariadicTuple))) &&
                 meta->element_type != nullptr)
             {
-                return {arrow::list(leaf_ops_for(meta->element_type).type), &append_sequence, &read_sequence};
+                return {arrow::list(leaf_ops_for(meta->element_type).type), &append_sequence,
+                        append_batch_sequence, &read_sequence};
             }
             throw std::logic_error(fmt::format("table codec: unsupported leaf scalar '{}'",
                                                meta != nullptr && !meta->name().empty() ? meta->name()
@@ -913,12 +1059,13 @@ namespace hgraph
             const auto add_leaf = [&](std::string name, const ValueTypeMetaData *leaf,
                                       std::vector<std::size_t> path) {
                 LeafOps ops = leaf_ops_for(leaf);
-                converter->columns.push_back(Column{.name      = std::move(name),
-                                                    .leaf_meta = leaf,
-                                                    .path      = std::move(path),
-                                                    .type      = ops.type,
-                                                    .append    = ops.append,
-                                                    .read      = ops.read});
+                converter->columns.push_back(Column{.name         = std::move(name),
+                                                    .leaf_meta    = leaf,
+                                                    .path         = std::move(path),
+                                                    .type         = ops.type,
+                                                    .append       = ops.append,
+                                                    .append_batch = ops.append_batch,
+                                                    .read         = ops.read});
             };
 
             switch (meta->value_kind())
@@ -1030,12 +1177,13 @@ namespace hgraph
                     fmt::format("table recorder: column '{}' has no leaf metadata", names[i]));
             }
             const LeafOps ops = leaf_ops_for(leaf_metas[i]);
-            impl_->columns.push_back(Column{.name      = names[i],
-                                            .leaf_meta = leaf_metas[i],
-                                            .path      = {},
-                                            .type      = ops.type,
-                                            .append    = ops.append,
-                                            .read      = ops.read});
+            impl_->columns.push_back(Column{.name         = names[i],
+                                            .leaf_meta    = leaf_metas[i],
+                                            .path         = {},
+                                            .type         = ops.type,
+                                            .append       = ops.append,
+                                            .append_batch = ops.append_batch,
+                                            .read         = ops.read});
             impl_->builders.push_back(make_builder(ops.type));
             impl_->written.push_back(-1);
             fields.push_back(arrow::field(names[i], ops.type));
@@ -1155,12 +1303,13 @@ namespace hgraph
         // Python-supplied store that the runtime never wrote.
         validate_versioned_array_type(array, leaf_meta, schema, "table cell");
         const LeafOps ops = leaf_ops_for(leaf_meta);
-        const Column  column{.name      = {},
-                             .leaf_meta = leaf_meta,
-                             .path      = {},
-                             .type      = ops.type,
-                             .append    = ops.append,
-                             .read      = ops.read};
+        const Column  column{.name         = {},
+                             .leaf_meta    = leaf_meta,
+                             .path         = {},
+                             .type         = ops.type,
+                             .append       = ops.append,
+                             .append_batch = ops.append_batch,
+                             .read         = ops.read};
         return ops.read(column, array, row);
     }
 
@@ -1251,13 +1400,14 @@ namespace hgraph
         builders.reserve(columns.size());
         for (const auto &column : columns) { builders.push_back(make_builder(column.type)); }
 
-        for (const ValueView &row : rows)
+        std::vector<TupleView> tuples;
+        tuples.reserve(rows.size());
+        for (const ValueView &row : rows) { tuples.push_back(row.as_tuple()); }
+        std::vector<ValueView> leaves(rows.size());
+        for (std::size_t i = 0; i < columns.size(); ++i)
         {
-            const auto tuple = row.as_tuple();
-            for (std::size_t i = 0; i < columns.size(); ++i)
-            {
-                append_column(columns[i], tuple.at(first_column + i), *builders[i]);
-            }
+            for (std::size_t r = 0; r < tuples.size(); ++r) { leaves[r] = tuples[r].at(first_column + i); }
+            columns[i].append_batch(columns[i], leaves, *builders[i]);
         }
 
         arrow::ArrayVector arrays;
@@ -1280,15 +1430,17 @@ namespace hgraph
         builders.reserve(columns.size());
         for (const auto &column : columns) { builders.push_back(make_builder(column.type)); }
 
-        for (const Value &row : rows)
+        std::vector<ValueView> leaves(rows.size());
+        for (std::size_t i = 0; i < columns.size(); ++i)
         {
-            const ValueView view = row.view();
-            for (std::size_t i = 0; i < columns.size(); ++i)
+            const auto &column = columns[i];
+            for (std::size_t r = 0; r < rows.size(); ++r)
             {
-                const auto &column = columns[i];
-                if (column.path.empty()) { append_column(column, view, *builders[i]); }
-                else { append_column(column, view.as_bundle().at(column.path.front()), *builders[i]); }
+                // v1 paths are depth <= 1 (atomic or depth-1 bundle field).
+                const ValueView view = rows[r].view();
+                leaves[r] = column.path.empty() ? view : view.as_bundle().at(column.path.front());
             }
+            column.append_batch(column, leaves, *builders[i]);
         }
 
         arrow::ArrayVector arrays;
@@ -1383,6 +1535,101 @@ namespace hgraph
         return array_cell(*array, leaf, row);
     }
 
+    FrameColumnCursor::FrameColumnCursor(const Frame &frame, std::string_view column,
+                                         const ValueTypeMetaData *leaf)
+        : name_(column)
+    {
+        if (!frame.has_value()) { throw std::invalid_argument("table codec: cannot read an empty frame"); }
+        if (leaf == nullptr)
+        {
+            throw std::invalid_argument(fmt::format("table codec: column '{}' has no native schema", column));
+        }
+        column_ = frame.table->GetColumnByName(name_);
+        if (column_ == nullptr)
+        {
+            throw std::invalid_argument(fmt::format("table codec: frame is missing column '{}'", column));
+        }
+        const std::string source = fmt::format("column '{}'", column);
+        std::int64_t      end    = 0;
+        chunk_ends_.reserve(static_cast<std::size_t>(column_->num_chunks()));
+        for (const auto &chunk : column_->chunks())
+        {
+            validate_versioned_array_type(*chunk, leaf, *frame.table->schema(), source);
+            end += chunk->length();
+            chunk_ends_.push_back(end);
+        }
+        const LeafOps ops = leaf_ops_for(leaf);
+        reader_           = Column{.leaf_meta = leaf, .type = ops.type, .read = ops.read};
+        date_time_        = leaf == scalar_descriptor<DateTime>::value_meta();
+    }
+
+    std::int64_t FrameColumnCursor::length() const noexcept { return column_ != nullptr ? column_->length() : 0; }
+
+    const arrow::Array &FrameColumnCursor::locate(std::int64_t row, std::int64_t &local) const
+    {
+        if (column_ == nullptr) { throw std::logic_error("table codec: read through an unbound column cursor"); }
+        if (row < 0 || row >= column_->length())
+        {
+            throw std::out_of_range(fmt::format("table codec: row {} is outside column '{}'", row, name_));
+        }
+        std::size_t chunk = chunk_;
+        if (row < (chunk == 0 ? 0 : chunk_ends_[chunk - 1]) || row >= chunk_ends_[chunk])
+        {
+            chunk  = static_cast<std::size_t>(std::ranges::upper_bound(chunk_ends_, row) - chunk_ends_.begin());
+            chunk_ = chunk;
+        }
+        local = row - (chunk == 0 ? 0 : chunk_ends_[chunk - 1]);
+        return *column_->chunk(static_cast<int>(chunk));
+    }
+
+    Value FrameColumnCursor::read(std::int64_t row) const
+    {
+        std::int64_t        local = 0;
+        const arrow::Array &array = locate(row, local);
+        if (array.IsNull(local)) { return Value{}; }
+        return reader_.read(reader_, array, local);
+    }
+
+    bool FrameColumnCursor::is_null(std::int64_t row) const
+    {
+        std::int64_t local = 0;
+        return locate(row, local).IsNull(local);
+    }
+
+    DateTime FrameColumnCursor::date_time(std::int64_t row) const
+    {
+        if (!date_time_)
+        {
+            throw std::logic_error(fmt::format("table codec: column '{}' is not read as a DateTime", name_));
+        }
+        std::int64_t        local = 0;
+        const arrow::Array &array = locate(row, local);
+        if (array.IsNull(local))
+        {
+            throw std::invalid_argument(fmt::format("table codec: null value in DateTime column '{}'", name_));
+        }
+        return DateTime{std::chrono::microseconds{static_cast<const arrow::TimestampArray &>(array).Value(local)}};
+    }
+
+    Frame frame_select_columns(const Frame &frame, std::span<const std::string> columns)
+    {
+        if (!frame.has_value()) { return frame; }
+        std::vector<int> indices;
+        indices.reserve(columns.size());
+        for (const auto &name : columns)
+        {
+            const int index = frame.table->schema()->GetFieldIndex(name);
+            if (index < 0)
+            {
+                throw std::invalid_argument(fmt::format("table codec: frame is missing column '{}'", name));
+            }
+            if (std::ranges::find(indices, index) == indices.end()) { indices.push_back(index); }
+        }
+        auto selected = frame.table->SelectColumns(indices);
+        if (!selected.ok()) { fail_status(selected.status(), "select columns"); }
+        return Frame{*selected};
+    }
+
     Frame frame_rename_columns(const Frame &frame,
                                std::span<const std::pair<std::string, std::string>> renames)
     {
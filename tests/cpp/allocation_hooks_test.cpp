@@ -0,0 +1,94 @@
+// Installs the counting allocator of allocation_hooks.h, so it is built as
+// its own executable: the shared unit test binaries must not replace the
+// global operator new.
+
+#include <hgraph/runtime/allocation_hooks.h>
+
+#include <hgraph/lib/std/std_operators.h>
+#include <hgraph/runtime/evaluation_profiler.h>
+#include <hgraph/runtime/executor.h>
+#include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <new>
+#include <string_view>
+
+namespace {
+using namespace hgraph;
+
+struct ProfileHookedAllocations {
+  static constexpr auto name = "profile_hooked_allocations";
+
+  // Direct calls to the allocation functions, which unlike new-expressions
+  // the compiler may not elide.
+  static void eval(In<"ts", TS<Int>>) {
+    void *large = ::operator new(64);
+    void *small = ::operator new(32);
+    ::operator delete(small);
+    ::operator delete(large);
+  }
+};
+
+EvaluationProfileSnapshot run_profile(EvaluationProfilerOptions options) {
+  stdlib::register_standard_operators();
+  EvaluationProfiler profiler{options};
+
+  Wiring wiring;
+  auto input = wire<stdlib::const_>(wiring, Int{41}).as<TS<Int>>();
+  static_cast<void>(wire<ProfileHookedAllocations>(wiring, input));
+
+  GraphExecutorBuilder builder;
+  builder.graph_builder(std::move(wiring).finish())
+      .add_lifecycle_observer(&profiler);
+  GraphExecutorValue executor = builder.make_executor();
+  executor.view().run();
+  return profiler.snapshot();
+}
+
+const EvaluationProfileEntry &
+entry_containing(const EvaluationProfileSnapshot &snapshot,
+                 std::string_view text) {
+  const auto found = std::ranges::find_if(
+      snapshot.entries, [&](const EvaluationProfileEntry &entry) {
+        return entry.path.contains(text);
+      });
+  REQUIRE(found != snapshot.entries.end());
+  return *found;
+}
+} // namespace
+
+TEST_CASE("allocation hooks count the calling thread's allocations") {
+  REQUIRE(allocation_counting_installed());
+
+  const AllocationCount started = thread_allocation_count();
+  void *memory = ::operator new(48);
+  ::operator delete(memory);
+  const AllocationCount counted = thread_allocation_count() - started;
+  CHECK(counted.allocations == 1);
+  CHECK(counted.bytes == 48);
+}
+
+TEST_CASE("evaluation profiler: hooked allocations are counted on request") {
+  const EvaluationProfileSnapshot plain = run_profile({});
+  CHECK(entry_containing(plain, "profile_hooked_allocations")
+            .evaluation.allocations == 0);
+
+  const EvaluationProfileSnapshot snapshot =
+      run_profile(EvaluationProfilerOptions{.allocations = true});
+  const EvaluationProfileEntry &node =
+      entry_containing(snapshot, "profile_hooked_allocations");
+  REQUIRE(node.evaluation.count == 1);
+  // Node dispatch may allocate around the two calls of ``eval``.
+  CHECK(node.evaluation.allocations >= 2);
+  CHECK(node.evaluation.allocated_bytes >= 96);
+  CHECK(node.evaluation.max_allocations == node.evaluation.allocations);
+  CHECK(node.evaluation.max_allocated_bytes == node.evaluation.allocated_bytes);
+
+  // The graph's evaluation brackets its nodes'.
+  const EvaluationProfileEntry &graph = entry_containing(snapshot, "[]");
+  CHECK(graph.evaluation.allocations >= node.evaluation.allocations);
+  CHECK(graph.evaluation.allocated_bytes >= node.evaluation.allocated_bytes);
+}
@@ -3,7 +3,9 @@
 #include <hgraph/lib/testing/record_replay.h>
 #include <hgraph/runtime/runtime.h>
 #include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/metadata/type_registry.h>
 #include <hgraph/types/static_node.h>
+#include <hgraph/types/value/json_codec.h>
 
 #include <atomic>
 #include <chrono>
@@ -102,6 +104,14 @@ namespace
         return payload;
     }
 
+    /** ``make_payload`` without the leading ``target`` entry: a map of
+        instrument records keyed by field name. */
+    std::string make_map_payload(int field_count)
+    {
+        const std::string payload = make_payload(field_count);
+        return "{" + payload.substr(payload.find("\"field"));
+    }
+
     struct JsonExtractGraph
     {
         [[maybe_unused]] static constexpr auto name = "json_extract_perf_graph";
@@ -214,6 +224,39 @@ namespace
         };
     }
 
+    /** Schema-directed decode through ``JsonConverter``, outside any graph. */
+    Metrics run_converter(std::string name, const hgraph::ValueTypeMetaData *schema, std::string_view text,
+                          int repeats)
+    {
+        const hgraph::JsonConverter &converter = hgraph::json_converter(schema);
+        std::size_t                  checksum  = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            AllocationScope allocations;
+            for (int i = 0; i < repeats; ++i)
+            {
+                const hgraph::Value value = hgraph::from_json_string(converter, text);
+                checksum += value.view().has_value() ? 1U : 0U;
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        if (checksum != static_cast<std::size_t>(repeats)) { std::cerr << name << ": decode produced no value\n"; }
+        return Metrics{
+            std::move(name),
+            static_cast<std::size_t>(repeats),
+            std::chrono::duration<double, std::milli>(end - start).count(),
+            g_allocations.load(std::memory_order_relaxed),
+            g_allocated_bytes.load(std::memory_order_relaxed),
+        };
+    }
+
+    void print_throughput(const Metrics &metrics, std::size_t payload_bytes)
+    {
+        const double megabytes = static_cast<double>(payload_bytes * metrics.ticks) / 1.0e6;
+        std::cout << "  " << metrics.name << " mb_per_s=" << (megabytes * 1000.0 / metrics.milliseconds) << '\n';
+    }
+
     void print_metrics(const Metrics &metrics)
     {
         const double ticks = static_cast<double>(metrics.ticks);
@@ -275,4 +318,30 @@ int main()
     print_metrics(run_one_input<JsonExtractGraph>("decode+extract_leaf", input));
     print_metrics(run_one_input<JsonEncodeGraph>("decode+encode", input));
     print_metrics(run_equality(input, input_equivalent));
+
+    // Schema-directed decode throughput: a bundle that wants one entry and
+    // skips the rest, and a map that materialises every record.
+    auto &registry = hgraph::TypeRegistry::instance();
+    const auto *int_meta    = registry.register_scalar<hgraph::Int>("int");
+    const auto *str_meta    = registry.register_scalar<hgraph::Str>("str");
+    const auto *prices_meta = registry.list(int_meta);
+    const auto *target_meta = registry.un_named_bundle(
+        {{"answer", int_meta}, {"label", str_meta}, {"values", prices_meta}});
+    const auto *record_meta = registry.un_named_bundle(
+        {{"id", int_meta}, {"name", str_meta}, {"prices", prices_meta}});
+    const auto *bundle_meta = registry.un_named_bundle({{"target", target_meta}});
+    const auto *map_meta    = registry.map(str_meta, record_meta);
+    const std::string map_payload = make_map_payload(fields);
+
+    for (const auto &[name, text] : {std::pair<std::string, std::string_view>{"converter_bundle_skip", payload},
+                                     std::pair<std::string, std::string_view>{"converter_bundle_skip_spaced",
+                                                                              equivalent_payload}})
+    {
+        const Metrics metrics = run_converter(name, bundle_meta, text, ticks);
+        print_metrics(metrics);
+        print_throughput(metrics, text.size());
+    }
+    const Metrics map_metrics = run_converter("converter_map_records", map_meta, map_payload, ticks);
+    print_metrics(map_metrics);
+    print_throughput(map_metrics, map_payload.size());
 }
@@ -0,0 +1,183 @@
+// Producer-contention microbenchmark for the push-source queue policies.
+//
+// Each run starts a real-time graph with one push source feeding a counting
+// sink. On start, N producer threads each send a fixed number of values with
+// send_blocking; the run ends when the sink has seen every value. Reported
+// per policy and producer count: end-to-end throughput and the mean time a
+// producer spends inside one send (the contended admission path).
+//
+//   HGRAPH_PUSH_PERF_VALUES     values per producer (default 200000)
+//   HGRAPH_PUSH_PERF_CAPACITY   queue bound / ring capacity (default 4096)
+
+#include <hgraph/lib/std/standard_types.h>
+#include <hgraph/lib/testing/runtime_support.h>
+#include <hgraph/runtime/runtime.h>
+#include <hgraph/types/metadata/type_registry.h>
+#include <hgraph/types/static_schema.h>
+#include <hgraph/types/type_resolution.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace hgraph;
+
+    struct Metrics
+    {
+        std::string_view policy;
+        bool             burst{false};
+        std::size_t      producers{0};
+        std::size_t      values{0};
+        double           milliseconds{0.0};
+        double           send_ns{0.0};
+    };
+
+    [[nodiscard]] NodeBuilder counting_sink(const TSValueTypeMetaData &input_schema,
+                                            const TSValueTypeMetaData &input_ts, bool burst,
+                                            std::size_t &received, std::size_t stop_after)
+    {
+        NodeTypeMetaData schema;
+        schema.display_name = "push_perf_counting_sink";
+        schema.input_schema = &input_schema;
+        schema.node_kind = NodeKind::Sink;
+
+        NodeCallbacks callbacks;
+        callbacks.evaluate = [burst, &received, stop_after](const NodeView &view, DateTime evaluation_time) {
+            auto root   = view.input(evaluation_time);
+            auto bundle = root.as_bundle();
+            received += burst ? bundle[0].value().as_list().size() : 1;
+            if (received >= stop_after) { view.graph().executor().request_stop(); }
+        };
+
+        return NodeBuilder::native(std::move(schema), std::move(callbacks),
+                                   hgraph::testing::single_input_endpoint(input_schema, input_ts));
+    }
+
+    [[nodiscard]] Metrics run_one(std::string_view policy_name, bool burst,
+                                  const std::function<PushSourcePolicy(const TSValueTypeMetaData &)> &make_policy,
+                                  std::size_t producer_count, std::size_t values_per_producer)
+    {
+        const auto *output_ts = burst ? ts_type<TS<HomogeneousTuple<Int>>>() : ts_type<TS<Int>>();
+        const auto *input_schema = hgraph::testing::single_input_schema(*output_ts);
+        const std::size_t total = producer_count * values_per_producer;
+
+        std::size_t                received{0};
+        std::vector<std::thread>   producers;
+        std::atomic<std::uint64_t> send_nanoseconds{0};
+        std::chrono::steady_clock::time_point started{};
+
+        PushSourceNodeExtension extension;
+        extension.on_start = [&](PushSourceSender sender, const NodeView &, DateTime) {
+            started = std::chrono::steady_clock::now();
+            producers.reserve(producer_count);
+            for (std::size_t producer = 0; producer < producer_count; ++producer)
+            {
+                producers.emplace_back([sender, values_per_producer, &send_nanoseconds] {
+                    std::uint64_t elapsed = 0;
+                    for (std::size_t index = 0; index < values_per_producer; ++index)
+                    {
+                        const auto before = std::chrono::steady_clock::now();
+                        sender.send_blocking(Int{static_cast<std::int64_t>(index)});
+                        elapsed += static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - before)
+                                .count());
+                    }
+                    send_nanoseconds.fetch_add(elapsed, std::memory_order_relaxed);
+                });
+            }
+        };
+        extension.on_stop = [&](const NodeView &) {
+            for (auto &producer : producers)
+            {
+                if (producer.joinable()) { producer.join(); }
+            }
+        };
+
+        GraphBuilder builder;
+        builder.add_node(make_push_source_node_with_view(*output_ts, make_policy(*output_ts), std::move(extension)));
+        builder.add_node(counting_sink(*input_schema, *output_ts, burst, received, total));
+        builder.add_edge(GraphEdge{
+            .source_node = make_graph_edge_source(0),
+            .source_path = {},
+            .target_node = 1,
+            .target_path = {0},
+        });
+
+        const DateTime start_time = hgraph::testing::wall_now();
+        GraphExecutorBuilder executor_builder;
+        executor_builder.graph_builder(std::move(builder))
+            .mode(GraphExecutorMode::RealTime)
+            .start_time(start_time)
+            .end_time(start_time + TimeDelta{std::chrono::minutes{5}});
+        auto executor = executor_builder.make_executor();
+        executor.view().run();
+        const auto finished = std::chrono::steady_clock::now();
+
+        return Metrics{
+            .policy       = policy_name,
+            .burst        = burst,
+            .producers    = producer_count,
+            .values       = received,
+            .milliseconds = std::chrono::duration<double, std::milli>(finished - started).count(),
+            .send_ns      = static_cast<double>(send_nanoseconds.load()) / static_cast<double>(std::max<std::size_t>(total, 1)),
+        };
+    }
+
+    void print_metrics(const Metrics &metrics)
+    {
+        std::cout << metrics.policy << (metrics.burst ? "/burst" : "/queue")
+                  << " producers=" << metrics.producers
+                  << " values=" << metrics.values
+                  << " ms=" << metrics.milliseconds
+                  << " msgs_per_s=" << (static_cast<double>(metrics.values) * 1000.0 / metrics.milliseconds)
+                  << " ns_per_send=" << metrics.send_ns
+                  << '\n';
+    }
+
+    std::size_t env_size(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr) { return fallback; }
+        return static_cast<std::size_t>(std::max(1L, std::atol(value)));
+    }
+}  // namespace
+
+int main()
+{
+    const std::size_t values   = env_size("HGRAPH_PUSH_PERF_VALUES", 200'000);
+    const std::size_t capacity = env_size("HGRAPH_PUSH_PERF_CAPACITY", 4096);
+    std::cout << "values_per_producer=" << values << " capacity=" << capacity << '\n';
+
+    for (const bool burst : {false, true})
+    {
+        for (const std::size_t producers : std::array<std::size_t, 4>{1, 2, 4, 8})
+        {
+            print_metrics(run_one(
+                "mutex", burst,
+                [&](const TSValueTypeMetaData &schema) {
+                    return burst ? make_push_source_burst_policy(schema, capacity)
+                                 : make_push_source_queue_policy(schema, capacity);
+                },
+                producers, values));
+            print_metrics(run_one(
+                "ring", burst,
+                [&](const TSValueTypeMetaData &schema) {
+                    return burst ? make_push_source_ring_burst_policy(schema, capacity)
+                                 : make_push_source_ring_queue_policy(schema, capacity);
+                },
+                producers, values));
+        }
+    }
+}
@@ -0,0 +1,151 @@
+// Column-append microbenchmark for the table codec.
+//
+// Builds rows of a four-column bundle (Int, Float, DateTime, Str) and writes
+// them into Arrow builders three ways: one per-cell ``Column::append`` call
+// per row and column, one ``Column::append_batch`` call per column, and the
+// whole ``frame_from_values`` path that to_data_frame and group_by use.
+// Reported per case: rows per second over the best of the repeats.
+//
+//   HGRAPH_TABLE_PERF_ROWS      rows per frame (default 100000)
+//   HGRAPH_TABLE_PERF_REPEATS   repeats per case (default 20)
+
+#include <hgraph/types/metadata/type_registry.h>
+#include <hgraph/types/metadata/value_plan_factory.h>
+#include <hgraph/types/value/table_codec.h>
+#include <hgraph/types/value/value_builder.h>
+
+#include <arrow/api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace hgraph;
+
+    int env_int(const char *name, int fallback)
+    {
+        const char *value = std::getenv(name);
+        if (value == nullptr) { return fallback; }
+        return std::max(1, std::atoi(value));
+    }
+
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>> make_builders(const TableConverter &converter)
+    {
+        std::vector<std::unique_ptr<arrow::ArrayBuilder>> builders;
+        for (const auto &column : converter.columns)
+        {
+            std::unique_ptr<arrow::ArrayBuilder> builder;
+            if (!arrow::MakeBuilder(arrow::default_memory_pool(), column.type, &builder).ok())
+            {
+                throw std::runtime_error("table_perf: make builder failed");
+            }
+            builders.push_back(std::move(builder));
+        }
+        return builders;
+    }
+
+    void finish_all(std::vector<std::unique_ptr<arrow::ArrayBuilder>> &builders)
+    {
+        for (auto &builder : builders)
+        {
+            std::shared_ptr<arrow::Array> array;
+            if (!builder->Finish(&array).ok()) { throw std::runtime_error("table_perf: finish failed"); }
+        }
+    }
+
+    double best_seconds(int repeats, const std::function<void()> &run)
+    {
+        double best = 0.0;
+        for (int i = 0; i < repeats; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = i == 0 ? seconds : std::min(best, seconds);
+        }
+        return best;
+    }
+
+    void print_rate(std::string_view name, std::size_t rows, double seconds)
+    {
+        std::cout << name << " rows=" << rows << " ms=" << (seconds * 1000.0)
+                  << " rows_per_s=" << (static_cast<double>(rows) / seconds) << '\n';
+    }
+}  // namespace
+
+int main()
+{
+    const int rows    = env_int("HGRAPH_TABLE_PERF_ROWS", 100000);
+    const int repeats = env_int("HGRAPH_TABLE_PERF_REPEATS", 20);
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *meta     = registry.un_named_bundle({{"id", registry.register_scalar<Int>("int")},
+                                                     {"price", registry.register_scalar<Float>("float")},
+                                                     {"at", registry.register_scalar<DateTime>("datetime")},
+                                                     {"name", registry.register_scalar<Str>("str")}});
+    const auto  binding  = ValuePlanFactory::instance().type_for(meta);
+
+    std::vector<Value> values;
+    values.reserve(static_cast<std::size_t>(rows));
+    for (int i = 0; i < rows; ++i)
+    {
+        BundleBuilder builder{binding};
+        builder.set("id", Value{Int{i}});
+        builder.set("price", Value{Float{100.0 + i * 0.25}});
+        builder.set("at", Value{DateTime{std::chrono::microseconds{1'700'000'000'000'000LL + i}}});
+        if (i % 16 != 0) { builder.set("name", Value{Str{"instrument-" + std::to_string(i % 512)}}); }
+        values.push_back(builder.build());
+    }
+
+    const TableConverter &converter = table_converter(meta);
+    const std::size_t     columns   = converter.columns.size();
+    std::vector<std::vector<ValueView>> leaves(columns, std::vector<ValueView>(values.size()));
+    for (std::size_t c = 0; c < columns; ++c)
+    {
+        const std::size_t field = converter.columns[c].path.front();
+        for (std::size_t r = 0; r < values.size(); ++r) { leaves[c][r] = values[r].view().as_bundle().at(field); }
+    }
+
+    std::cout << "rows=" << rows << " columns=" << columns << " repeats=" << repeats << '\n';
+
+    print_rate("per_cell_append", values.size(), best_seconds(repeats, [&] {
+                   auto builders = make_builders(converter);
+                   for (std::size_t r = 0; r < values.size(); ++r)
+                   {
+                       for (std::size_t c = 0; c < columns; ++c)
+                       {
+                           const auto &column = converter.columns[c];
+                           if (leaves[c][r].has_value()) { column.append(column, leaves[c][r], *builders[c]); }
+                           else if (!builders[c]->AppendNull().ok())
+                           {
+                               throw std::runtime_error("table_perf: append null failed");
+                           }
+                       }
+                   }
+                   finish_all(builders);
+               }));
+
+    print_rate("column_batch_append", values.size(), best_seconds(repeats, [&] {
+                   auto builders = make_builders(converter);
+                   for (std::size_t c = 0; c < columns; ++c)
+                   {
+                       const auto &column = converter.columns[c];
+                       column.append_batch(column, leaves[c], *builders[c]);
+                   }
+                   finish_all(builders);
+               }));
+
+    print_rate("frame_from_values", values.size(), best_seconds(repeats, [&] {
+                   const Frame frame = frame_from_values(converter, values);
+                   if (frame.table->num_rows() != rows) { throw std::runtime_error("table_perf: row count"); }
+               }));
+}
@@ -1,13 +1,19 @@
 #include <hgraph/lib/testing/runtime_support.h>
 #include <hgraph/lib/std/operators/impl/record_replay_memory_impl.h>
+#include <hgraph/lib/std/std_operators.h>
 #include <hgraph/lib/testing/record_replay.h>
 #include <hgraph/runtime/runtime.h>
+#include <hgraph/runtime/switch_node.h>
 #include <hgraph/types/graph_wiring.h>
+#include <hgraph/types/static_node.h>
+#include <hgraph/types/subgraph_wiring.h>
 #include <hgraph/types/metadata/type_registry.h>
 #include <hgraph/types/value/value.h>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
@@ -114,6 +120,174 @@ namespace
             wiring, Port<TS<Int>>{wiring, std::move(source_ref)}, Str{key});
     }
 
+    // Emits 1, 2, ... once per cycle for ``cycles`` cycles.
+    NodeBuilder cycle_source(const TSValueTypeMetaData &ts_int, Int cycles)
+    {
+        NodeTypeMetaData schema;
+        schema.display_name      = "cycle_source";
+        schema.output_schema     = &ts_int;
+        schema.node_kind         = NodeKind::PullSource;
+        schema.schedule_on_start = true;
+
+        NodeCallbacks callbacks;
+        callbacks.evaluate = [cycles, emitted = Int{0}](const NodeView &view,
+                                                        DateTime evaluation_time) mutable {
+            testing::set_output_value(view, evaluation_time, Int{++emitted});
+            if (emitted < cycles)
+            {
+                view.graph_value()->schedule_node(
+                    view.node_index(), evaluation_time + MIN_TD);
+            }
+        };
+        return NodeBuilder::native(std::move(schema), std::move(callbacks));
+    }
+
+    // Emits ``offset + sum(inputs)``; throws instead when the sum reaches
+    // ``fail_at``. Evaluations are counted across threads.
+    NodeBuilder summing_node(const TSValueTypeMetaData &input_schema,
+                             const TSValueTypeMetaData &ts_int,
+                             std::size_t inputs,
+                             Int offset,
+                             std::atomic<std::int32_t> &evaluations,
+                             Int fail_at = -1)
+    {
+        NodeTypeMetaData schema;
+        schema.display_name  = "summing_node";
+        schema.input_schema  = &input_schema;
+        schema.output_schema = &ts_int;
+        schema.node_kind     = NodeKind::Compute;
+
+        NodeCallbacks callbacks;
+        callbacks.evaluate = [inputs, offset, fail_at, &evaluations](const NodeView &view,
+                                                                     DateTime evaluation_time) {
+            evaluations.fetch_add(1, std::memory_order_relaxed);
+            auto root   = view.input(evaluation_time);
+            auto bundle = root.as_bundle();
+            Int  sum    = 0;
+            for (std::size_t index = 0; index < inputs; ++index)
+            {
+                sum += bundle[index].value().checked_as<Int>();
+            }
+            if (sum == fail_at) { throw std::runtime_error("summing node failed"); }
+            testing::set_output_value(view, evaluation_time, Int{offset + sum});
+        };
+
+        std::vector<TSEndpointSchema> children(inputs, TSEndpointSchema::peered(&ts_int));
+        return NodeBuilder::native(std::move(schema),
+                                   std::move(callbacks),
+                                   TSEndpointSchema::non_peered(&input_schema, std::move(children)));
+    }
+
+    // One source fanned out to ``width`` first-level nodes, which are summed
+    // pairwise by a second level: each level holds independent nodes.
+    struct FanOutGraph
+    {
+        static constexpr std::size_t width = 16;
+
+        GraphBuilder                            builder{};
+        std::vector<std::atomic<std::int32_t>>  evaluations;
+
+        FanOutGraph(const TSValueTypeMetaData &ts_int, Int cycles, Int fail_at = -1)
+            : evaluations(width + width / 2)
+        {
+            auto &registry = TypeRegistry::instance();
+            const auto *single =
+                registry.tsb("ParallelSingleInput", {{"value", &ts_int}});
+            const auto *pair = registry.tsb(
+                "ParallelPairInput", {{"lhs", &ts_int}, {"rhs", &ts_int}});
+
+            builder.add_node(cycle_source(ts_int, cycles));
+            for (std::size_t index = 0; index < width; ++index)
+            {
+                builder.add_node(summing_node(*single, ts_int, 1, static_cast<Int>(100 * index),
+                                              evaluations[index], fail_at))
+                    .add_edge(GraphEdge{.source_node = 0, .source_path = {},
+                                        .target_node = 1 + index, .target_path = {0}});
+            }
+            for (std::size_t index = 0; index < width / 2; ++index)
+            {
+                const std::size_t target = 1 + width + index;
+                builder.add_node(summing_node(*pair, ts_int, 2, 0, evaluations[width + index]))
+                    .add_edge(GraphEdge{.source_node = 1 + 2 * index, .source_path = {},
+                                        .target_node = target, .target_path = {0}})
+                    .add_edge(GraphEdge{.source_node = 2 + 2 * index, .source_path = {},
+                                        .target_node = target, .target_path = {1}});
+            }
+        }
+
+        GraphExecutorValue make_executor(std::size_t threads)
+        {
+            GraphExecutorBuilder executor_builder;
+            executor_builder.graph_builder(std::move(builder))
+                .mode(GraphExecutorMode::Simulation)
+                .start_time(MIN_ST)
+                .end_time(MIN_ST + TimeDelta{10})
+                .parallel_evaluation(threads);
+            return executor_builder.make_executor();
+        }
+    };
+
+    struct ScaledSourceTag
+    {
+    };
+
+    // Emits ``scale * (n + 1)`` at ``MIN_ST + n * MIN_TD``, reading ``scale``
+    // from global state; throws when it is zero. Stateless, so sweep runs can share it.
+    NodeBuilder scaled_source(const TSValueTypeMetaData &ts_int)
+    {
+        NodeTypeMetaData schema;
+        schema.display_name      = "scaled_source";
+        schema.output_schema     = &ts_int;
+        schema.node_kind         = NodeKind::PullSource;
+        schema.schedule_on_start = true;
+
+        NodeCallbacks callbacks;
+        callbacks.evaluate = [](const NodeView &view, DateTime evaluation_time) {
+            const Int scale = view.graph().global_state().get_as<Int>("scale");
+            if (scale == 0) { throw std::runtime_error("scale must not be zero"); }
+            const Int tick  = static_cast<Int>((evaluation_time - MIN_ST) / MIN_TD);
+            testing::set_output_value(view, evaluation_time, Int{scale * (tick + 1)});
+            view.graph_value()->schedule_node(view.node_index(), evaluation_time + MIN_TD);
+        };
+        return NodeBuilder::native(std::move(schema), std::move(callbacks));
+    }
+
+    // Emits ``in * n`` on its n-th evaluation, scheduling itself one tick
+    // ahead until it has emitted three values.
+    struct SelfSchedulingBranchNode
+    {
+        static constexpr auto name = "self_scheduling_branch_node";
+        static void           eval(In<"in", TS<Int>> in, NodeScheduler scheduler, State<Int> emitted,
+                                   Out<TS<Int>> out)
+        {
+            const Int n = emitted.get() + 1;
+            emitted.set(n);
+            out.set(in.value() * n);
+            if (n < 3) { scheduler.schedule(MIN_TD); }
+        }
+    };
+
+    struct SelfSchedulingBranch
+    {
+        static constexpr auto name = "self_scheduling_branch";
+        static Port<TS<Int>>  compose(Wiring &w, Port<TS<Int>> in) { return wire<SelfSchedulingBranchNode>(w, in); }
+    };
+
+    // A ``switch_`` whose only branch ticks on its own schedule after the
+    // single outer tick; its output is recorded under ``"switched"``.
+    Wiring self_scheduling_switch_wiring()
+    {
+        Wiring wiring;
+        auto   key    = wire<stdlib::const_, TS<Str>>(wiring, Str{"tick"});
+        auto   scalar = wire<stdlib::const_, TS<Int>>(wiring, Int{5});
+        auto   out    = wire<stdlib::switch_>(wiring, key,
+                                              stdlib::switch_cases({{Value{Str{"tick"}}, fn<SelfSchedulingBranch>()}}),
+                                              scalar)
+                       .as<TS<Int>>();
+        wire<stdlib::dense_record_impl>(wiring, out, Str{"switched"});
+        return wiring;
+    }
+
     GraphExecutorValue make_simulation_executor(Wiring wiring)
     {
         GraphExecutorBuilder builder;
@@ -179,3 +353,157 @@ TEST_CASE("distinct native graph engines progress independently on different thr
     CHECK(blocked_view.graph().global_state().get_as<Int>("progress") == Int{1});
     CHECK(independent_view.graph().global_state().get_as<Int>("progress") == Int{3});
 }
+
+TEST_CASE("parallel evaluation runs independent rank levels with sequential results",
+          "[runtime][concurrency]")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *ts_int   = registry.ts(registry.register_scalar<Int>("int"));
+    constexpr Int cycles = 5;
+
+    FanOutGraph sequential{*ts_int, cycles};
+    FanOutGraph parallel{*ts_int, cycles};
+    GraphExecutorValue sequential_executor = sequential.make_executor(0);
+    GraphExecutorValue parallel_executor   = parallel.make_executor(4);
+    CHECK(sequential_executor.view().parallel_evaluation_threads() == 0);
+    CHECK(parallel_executor.view().parallel_evaluation_threads() == 4);
+
+    sequential_executor.view().run();
+    parallel_executor.view().run();
+
+    const auto last_cycle = MIN_ST + MIN_TD * (cycles - 1);
+    auto       sequential_graph = sequential_executor.view().graph();
+    auto       parallel_graph   = parallel_executor.view().graph();
+    for (std::size_t index = 0; index < FanOutGraph::width + FanOutGraph::width / 2; ++index)
+    {
+        CHECK(parallel.evaluations[index].load() == cycles);
+        CHECK(sequential.evaluations[index].load() == cycles);
+        CHECK(parallel_graph.node_at(1 + index).output(last_cycle).value().checked_as<Int>() ==
+              sequential_graph.node_at(1 + index).output(last_cycle).value().checked_as<Int>());
+    }
+    // Second-level sums see both first-level outputs of the same cycle.
+    CHECK(parallel_graph.node_at(1 + FanOutGraph::width).output(last_cycle).value().checked_as<Int>() ==
+          2 * cycles + 100);
+}
+
+TEST_CASE("parallel evaluation reports the first failing node in rank order",
+          "[runtime][concurrency]")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *ts_int   = registry.ts(registry.register_scalar<Int>("int"));
+
+    // Every first-level node fails on the third cycle; the error names the
+    // lowest-ranked one, as a sequential walk would.
+    FanOutGraph        graph{*ts_int, 5, 3};
+    GraphExecutorValue executor = graph.make_executor(4);
+    CHECK_THROWS_WITH(executor.view().run(),
+                      Catch::Matchers::ContainsSubstring("node[1 'summing_node'] evaluate failed"));
+    CHECK(graph.evaluations[FanOutGraph::width].load() == 2);
+}
+
+TEST_CASE("sweep runner executes one wiring with per-run times and global state",
+          "[runtime][concurrency]")
+{
+    using namespace hgraph;
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *ts_int   = registry.ts(registry.register_scalar<Int>("int"));
+
+    Wiring wiring;
+    wiring.global_state().set("scale", Value{Int{1}});
+    wire_recorded_source<ScaledSourceTag>(wiring, scaled_source(*ts_int), "scaled");
+
+    GraphExecutorBuilder builder;
+    builder.graph_builder(std::move(wiring).finish())
+        .mode(GraphExecutorMode::Simulation)
+        .start_time(MIN_ST)
+        .end_time(MIN_ST + MIN_TD * 3);
+    SweepRunner runner{std::move(builder), 3};
+    CHECK(runner.threads() == 3);
+
+    std::vector<SweepRun> runs(8);
+    for (std::size_t index = 0; index < runs.size(); ++index)
+    {
+        runs[index].global_state.emplace_back("scale", Value{Int{static_cast<Int>(index)}});
+    }
+    runs[5].end_time   = MIN_ST + MIN_TD * 5;
+    runs[6].start_time = MIN_ST + MIN_TD * 10;
+    runs[6].end_time   = MIN_ST + MIN_TD * 12;
+
+    const auto results = runner.run(runs, [](std::size_t run, const GraphExecutorView &executor) {
+        return Value{Int{static_cast<Int>(run) * 100 + static_cast<Int>(
+            testing::get_recorded_values<Int>(executor.graph().global_state(), "scaled").size())}};
+    });
+    REQUIRE(results.size() == runs.size());
+
+    // Run 0 sets scale to zero: its failure stays in its own result.
+    CHECK_FALSE(results[0].ok());
+    CHECK_THROWS_WITH(std::rethrow_exception(results[0].error),
+                      Catch::Matchers::ContainsSubstring("scale must not be zero"));
+    CHECK_FALSE(results[0].value.has_value());
+
+    for (std::size_t index = 1; index < runs.size(); ++index)
+    {
+        INFO("run " << index);
+        REQUIRE(results[index].ok());
+        const Int scale  = static_cast<Int>(index);
+        const Int first  = index == 6 ? 11 : 1;
+        const Int cycles = index == 5 ? 5 : index == 6 ? 2 : 3;
+        std::vector<std::optional<Int>> expected;
+        for (Int tick = first; tick < first + cycles; ++tick) { expected.emplace_back(scale * tick); }
+        auto state = results[index].global_state;
+        CHECK(testing::get_recorded_values<Int>(state.view(), "scaled") == expected);
+        CHECK(state.view().get_as<Int>("scale") == scale);
+        CHECK(results[index].value.view().checked_as<Int>() == scale * 100 + cycles);
+    }
+
+    // The runner is reusable, and runs without overrides see the wiring-time state.
+    const auto again = runner.run(std::vector<SweepRun>(2));
+    REQUIRE(again.size() == 2);
+    for (const auto &result : again)
+    {
+        REQUIRE(result.ok());
+        auto state = result.global_state;
+        CHECK(testing::get_recorded_values<Int>(state.view(), "scaled") ==
+              std::vector<std::optional<Int>>{Int{1}, Int{2}, Int{3}});
+    }
+
+    GraphExecutorBuilder real_time;
+    real_time.mode(GraphExecutorMode::RealTime);
+    CHECK_THROWS_AS(SweepRunner(std::move(real_time)), std::invalid_argument);
+}
+
+TEST_CASE("sweep runner keeps the self-scheduled ticks of a switch_ branch",
+          "[runtime][concurrency]")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    const std::vector<std::optional<Int>> expected{Int{5}, Int{10}, Int{15}};
+
+    GraphExecutorValue standalone = make_simulation_executor(self_scheduling_switch_wiring());
+    auto               standalone_view = standalone.view();
+    standalone_view.run();
+    REQUIRE(testing::get_recorded_values<Int>(standalone_view.graph().global_state(), "switched") == expected);
+
+    GraphExecutorBuilder builder;
+    builder.graph_builder(self_scheduling_switch_wiring().finish())
+        .mode(GraphExecutorMode::Simulation)
+        .start_time(MIN_ST)
+        .end_time(MIN_ST + MIN_TD * 5);
+    SweepRunner runner{std::move(builder), 2};
+
+    const auto results = runner.run(std::vector<SweepRun>(4));
+    REQUIRE(results.size() == 4);
+    for (std::size_t index = 0; index < results.size(); ++index)
+    {
+        INFO("run " << index);
+        REQUIRE(results[index].ok());
+        auto state = results[index].global_state;
+        CHECK(testing::get_recorded_values<Int>(state.view(), "switched") == expected);
+    }
+}
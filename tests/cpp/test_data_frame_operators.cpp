@@ -762,6 +762,51 @@ TEST_CASE("data frame operators: from_data_frame skips rows before evaluation st
     CHECK(result[0]->view().checked_as<Int>() == Int{1});
 }
 
+TEST_CASE("data frame operators: from_data_frame replays chunked frames through the used columns")
+{
+    stdlib::register_standard_operators();
+    // Two chunks per column, plus a column replay never reads.
+    const auto with_note = [](const Frame &batch, const char *note) {
+        arrow::StringBuilder builder;
+        for (std::int64_t row = 0; row < batch.table->num_rows(); ++row)
+        {
+            require_arrow(builder.Append(note));
+        }
+        std::shared_ptr<arrow::Array> notes;
+        require_arrow(builder.Finish(&notes));
+        auto added = batch.table->AddColumn(1, arrow::field("note", arrow::utf8()),
+                                            std::make_shared<arrow::ChunkedArray>(notes));
+        require_arrow(added.status());
+        return *added;
+    };
+    const auto first  = scalar_batch({MIN_ST, MIN_ST + TimeDelta{1}}, {1, 2});
+    const auto second = scalar_batch({MIN_ST + TimeDelta{2}, MIN_ST + TimeDelta{3}}, {3, 4});
+    auto       joined = arrow::ConcatenateTables({with_note(first, "a"), with_note(second, "b")});
+    require_arrow(joined.status());
+    const Frame input{*joined};
+    REQUIRE(input.table->column(0)->num_chunks() == 2);
+
+    CHECK_OUTPUT((eval_node<stdlib::from_data_frame, TS<Int>>(
+                     input, Str{"date"}, Str{"key"}, Str{"value"}, TimeDelta{})),
+                 values<Int>(1, 2, 3, 4));
+
+    const std::array<std::string, 2> projection{"value", "date"};
+    const Frame projected = frame_select_columns(input, projection);
+    REQUIRE(projected.table->num_columns() == 2);
+    CHECK(projected.table->field(0)->name() == "value");
+    CHECK(projected.table->column(0) == input.table->GetColumnByName("value"));
+
+    // Out-of-order reads re-locate the chunk rather than trusting the last.
+    const FrameColumnCursor cursor{input, "value", scalar_descriptor<Int>::value_meta()};
+    CHECK(cursor.length() == 4);
+    CHECK(cursor.read(3).view().checked_as<Int>() == Int{4});
+    CHECK(cursor.read(0).view().checked_as<Int>() == Int{1});
+    CHECK(cursor.read(2).view().checked_as<Int>() == Int{3});
+    CHECK_THROWS_AS(cursor.read(4), std::out_of_range);
+    CHECK_THROWS_AS((FrameColumnCursor{input, "note", scalar_descriptor<Int>::value_meta()}),
+                    std::invalid_argument);
+}
+
 TEST_CASE("data frame operators: with_columns replaces and projects through C++ wiring")
 {
     stdlib::register_standard_operators();
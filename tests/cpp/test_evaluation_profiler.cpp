@@ -44,9 +44,10 @@ struct ProfileStopThrow {
 };
 
 template <typename Node>
-EvaluationProfileSnapshot run_profile(bool expect_failure = false) {
+EvaluationProfileSnapshot run_profile(bool expect_failure = false,
+                                      EvaluationProfilerOptions options = {}) {
   stdlib::register_standard_operators();
-  EvaluationProfiler profiler;
+  EvaluationProfiler profiler{options};
 
   Wiring wiring;
   auto input = wire<stdlib::const_>(wiring, Int{41}).as<TS<Int>>();
@@ -179,3 +180,74 @@ TEST_CASE(
   CHECK(snapshot.entries.front().evaluation.count == 1);
   CHECK(snapshot.entries.front().stop.count == 0);
 }
+
+TEST_CASE("evaluation profiler: histograms are collected only on request") {
+  const EvaluationProfileSnapshot plain = run_profile<ProfileAddOne>();
+  CHECK(plain.cycle_latency == nullptr);
+  CHECK(plain.scheduling_lag == nullptr);
+  CHECK(entry_containing(plain, "profile_add_one").evaluation.latency == nullptr);
+
+  const EvaluationProfileSnapshot snapshot = run_profile<ProfileAddOne>(
+      false, EvaluationProfilerOptions{.histograms = true});
+  REQUIRE(snapshot.cycle_latency != nullptr);
+  CHECK(snapshot.cycle_latency->count() == snapshot.graph_cycles);
+  // Simulation runs have no scheduling lag to sample.
+  REQUIRE(snapshot.scheduling_lag != nullptr);
+  CHECK(snapshot.scheduling_lag->count() == 0);
+
+  const EvaluationProfileEntry &node =
+      entry_containing(snapshot, "profile_add_one");
+  REQUIRE(node.evaluation.latency != nullptr);
+  CHECK(node.evaluation.latency->count() == node.evaluation.count);
+  CHECK(node.evaluation.latency->p999() <= node.evaluation.latency->max());
+  CHECK(node.start.latency == nullptr);
+  CHECK(node.stop.latency == nullptr);
+}
+
+TEST_CASE("evaluation profiler: allocations require the counting allocator") {
+  // The unit test binaries do not install allocation_hooks.h; the counts it
+  // produces are checked by hgraph_allocation_hooks_test.
+  REQUIRE_FALSE(allocation_counting_installed());
+  CHECK_THROWS_AS(
+      EvaluationProfiler(EvaluationProfilerOptions{.allocations = true}),
+      std::invalid_argument);
+  CHECK_THROWS_AS(
+      EvaluationProfiler(true, true, true, true, true, 100, false, true),
+      std::invalid_argument);
+
+  const EvaluationProfileSnapshot plain = run_profile<ProfileAddOne>();
+  CHECK(entry_containing(plain, "profile_add_one").evaluation.allocations ==
+        0);
+}
+
+TEST_CASE("latency histogram: quantiles stay within one bucket of the samples") {
+  using Duration = LatencyHistogram::Duration;
+  LatencyHistogram histogram;
+  CHECK(histogram.p50() == Duration{0});
+
+  for (std::int64_t sample = 1; sample <= 1000; ++sample) {
+    histogram.record(Duration{sample * 1000});
+  }
+  CHECK(histogram.count() == 1000);
+  CHECK(histogram.max() == Duration{1'000'000});
+
+  const auto within_a_sixteenth = [](Duration reported, Duration exact) {
+    return reported >= exact && reported - exact <= exact / 16;
+  };
+  CHECK(within_a_sixteenth(histogram.p50(), Duration{500'000}));
+  CHECK(within_a_sixteenth(histogram.p99(), Duration{990'000}));
+  CHECK(within_a_sixteenth(histogram.p999(), Duration{999'000}));
+  CHECK(histogram.quantile(1.0) == histogram.max());
+
+  // Beyond the tracked range a sample lands in the last bucket, and the
+  // maximum is still reported exactly.
+  const Duration huge = LatencyHistogram::max_trackable * 4;
+  histogram.record(huge);
+  CHECK(histogram.counts().back() == 1);
+  CHECK(histogram.quantile(1.0) == huge);
+
+  LatencyHistogram merged;
+  merged.merge(histogram);
+  CHECK(merged.count() == histogram.count());
+  CHECK(merged.p99() == histogram.p99());
+}
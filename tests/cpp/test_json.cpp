@@ -297,6 +297,51 @@ TEST_CASE("json: bundles serialize as objects; unknown fields are skipped on rea
     CHECK(back.view().as_bundle().at(1).checked_as<Str>() == Str{"here"});
 }
 
+TEST_CASE("json: scanned reads handle escapes, block-spanning strings and skipped containers")
+{
+    auto &registry = TypeRegistry::instance();
+    const auto *int_meta = registry.register_scalar<Int>("int");
+    const auto *str_meta = registry.register_scalar<Str>("str");
+    const auto *bundle_meta = registry.un_named_bundle({{"count", int_meta}, {"label", str_meta}});
+
+    // An escaped key still names its field; a label longer than one 64-byte
+    // scan block keeps escapes on both sides of the block boundary.
+    const std::string run(70, 'x');
+    const std::string text = "{\"co\\u0075nt\": 7, \"label\": \"" + run + "\\\"" + run + "\\\\\"}";
+    const Value       back = from_json_string(bundle_meta, text);
+    CHECK(back.view().as_bundle().at(0).checked_as<Int>() == Int{7});
+    CHECK(back.view().as_bundle().at(1).checked_as<Str>() == run + "\"" + run + "\\");
+
+    // Brackets and escaped quotes inside strings do not disturb a skipped value.
+    const Value skipped = from_json_string(
+        bundle_meta,
+        "{\"ignored\": {\"a\": \"}]\\\"[{\", \"b\": [[[\"\\\\\"]]], \"c\": \"" + run + "]\"}, \"count\": 9}");
+    CHECK(skipped.view().as_bundle().at(0).checked_as<Int>() == Int{9});
+
+    // A skipped value must still terminate and pair its brackets.
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"ignored\": [1, 2}, \"count\": 3}"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"ignored\": [\"open], \"count\": 3}"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"label\": \"" + run), std::invalid_argument);
+
+    // Scalars inside a skipped value are checked as the token skip checks
+    // them, including a number that runs across a block boundary.
+    const std::string digits(70, '7');
+    const Value scalars = from_json_string(
+        bundle_meta, "{\"ignored\": [true, false, null, -1.5e3, " + digits + "], \"count\": 5}");
+    CHECK(scalars.view().as_bundle().at(0).checked_as<Int>() == Int{5});
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"x\": [tru], \"count\": 3}"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"x\": {\"a\": nul}, \"count\": 3}"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"x\": [1, \\2], \"count\": 3}"), std::invalid_argument);
+    CHECK_THROWS_AS(from_json_string(bundle_meta, "{\"x\": [" + digits + "x], \"count\": 3}"),
+                    std::invalid_argument);
+
+    const Value map_schema = stdlib::make_map<Str, Int>({{Str{"a"}, Int{1}}});
+    const Value map = from_json_string(map_schema.view().schema(), "{\"a\\tb\": 1, \"plain\": 2}");
+    CHECK(map.view().as_map().size() == 2);
+    CHECK(map.view().as_map().at(Value{Str{"a\tb"}}.view()).checked_as<Int>() == Int{1});
+    CHECK(parse_json_value<Float>("+1.5e3") == Float{1500.0});
+}
+
 TEST_CASE("json: unset bundle fields are omitted on write and null on read")
 {
     auto &registry = TypeRegistry::instance();
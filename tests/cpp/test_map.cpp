@@ -24,6 +24,7 @@
 #include <hgraph/types/operator_dispatch.h>
 #include <hgraph/types/static_node.h>
 #include <hgraph/types/subgraph_wiring.h>
+#include <hgraph/types/utils/storage_arena.h>
 #include <hgraph/types/wired_fn.h>
 
 #include "../../src/hgraph/runtime/mapped_key_source.h"
@@ -1404,6 +1405,16 @@ namespace
                                   Str{"out"});
         }
     };
+
+    struct MapParallelChildrenGraph
+    {
+        static constexpr auto name = "map_parallel_children_graph";
+        static void           compose(Wiring &w)
+        {
+            auto source = wire<stdlib::replay_impl, TSD<Str, TS<Int>>>(w, Str{"source"});
+            wire<stdlib::dense_record_impl>(w, wire<stdlib::map_>(w, fn<AddOneG>(), source), Str{"out"});
+        }
+    };
 }  // namespace
 
 TEST_CASE("map_: keyword arguments resolve onto the function's named ports")
@@ -1441,6 +1452,65 @@ TEST_CASE("map_: kwargs select the kernel from function parameter order")
                  values<Value>(dict_delta<Str, TS<Int>>({{"x"s, 13}})));
 }
 
+TEST_CASE("map_: parallel evaluation publishes the sequential output")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    const auto run = [](std::size_t threads) {
+        GraphBuilder gb = build_graph<MapParallelChildrenGraph>();
+        set_replay_deltas(
+            gb.global_state(), "source",
+            values<Value>(dict_delta<Str, TS<Int>>(
+                              {{"a"s, 1}, {"b"s, 2}, {"c"s, 3}, {"d"s, 4}, {"e"s, 5}, {"f"s, 6}}),
+                          dict_delta<Str, TS<Int>>({{"a"s, 10}, {"c"s, 30}, {"f"s, 60}}),
+                          dict_delta<Str, TS<Int>>({{"b"s, 20}}, {"d"s, "e"s})));
+
+        GraphExecutorBuilder eb;
+        eb.graph_builder(std::move(gb))
+            .start_time(MIN_ST)
+            .end_time(MIN_ST + TimeDelta{10})
+            .parallel_evaluation(threads);
+        GraphExecutorValue ex = eb.make_executor();
+        ex.view().run();
+        return get_recorded_deltas(ex.view().graph().global_state(), "out");
+    };
+
+    const auto expected =
+        values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 2}, {"b"s, 3}, {"c"s, 4}, {"d"s, 5}, {"e"s, 6}, {"f"s, 7}}),
+                      dict_delta<Str, TS<Int>>({{"a"s, 11}, {"c"s, 31}, {"f"s, 61}}),
+                      dict_delta<Str, TS<Int>>({{"b"s, 21}}, {"d"s, "e"s}));
+    CHECK_OUTPUT(run(1), expected);
+    CHECK_OUTPUT(run(4), expected);
+}
+
+TEST_CASE("map_: children live in the root graph's storage arena")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    GraphBuilder gb = build_graph<MapParallelChildrenGraph>();
+    gb.storage_arena(StorageArena::min_chunk_bytes);
+    set_replay_deltas(gb.global_state(), "source",
+                      values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 1}, {"b"s, 2}, {"c"s, 3}}),
+                                    dict_delta<Str, TS<Int>>({{"d"s, 4}}, {"a"s, "b"s})));
+
+    GraphExecutorBuilder eb;
+    eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+    GraphExecutorValue ex = eb.make_executor();
+    const auto &arena_ops = ex.view().graph().storage_allocator();
+    REQUIRE(&arena_ops != &MemoryUtils::allocator());
+    REQUIRE(arena_ops.context != nullptr);
+    ex.view().run();
+
+    const auto &arena = *static_cast<const StorageArena *>(arena_ops.context);
+    CHECK(arena.chunk_count() >= 1);
+    CHECK(arena.metrics().reserved_bytes >= arena.metrics().live_bytes);
+    CHECK_OUTPUT(get_recorded_deltas(ex.view().graph().global_state(), "out"),
+                 values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 2}, {"b"s, 3}, {"c"s, 4}}),
+                               dict_delta<Str, TS<Int>>({{"d"s, 5}}, {"a"s, "b"s})));
+}
+
 // ---------------------------------------------------------------------------
 // __keys__: an explicit TSS[K] key set drives the child lifecycle (Python's
 // map_(func, ..., __keys__=tss)) — the multiplexed dicts only feed elements.
@@ -1561,6 +1631,47 @@ TEST_CASE("map_: removed children stop before their source slot erases")
     CHECK(NestedLifecycleCounters::snapshot() == NestedLifecycleSnapshot{2, 0, 2, 2, 2});
 }
 
+TEST_CASE("map_: a recycled child graph restarts with fresh state")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    Wiring w;
+    w.set_trait(std::string{RECYCLED_CHILD_GRAPHS_TRAIT}, Value{Int{2}});
+    auto source = wire<stdlib::replay_impl, TSD<Str, TS<Int>>>(w, Str{"source"});
+    wire<stdlib::dense_record_impl>(w, wire<stdlib::map_>(w, fn<CounterNode>(), source), Str{"out"});
+
+    GraphBuilder gb = std::move(w).finish();
+    set_replay_deltas(gb.global_state(), "source",
+                      values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 1}}),
+                                    dict_delta<Str, TS<Int>>({{"a"s, 2}}),
+                                    dict_delta<Str, TS<Int>>({}, {"a"s}),
+                                    dict_delta<Str, TS<Int>>({{"b"s, 3}}),
+                                    dict_delta<Str, TS<Int>>({{"b"s, 4}})));
+
+    GraphExecutorBuilder eb;
+    eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+    GraphExecutorValue ex = eb.make_executor();
+    ex.view().run();
+
+    // "b" lands on the slot "a" released and reuses its graph, rebuilt.
+    CHECK_OUTPUT(get_recorded_deltas(ex.view().graph().global_state(), "out"),
+                 values<Value>(dict_delta<Str, TS<Int>>({{"a"s, 1}}),
+                               dict_delta<Str, TS<Int>>({{"a"s, 2}}),
+                               dict_delta<Str, TS<Int>>({}, {"a"s}),
+                               dict_delta<Str, TS<Int>>({{"b"s, 1}}),
+                               dict_delta<Str, TS<Int>>({{"b"s, 2}})));
+    auto graph = ex.view().graph();
+    std::optional<MapNodeView> map;
+    for (std::size_t i = 0; i < graph.node_count(); ++i)
+    {
+        if (graph.node_at(i).is<MapNodeView>()) { map = graph.node_at(i).as<MapNodeView>(); }
+    }
+    REQUIRE(map.has_value());
+    CHECK(map->recycled_child_graph_count() == 1);
+    CHECK(map->parked_child_graph_count() == 0);
+}
+
 TEST_CASE("map_: __keys__ creates children for keys missing from the multiplexed dict")
 {
     using namespace hgraph;
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <hgraph/types/utils/memory_utils.h>
+#include <hgraph/types/utils/storage_arena.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -157,13 +158,13 @@ namespace
         }
     };
 
-    void *tracked_allocate(MemoryUtils::StorageLayout layout) {
+    void *tracked_allocate(MemoryUtils::StorageLayout layout, void *) {
         ++AllocationProbe::allocations;
         AllocationProbe::last_layout = layout;
         return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
     }
 
-    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept {
+    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout, void *) noexcept {
         ++AllocationProbe::deallocations;
         AllocationProbe::last_layout = layout;
         ::operator delete(memory, std::align_val_t{layout.alignment});
@@ -285,6 +286,84 @@ TEST_CASE("memory utils separates allocation through allocator ops", "[memory ut
     REQUIRE(TrackedValue::destroyed == 1);
 }
 
+TEST_CASE("memory utils passes the allocator context to both hooks", "[memory utils]") {
+    struct CountingHeap
+    {
+        int allocations{0};
+        int deallocations{0};
+    } heap;
+
+    const MemoryUtils::AllocatorOps allocator{
+        .allocate =
+            [](MemoryUtils::StorageLayout layout, void *context) -> void * {
+                ++static_cast<CountingHeap *>(context)->allocations;
+                return ::operator new(layout.size, std::align_val_t{layout.alignment});
+            },
+        .deallocate =
+            [](void *memory, MemoryUtils::StorageLayout layout, void *context) noexcept {
+                ++static_cast<CountingHeap *>(context)->deallocations;
+                ::operator delete(memory, std::align_val_t{layout.alignment});
+            },
+        .context = &heap,
+    };
+
+    TrackedValue::reset();
+    {
+        MemoryUtils::ErasedOwner<> handle(MemoryUtils::plan_for<TrackedValue>(), allocator);
+        auto copied = handle;
+        REQUIRE(copied.allocator() == &allocator);
+        REQUIRE(heap.allocations == 2);
+    }
+    REQUIRE(heap.deallocations == 2);
+    REQUIRE(TrackedValue::destroyed == 2);
+}
+
+TEST_CASE("storage arena reuses freed blocks by size class", "[memory utils]") {
+    hgraph::StorageArena arena{hgraph::StorageArena::min_chunk_bytes};
+    const auto          &allocator = arena.allocator();
+    const MemoryUtils::StorageLayout small{.size = 40, .alignment = 8};
+
+    void *first  = allocator.allocate_storage(small);
+    void *second = allocator.allocate_storage(small);
+    REQUIRE(arena.chunk_count() == 1);
+    REQUIRE(static_cast<std::byte *>(second) - static_cast<std::byte *>(first) == 48);
+    REQUIRE(arena.metrics().live_bytes == 96);
+
+    allocator.deallocate_storage(first, small);
+    REQUIRE(arena.metrics().live_bytes == 48);
+    REQUIRE(allocator.allocate_storage(small) == first);
+
+    const MemoryUtils::StorageLayout aligned{.size = 8, .alignment = 64};
+    void *wide = allocator.allocate_storage(aligned);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(wide) % 64 == 0);
+
+    allocator.deallocate_storage(first, small);
+    allocator.deallocate_storage(second, small);
+    allocator.deallocate_storage(wide, aligned);
+    REQUIRE(arena.metrics().live_bytes == 0);
+    REQUIRE(arena.metrics().reserved_bytes == hgraph::StorageArena::min_chunk_bytes);
+}
+
+TEST_CASE("storage arena grows by chunks and forwards large blocks", "[memory utils]") {
+    hgraph::StorageArena arena{hgraph::StorageArena::min_chunk_bytes};
+    const auto          &allocator = arena.allocator();
+    const MemoryUtils::StorageLayout block{.size = arena.large_block_bytes(), .alignment = 16};
+
+    std::vector<void *> blocks;
+    for (int index = 0; index < 5; ++index) { blocks.push_back(allocator.allocate_storage(block)); }
+    REQUIRE(arena.chunk_count() == 2);
+
+    const MemoryUtils::StorageLayout large{.size = arena.chunk_bytes(), .alignment = 16};
+    void *outside = allocator.allocate_storage(large);
+    REQUIRE(arena.chunk_count() == 2);
+    REQUIRE(arena.metrics().reserved_bytes == 3 * arena.chunk_bytes());
+    allocator.deallocate_storage(outside, large);
+    REQUIRE(arena.metrics().reserved_bytes == 2 * arena.chunk_bytes());
+
+    for (void *memory : blocks) { allocator.deallocate_storage(memory, block); }
+    REQUIRE(arena.metrics().live_bytes == 0);
+}
+
 TEST_CASE("memory utils heap-backed owners deep-copy on copy and transfer on move", "[memory utils]") {
     TrackedValue::reset();
 
@@ -14,7 +14,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
+#include <map>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace
 {
@@ -212,6 +217,94 @@ TEST_CASE("node scheduler: multiple untagged events accumulate and advance in ti
     CHECK(at_five.next_scheduled_time() == base + TimeDelta{6});
 }
 
+TEST_CASE("node scheduler: untagged events order before tags at the same time, tags by name")
+{
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+
+    const DateTime at = base + TimeDelta{4};
+    sched.schedule(at, "b");
+    sched.schedule(at, "a");
+    sched.schedule(at);
+    sched.schedule(at);  // a duplicate untagged time collapses into one event
+    CHECK(state.size() == 3);
+
+    sched.un_schedule();  // the untagged event goes first
+    CHECK(sched.has_tag("a"));
+    CHECK(sched.has_tag("b"));
+    sched.un_schedule();
+    CHECK_FALSE(sched.has_tag("a"));
+    CHECK(sched.has_tag("b"));
+}
+
+TEST_CASE("node scheduler: tag churn matches an ordered (time, tag) set")
+{
+    // Reference model: the ordered event set and tag index the flat state
+    // replaces. Tags are re-armed, cancelled and recycled under new names.
+    NodeSchedulerState state;
+    NodeScheduler      sched{state, nullptr, 0, base};
+
+    std::set<std::pair<DateTime, std::string>> events;
+    std::map<std::string, DateTime>            tags;
+
+    std::uint32_t seed = 12345;
+    const auto    next = [&seed](std::uint32_t bound) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % bound;
+    };
+
+    for (int step = 0; step < 4000; ++step)
+    {
+        const std::string tag = "t" + std::to_string(next(step < 2000 ? 8 : 24));
+        const DateTime    when = base + TimeDelta{1 + static_cast<int>(next(16))};
+        switch (next(5))
+        {
+            case 0:
+            case 1:
+                sched.schedule(when, tag);
+                if (const auto it = tags.find(tag); it != tags.end()) { events.erase({it->second, tag}); }
+                tags[tag] = when;
+                events.insert({when, tag});
+                break;
+            case 2:
+                sched.schedule(when);
+                events.insert({when, std::string{}});
+                break;
+            case 3:
+                sched.un_schedule(tag);
+                if (const auto it = tags.find(tag); it != tags.end())
+                {
+                    events.erase({it->second, tag});
+                    tags.erase(it);
+                }
+                break;
+            default:
+                sched.un_schedule();
+                if (!events.empty())
+                {
+                    tags.erase(events.begin()->second);
+                    events.erase(events.begin());
+                }
+                break;
+        }
+
+        REQUIRE(state.size() == events.size());
+        REQUIRE(sched.next_scheduled_time() == (events.empty() ? MIN_DT : events.begin()->first));
+        REQUIRE(sched.tag_time(tag) == (tags.contains(tag) ? tags.at(tag) : MIN_DT));
+    }
+
+    // Draining in time order visits the same events as the reference.
+    while (!events.empty())
+    {
+        REQUIRE(sched.next_scheduled_time() == events.begin()->first);
+        if (const std::string &tag = events.begin()->second; !tag.empty()) { REQUIRE(sched.has_tag(tag)); }
+        sched.un_schedule();
+        tags.erase(events.begin()->second);
+        events.erase(events.begin());
+    }
+    CHECK_FALSE(sched.is_scheduled());
+}
+
 TEST_CASE("node scheduler: wall-clock alarms require realtime support")
 {
     NodeSchedulerState state;
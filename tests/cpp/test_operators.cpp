@@ -529,6 +529,57 @@ TEST_CASE("operators: a requires_ predicate that fails vetoes the specific overl
     CHECK(impl->rank > 0);  // the gate rejected the specific overload; the generic was selected
 }
 
+TEST_CASE("operators: a repeated call signature is served from the resolution cache")
+{
+    (void)TypeRegistry::instance().register_scalar<Int>("int");
+    (void)TypeRegistry::instance().register_scalar<Str>("str");
+    register_overload<add_, add_ints>();
+    register_overload<add_, add_generic>();
+    OperatorRegistry &registry = OperatorRegistry::instance();
+
+    std::array<WiringArg, 2> ints{ts_arg(ts_type<TS<Int>>()), ts_arg(ts_type<TS<Int>>())};
+    const auto before = registry.resolution_cache_stats();
+    const auto first  = registry.resolve("add", std::span<const WiringArg>{ints});
+    const auto cold   = registry.resolution_cache_stats();
+    CHECK(cold.misses == before.misses + 1);
+    CHECK(cold.entries == 1);
+
+    const auto repeated = registry.resolve("add", std::span<const WiringArg>{ints});
+    const auto warm     = registry.resolution_cache_stats();
+    CHECK(repeated.impl == first.impl);
+    CHECK(repeated.args.size() == first.args.size());
+    CHECK(warm.hits == cold.hits + 1);
+    CHECK(warm.misses == cold.misses);
+
+    // A different signature is a separate entry and selects on its own.
+    std::array<WiringArg, 2> strs{ts_arg(ts_type<TS<Str>>()), ts_arg(ts_type<TS<Str>>())};
+    const auto generic = registry.resolve("add", std::span<const WiringArg>{strs});
+    CHECK(generic.impl != first.impl);
+    CHECK(registry.resolution_cache_stats().entries == 2);
+
+    // Registration changes the candidate set, so it forgets every selection.
+    register_overload<sink_, sink_any>();
+    CHECK(registry.resolution_cache_stats().entries == 0);
+    CHECK(registry.resolve("add", std::span<const WiringArg>{ints}).impl == first.impl);
+}
+
+TEST_CASE("operators: a selection shaped by a requires_ predicate is not cached")
+{
+    (void)TypeRegistry::instance().register_scalar<Int>("int");
+    register_overload<gated_, gated_int_off>();
+    register_overload<gated_, gated_passthrough>();
+    OperatorRegistry &registry = OperatorRegistry::instance();
+
+    std::array<WiringArg, 1> args{ts_arg(ts_type<TS<Int>>())};
+    const auto before = registry.resolution_cache_stats();
+    CHECK(registry.resolve("gated", std::span<const WiringArg>{args}).impl->rank > 0);
+    CHECK(registry.resolve("gated", std::span<const WiringArg>{args}).impl->rank > 0);
+    const auto after = registry.resolution_cache_stats();
+    CHECK(after.entries == 0);
+    CHECK(after.hits == before.hits);
+    CHECK(after.misses == before.misses + 2);
+}
+
 TEST_CASE("operators: the TypePattern interpreter matches and ranks a nested TSL")
 {
     (void)TypeRegistry::instance().register_scalar<Int>("int");
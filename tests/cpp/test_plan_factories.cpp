@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <hgraph/lib/std/value_util.h>
+#include <hgraph/lib/std/window_kernels.h>
 #include <hgraph/types/metadata/ts_data_plan_factory.h>
 #include <hgraph/types/metadata/ts_data_plan_factory_detail.h>
 #include <hgraph/types/metadata/type_registry.h>
@@ -11,13 +12,17 @@
 #include <hgraph/types/value/value.h>
 #include <hgraph/types/value/value_builder.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <barrier>
+#include <cmath>
 #include <compare>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -1320,6 +1325,204 @@ TEST_CASE("TSDataPlanFactory: tick TSW stores a fixed cyclic current window")
     REQUIRE(move_window.back().checked_as<MoveAssignableOnlyScalar>().value == 1);
 }
 
+TEST_CASE("TSDataPlanFactory: tick TSW exposes its ring as two contiguous runs")
+{
+    using namespace hgraph;
+    namespace kernels = stdlib::window_kernels;
+    auto       &registry   = TypeRegistry::instance();
+    const auto *float_meta = registry.register_scalar<Float>("float");
+    const auto  type       = TSDataPlanFactory::instance().data_type_for(registry.tsw(float_meta, 7, 7));
+    REQUIRE(type);
+
+    TSData data{type};
+    auto   view   = data.view();
+    auto   window = view.as_window();
+    REQUIRE(window.segments().sizes[0] == 0);
+    REQUIRE(window.segments().sizes[1] == 0);
+
+    DateTime time = MIN_ST;
+    for (int index = 1; index <= 10; ++index)
+    {
+        time += TimeDelta{1};
+        Value value{Float{index * 0.5}};
+        auto  mutation = window.begin_mutation(time);
+        mutation.push(value.view());
+    }
+
+    // Ten pushes into seven slots leave the oldest element at slot three.
+    const TSWSegments runs = window.segments();
+    REQUIRE(runs.value_stride == sizeof(Float));
+    REQUIRE(runs.sizes[0] == 4);
+    REQUIRE(runs.sizes[1] == 3);
+
+    const auto values = window.value_spans<Float>();
+    const auto times  = window.time_spans();
+    std::size_t logical = 0;
+    for (std::size_t run = 0; run < 2; ++run)
+    {
+        REQUIRE(values[run].size() == times[run].size());
+        for (std::size_t index = 0; index < values[run].size(); ++index, ++logical)
+        {
+            CHECK(values[run][index] == window.at(logical).checked_as<Float>());
+            CHECK(times[run][index] == window.time_at(logical));
+        }
+    }
+    CHECK(logical == 7);
+    REQUIRE_THROWS_AS(window.value_spans<std::int32_t>(), std::logic_error);
+
+    // Observations 2.0 .. 5.0 in steps of 0.5.
+    CHECK(kernels::sum(values) == 24.5);
+    CHECK(kernels::mean(values) == 3.5);
+    CHECK(kernels::min(values) == 2.0);
+    CHECK(kernels::max(values) == 5.0);
+    CHECK(std::abs(kernels::variance(values) - 1.0) <= 1.0e-12);
+    CHECK(std::abs(kernels::variance(values, 1) - 7.0 / 6.0) <= 1.0e-12);
+    CHECK(std::isnan(kernels::variance(values, 7)));
+}
+
+TEST_CASE("window kernels match a left-to-right reduction across both runs")
+{
+    using namespace hgraph;
+    namespace kernels = stdlib::window_kernels;
+
+    std::vector<Float> floats;
+    std::vector<Int>   ints;
+    for (int index = 0; index < 37; ++index)
+    {
+        floats.push_back(static_cast<Float>((index * 7919) % 101) - 50.25);
+        ints.push_back(static_cast<Int>((index * 7919) % 101) - 50);
+    }
+    const kernels::Runs<Float> float_runs{std::span<const Float>{floats}.first(23),
+                                          std::span<const Float>{floats}.subspan(23)};
+    const kernels::Runs<Int>   int_runs{std::span<const Int>{ints}.first(5), std::span<const Int>{ints}.subspan(5)};
+
+    Float total{};
+    Int   int_total{};
+    for (const Float value : floats) { total += value; }
+    for (const Int value : ints) { int_total += value; }
+    const Float mean = total / static_cast<Float>(floats.size());
+    Float       squares{};
+    for (const Float value : floats) { squares += (value - mean) * (value - mean); }
+
+    CHECK(std::abs(kernels::sum(float_runs) - total) <= 1.0e-9);
+    CHECK(kernels::sum(int_runs) == int_total);
+    CHECK(kernels::min(float_runs) == *std::min_element(floats.begin(), floats.end()));
+    CHECK(kernels::max(float_runs) == *std::max_element(floats.begin(), floats.end()));
+    CHECK(kernels::min(int_runs) == *std::min_element(ints.begin(), ints.end()));
+    CHECK(kernels::max(int_runs) == *std::max_element(ints.begin(), ints.end()));
+    CHECK(std::abs(kernels::variance(float_runs) - squares / 37.0) <= 1.0e-9);
+    CHECK(std::isnan(kernels::mean(kernels::Runs<Float>{})));
+
+    // A NaN oldest element is the extremum; any later NaN never wins.
+    floats[30] = std::numeric_limits<Float>::quiet_NaN();
+    CHECK(kernels::max(float_runs) == std::max(*std::max_element(floats.begin(), floats.begin() + 30),
+                                               *std::max_element(floats.begin() + 31, floats.end())));
+    floats[0] = std::numeric_limits<Float>::quiet_NaN();
+    CHECK(std::isnan(kernels::min(float_runs)));
+}
+
+TEST_CASE("window kernels reduce a wrapped tick TSW longer than the unroll width")
+{
+    using namespace hgraph;
+    namespace kernels = stdlib::window_kernels;
+    auto       &registry   = TypeRegistry::instance();
+    const auto *float_meta = registry.register_scalar<Float>("float");
+    const auto  type       = TSDataPlanFactory::instance().data_type_for(registry.tsw(float_meta, 53, 53));
+    REQUIRE(type);
+
+    const Float nan = std::numeric_limits<Float>::quiet_NaN();
+    // Mixed magnitudes and signs, so a four-lane sum rounds differently
+    // from a left-to-right one.
+    std::vector<Float> observed;
+    for (int index = 0; index < 72; ++index)
+    {
+        const Float magnitude = index % 3 == 0 ? 1.0e8 : (index % 3 == 1 ? 1.0e-3 : 1.0);
+        observed.push_back((index % 2 == 0 ? 1.0 : -0.75) * magnitude * (1.0 + index / 7.0));
+    }
+
+    const auto fill = [&](TSData &data, std::size_t pushes) {
+        auto     view   = data.view();
+        auto     window = view.as_window();
+        DateTime time   = MIN_ST;
+        for (std::size_t index = 0; index < pushes; ++index)
+        {
+            time += TimeDelta{1};
+            Value value{observed[index]};
+            auto  mutation = window.begin_mutation(time);
+            mutation.push(value.view());
+        }
+    };
+    const auto spans_of = [](TSData &data) {
+        auto view = data.view();
+        return view.as_window().value_spans<Float>();
+    };
+    const auto in_window = [&](std::size_t pushes) {
+        return std::span<const Float>{observed}.subspan(pushes - 53, 53);
+    };
+
+    SECTION("sum, var and std match a long double reference")
+    {
+        // 71 pushes into 53 slots: runs of 35 and 18, each with a tail.
+        TSData data{type};
+        fill(data, 71);
+        const auto runs = spans_of(data);
+        REQUIRE(runs[0].size() == 35);
+        REQUIRE(runs[1].size() == 18);
+
+        long double total{};
+        long double magnitude{};
+        for (const Float value : in_window(71))
+        {
+            total += value;
+            magnitude += std::abs(static_cast<long double>(value));
+        }
+        const long double mean = total / 53.0L;
+        long double       squares{};
+        for (const Float value : in_window(71)) { squares += (value - mean) * (value - mean); }
+        const long double tolerance = 1.0e-14L * magnitude;
+
+        CHECK(std::abs(kernels::sum(runs) - total) <= tolerance);
+        CHECK(std::abs(kernels::mean(runs) - mean) <= tolerance / 53.0L);
+        const Float variance = kernels::variance(runs);
+        CHECK(std::abs(variance - squares / 53.0L) <= 1.0e-12L * (squares / 53.0L));
+        CHECK(std::abs(kernels::variance(runs, 1) - squares / 52.0L) <= 1.0e-12L * (squares / 52.0L));
+        CHECK(std::abs(std::sqrt(variance) - std::sqrt(squares / 53.0L)) <= 1.0e-12L * std::sqrt(squares / 53.0L));
+        CHECK(kernels::min(runs) == *std::min_element(in_window(71).begin(), in_window(71).end()));
+        CHECK(kernels::max(runs) == *std::max_element(in_window(71).begin(), in_window(71).end()));
+    }
+
+    SECTION("a later NaN never wins and a NaN oldest element is the extremum")
+    {
+        // NaNs inside the unrolled body of both runs and in the first run's
+        // tail; element 19 becomes the oldest after one more push.
+        for (const std::size_t index : {19U, 45U, 51U, 60U}) { observed[index] = nan; }
+
+        TSData later{type};
+        fill(later, 71);
+        const auto runs = spans_of(later);
+        REQUIRE(runs[0].size() == 35);
+        REQUIRE(std::isnan(runs[0][1]));
+        Float expected_min = in_window(71).front();
+        Float expected_max = expected_min;
+        for (const Float value : in_window(71))
+        {
+            if (value < expected_min) { expected_min = value; }
+            if (value > expected_max) { expected_max = value; }
+        }
+        CHECK(kernels::min(runs) == expected_min);
+        CHECK(kernels::max(runs) == expected_max);
+
+        TSData oldest{type};
+        fill(oldest, 72);
+        const auto wrapped = spans_of(oldest);
+        REQUIRE(wrapped[0].size() == 34);
+        REQUIRE(wrapped[1].size() == 19);
+        REQUIRE(std::isnan(wrapped[0].front()));
+        CHECK(std::isnan(kernels::min(wrapped)));
+        CHECK(std::isnan(kernels::max(wrapped)));
+    }
+}
+
 TEST_CASE("TSDataPlanFactory: duration TSW stores a timestamped queue current window")
 {
     using namespace hgraph;
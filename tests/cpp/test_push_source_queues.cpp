@@ -363,3 +363,127 @@ TEST_CASE("push-source sender supports concurrent producers")
         CHECK(observed[index] == Int{static_cast<std::int64_t>(index)});
     }
 }
+
+TEST_CASE("ring push-source queue delivers concurrent producers in per-producer order")
+{
+    using namespace hgraph;
+
+    constexpr std::size_t producer_count = 4;
+    constexpr std::size_t values_per_producer = 256;
+    constexpr std::size_t total_values = producer_count * values_per_producer;
+
+    const auto *ts_int = ts_type<TS<Int>>();
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_int);
+    std::vector<Int> observed;
+    std::vector<std::thread> producers;
+    bool refused_at_capacity{false};
+
+    PushSourceNodeExtension extension;
+    extension.on_start = [&](PushSourceSender sender, const NodeView &, DateTime)
+    {
+        // Capacity 8 is already a power of two: the ninth admission refuses.
+        std::size_t admitted = 0;
+        while (sender.try_send(Int{-1})) { ++admitted; }
+        refused_at_capacity = admitted == 8;
+        producers.reserve(producer_count);
+        for (std::size_t producer = 0; producer < producer_count; ++producer)
+        {
+            producers.emplace_back(
+                [sender, producer]
+                {
+                    for (std::size_t index = 0; index < values_per_producer; ++index)
+                    {
+                        sender.send_blocking(Int{static_cast<std::int64_t>(producer * values_per_producer + index)});
+                    }
+                });
+        }
+    };
+    extension.on_stop = [&](const NodeView &)
+    {
+        for (auto &producer : producers)
+        {
+            if (producer.joinable())
+            {
+                producer.join();
+            }
+        }
+    };
+
+    GraphBuilder builder;
+    builder.add_node(make_push_source_node_with_view(*ts_int, make_push_source_ring_queue_policy(*ts_int, 8),
+                                                     std::move(extension)));
+    builder.add_node(hgraph::testing::collecting_scalar_sink<Int>(*input_schema, *ts_int, observed, total_values + 8));
+    connect_source_to_sink(builder);
+
+    const DateTime start_time = hgraph::testing::wall_now();
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{2'000'000});
+    auto executor = executor_builder.make_executor();
+    executor.view().run();
+
+    CHECK(refused_at_capacity);
+    REQUIRE(observed.size() == total_values + 8);
+    CHECK(std::all_of(observed.begin(), observed.begin() + 8, [](Int value) { return value == Int{-1}; }));
+    std::vector<Int> last_seen(producer_count, Int{-1});
+    for (auto it = observed.begin() + 8; it != observed.end(); ++it)
+    {
+        const auto producer = static_cast<std::size_t>(*it) / values_per_producer;
+        REQUIRE(producer < producer_count);
+        CHECK(*it > last_seen[producer]);
+        last_seen[producer] = *it;
+    }
+}
+
+TEST_CASE("ring burst delivery emits every published value as one tuple")
+{
+    using namespace hgraph;
+
+    const auto *ts_tuple = ts_type<TS<HomogeneousTuple<Int>>>();
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_tuple);
+    std::vector<std::vector<Int>> observed;
+    bool refused{false};
+
+    PushSourceNodeExtension extension;
+    extension.on_start = [&](PushSourceSender sender, const NodeView &, DateTime)
+    {
+        sender.send_blocking(Int{1});
+        sender.send_blocking(Int{2});
+        sender.send_blocking(Int{3});
+        sender.send_blocking(Int{4});
+        refused = !sender.try_send(Int{5});
+        CHECK_THROWS_AS(sender.try_send(Str{"wrong schema"}), std::invalid_argument);
+    };
+
+    GraphBuilder builder;
+    builder.add_node(make_push_source_node_with_view(*ts_tuple, make_push_source_ring_burst_policy(*ts_tuple, 3),
+                                                     std::move(extension)));
+    builder.add_node(collecting_tuple_sink(*input_schema, *ts_tuple, observed, 1));
+    connect_source_to_sink(builder);
+
+    const DateTime start_time = hgraph::testing::wall_now();
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{1'000'000});
+    auto executor = executor_builder.make_executor();
+    executor.view().run();
+
+    CHECK(refused);
+    REQUIRE(observed.size() == 1);
+    const std::vector<Int> expected{Int{1}, Int{2}, Int{3}, Int{4}};
+    CHECK(observed[0] == expected);
+}
+
+TEST_CASE("ring push-source policies require a capacity")
+{
+    using namespace hgraph;
+
+    CHECK_THROWS_AS(make_push_source_ring_queue_policy(*ts_type<TS<Int>>(), 0), std::invalid_argument);
+    CHECK_THROWS_AS(make_push_source_ring_burst_policy(*ts_type<TS<HomogeneousTuple<Int>>>(), 0),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(make_push_source_ring_burst_policy(*ts_type<TS<Int>>(), 4), std::invalid_argument);
+}
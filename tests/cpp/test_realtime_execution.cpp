@@ -25,6 +25,11 @@
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace
 {
     using namespace hgraph;
@@ -1083,6 +1088,151 @@ TEST_CASE("real-time push source drains multiple queued values across cycles")
     CHECK(observed_values[1] == Int{2});
 }
 
+TEST_CASE("real-time wait strategies deliver push wakes and scheduled targets")
+{
+    using namespace hgraph;
+
+    auto       &registry     = TypeRegistry::instance();
+    const auto *int_meta     = registry.register_scalar<Int>("int");
+    const auto *ts_int       = registry.ts(int_meta);
+    const auto *input_schema = hgraph::testing::single_input_schema(*ts_int);
+
+    GraphExecutorBuilder defaults;
+    CHECK(defaults.wait_strategy() == RealTimeWaitStrategy::Block);
+    CHECK(defaults.spin_budget() == TimeDelta{50});
+    CHECK(defaults.evaluation_cpus().empty());
+    defaults.wait_strategy(RealTimeWaitStrategy::SpinThenBlock, TimeDelta{-1});
+    CHECK(defaults.spin_budget() == TimeDelta{50});
+
+    for (const RealTimeWaitStrategy strategy :
+         {RealTimeWaitStrategy::Block, RealTimeWaitStrategy::Spin, RealTimeWaitStrategy::SpinThenYield,
+          RealTimeWaitStrategy::SpinThenBlock})
+    {
+        INFO("strategy " << static_cast<int>(strategy));
+
+        std::vector<Int> observed_values;
+        PushSourceSender sender;
+        DateTime         scheduled_evaluation_time{MIN_DT};
+
+        GraphBuilder graph_builder;
+        graph_builder.add_node(hgraph::testing::capturing_push_source(*ts_int, sender));
+        graph_builder.add_node(hgraph::testing::collecting_scalar_sink<Int>(
+            *input_schema, *ts_int, observed_values, 3));
+        graph_builder.add_edge(GraphEdge{
+            .source_node = make_graph_edge_source(0),
+            .source_path = {},
+            .target_node = 1,
+            .target_path = {0},
+        });
+
+        // A wall-clock target between the pushes exercises the timed side of
+        // each wait as well as the wake side.
+        const TimeDelta     scheduled_delay{10'000};
+        NodeTypeMetaData    scheduled_schema;
+        scheduled_schema.display_name  = "wait_strategy_scheduled_source";
+        scheduled_schema.output_schema = ts_int;
+        scheduled_schema.node_kind     = NodeKind::PullSource;
+        NodeCallbacks scheduled_callbacks;
+        scheduled_callbacks.start = [scheduled_delay](const NodeView &view, DateTime start_time) {
+            view.graph_value()->schedule_node(view.node_index(), start_time + scheduled_delay);
+        };
+        scheduled_callbacks.evaluate = [&](const NodeView &view, DateTime evaluation_time) {
+            scheduled_evaluation_time = evaluation_time;
+            testing::set_output_value(view, evaluation_time, Int{1});
+        };
+        graph_builder.add_node(NodeBuilder::native(std::move(scheduled_schema), std::move(scheduled_callbacks)));
+
+        const DateTime start_time = hgraph::testing::wall_now();
+
+        GraphExecutorBuilder executor_builder;
+        executor_builder.graph_builder(std::move(graph_builder))
+            .mode(GraphExecutorMode::RealTime)
+            .start_time(start_time)
+            .end_time(start_time + TimeDelta{2'000'000})
+            .wait_strategy(strategy, TimeDelta{20});
+
+        GraphExecutorValue executor = executor_builder.make_executor();
+        auto               view     = executor.view();
+
+        hgraph::testing::AsyncGraphExecutorRun runner{view};
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        REQUIRE(sender.valid());
+        sender.send_blocking(Int{1});
+        sender.send_blocking(Int{2});
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        sender.send_blocking(Int{3});
+        runner.join();
+
+        REQUIRE(observed_values.size() == 3);
+        CHECK(observed_values[0] == Int{1});
+        CHECK(observed_values[1] == Int{2});
+        CHECK(observed_values[2] == Int{3});
+        CHECK(scheduled_evaluation_time == start_time + scheduled_delay);
+        CHECK(hgraph::testing::wall_now() < start_time + TimeDelta{1'000'000});
+    }
+}
+
+TEST_CASE("real-time executor pins its run thread to evaluation_cpus for the run")
+{
+    using namespace hgraph;
+
+    GraphExecutorBuilder unaddressable;
+    unaddressable.graph_builder(GraphBuilder{})
+        .mode(GraphExecutorMode::RealTime)
+        .end_time(hgraph::testing::wall_now() + TimeDelta{10'000})
+        .evaluation_cpus({std::size_t{1} << 20});
+    GraphExecutorValue rejected = unaddressable.make_executor();
+    CHECK_THROWS_AS(rejected.view().run(), std::invalid_argument);
+
+#if defined(__linux__)
+    const auto allowed_cpus = [] {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        REQUIRE(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+        std::vector<std::size_t> cpus;
+        for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &set)) { cpus.push_back(cpu); }
+        }
+        return cpus;
+    };
+    const std::vector<std::size_t> before = allowed_cpus();
+    REQUIRE_FALSE(before.empty());
+
+    auto       &registry = TypeRegistry::instance();
+    const auto *ts_int   = registry.ts(registry.register_scalar<Int>("int"));
+
+    std::vector<std::size_t> during;
+    NodeTypeMetaData         schema;
+    schema.display_name      = "record_evaluation_cpus";
+    schema.output_schema     = ts_int;
+    schema.node_kind         = NodeKind::PullSource;
+    schema.schedule_on_start = true;
+    NodeCallbacks callbacks;
+    callbacks.evaluate = [&](const NodeView &view, DateTime evaluation_time) {
+        during = allowed_cpus();
+        testing::set_output_value(view, evaluation_time, Int{1});
+    };
+    GraphBuilder graph_builder;
+    graph_builder.add_node(NodeBuilder::native(std::move(schema), std::move(callbacks)));
+
+    const DateTime       start_time = hgraph::testing::wall_now();
+    GraphExecutorBuilder executor_builder;
+    executor_builder.graph_builder(std::move(graph_builder))
+        .mode(GraphExecutorMode::RealTime)
+        .start_time(start_time)
+        .end_time(start_time + TimeDelta{10'000})
+        .evaluation_cpus({before.back()});
+
+    GraphExecutorValue executor = executor_builder.make_executor();
+    executor.view().run();
+
+    CHECK(during == std::vector<std::size_t>{before.back()});
+    CHECK(allowed_cpus() == before);
+#endif
+}
+
 TEST_CASE("real-time push source applies queued collection deltas in order")
 {
     using namespace hgraph;
@@ -126,6 +126,20 @@ TEST_CASE("runtime registry snapshot reports retained type cardinalities")
     CHECK(after_executor.type_records > after_graph.type_records);
 }
 
+TEST_CASE("runtime registry snapshot reports the operator resolution cache") {
+  using namespace hgraph;
+
+  stdlib::register_standard_operators();
+  static_cast<void>(build_graph<RegistryMapGraph>());
+
+  const OperatorResolutionCacheStats stats =
+      OperatorRegistry::instance().resolution_cache_stats();
+  const RuntimeRegistrySnapshot snapshot = runtime_registry_snapshot();
+  CHECK(snapshot.operator_resolution_cache_entries == stats.entries);
+  CHECK(snapshot.operator_resolution_cache_hits == stats.hits);
+  CHECK(snapshot.operator_resolution_cache_misses == stats.misses);
+}
+
 TEST_CASE("static node runtime types are reused for equivalent descriptors") {
   using namespace hgraph;
 
@@ -609,3 +609,79 @@ TEST_CASE("simulation: immediate bursts below the guard limit do not trip it")
     CHECK_NOTHROW(executor.view().run());
     CHECK(eval_count == 60);
 }
+
+TEST_CASE("simulation: a large graph evaluates only the scheduled nodes in rank order")
+{
+    using namespace hgraph;
+
+    auto       &registry     = TypeRegistry::instance();
+    const auto *int_meta     = registry.register_scalar<std::int32_t>("int32");
+    const auto *ts_int       = registry.ts(int_meta);
+    const auto *input_schema = registry.tsb("NotifyInput", {{"value", ts_int}});
+
+    // Enough independent source -> add_one pairs to select the sparse
+    // ready-set scheduler rather than the dense per-node scan.
+    constexpr std::size_t pairs = 96;
+    std::vector<std::int32_t> source_evals(pairs, 0);
+    std::vector<std::int32_t> add_one_evals(pairs, 0);
+
+    GraphBuilder builder;
+    for (std::size_t index = 0; index < pairs; ++index)
+    {
+        builder.add_node(counting_source(ts_int, static_cast<int>(index), &source_evals[index]));
+    }
+    for (std::size_t index = 0; index < pairs; ++index)
+    {
+        builder.add_node(counting_add_one(input_schema, ts_int, &add_one_evals[index]))
+            .add_edge(GraphEdge{.source_node = index, .source_path = {}, .target_node = pairs + index, .target_path = {0}});
+    }
+
+    testing::MockRootGraph graph{builder};
+    auto       view = graph.graph();
+
+    const auto t1 = MIN_ST;
+    const auto t2 = t1 + TimeDelta{1};
+    const auto t3 = t2 + TimeDelta{1};
+    const auto t4 = t3 + TimeDelta{1};
+
+    view.start(t1);
+    view.evaluate(t1);
+    for (std::size_t index = 0; index < pairs; ++index)
+    {
+        CHECK(source_evals[index] == 1);
+        CHECK(add_one_evals[index] == 1);
+    }
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    // Reschedule a few sources out of order; a later schedule for the same
+    // node must not supersede an earlier pending one.
+    view.schedule_node(70, t3);
+    view.schedule_node(5, t2);
+    view.schedule_node(40, t2);
+    view.schedule_node(5, t3);
+    CHECK(view.next_scheduled_time() == t2);
+
+    view.evaluate(t2);
+    CHECK(source_evals[5] == 2);
+    CHECK(source_evals[40] == 2);
+    CHECK(source_evals[70] == 1);
+    CHECK(add_one_evals[5] == 2);
+    CHECK(add_one_evals[40] == 2);
+    CHECK(add_one_evals[70] == 1);
+    CHECK(view.node_at(pairs + 40).output(t2).value().checked_as<std::int32_t>() == 41);
+    CHECK(view.next_scheduled_time() == t3);
+
+    view.evaluate(t3);
+    CHECK(source_evals[5] == 2);
+    CHECK(source_evals[70] == 2);
+    CHECK(add_one_evals[70] == 2);
+    CHECK(view.next_scheduled_time() == MAX_DT);
+
+    // Nothing due: the cycle touches no node.
+    view.evaluate(t4);
+    std::int32_t total = 0;
+    for (std::size_t index = 0; index < pairs; ++index) { total += source_evals[index] + add_one_evals[index]; }
+    CHECK(total == static_cast<std::int32_t>(2 * pairs + 6));
+
+    view.stop();
+}
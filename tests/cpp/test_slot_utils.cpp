@@ -97,13 +97,13 @@ namespace
         }
     };
 
-    void *tracked_allocate(MemoryUtils::StorageLayout layout) {
+    void *tracked_allocate(MemoryUtils::StorageLayout layout, void *) {
         ++AllocationProbe::allocations;
         AllocationProbe::allocated_layouts.push_back(layout);
         return ::operator new(layout.size == 0 ? 1 : layout.size, std::align_val_t{layout.alignment});
     }
 
-    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout) noexcept {
+    void tracked_deallocate(void *memory, MemoryUtils::StorageLayout layout, void *) noexcept {
         ++AllocationProbe::deallocations;
         AllocationProbe::deallocated_layouts.push_back(layout);
         ::operator delete(memory, std::align_val_t{layout.alignment});
@@ -998,6 +998,36 @@ TEST_CASE("key slot store rolls back a new key when indexing throws", "[v2 slot
     REQUIRE(store.contains(key));
 }
 
+TEST_CASE("key slot store hashes primitive keys inline and caches string hashes", "[v2 slot utils][hash]")
+{
+    using namespace hgraph;
+
+    CHECK(KeySlotStore(MemoryUtils::plan_for<Int>(), key_slot_store_ops_for<Int>()).key_kind() == KeySlotKeyKind::Int);
+    CHECK(KeySlotStore(MemoryUtils::plan_for<Bytes>(), key_slot_store_ops_for<Bytes>()).key_kind() ==
+          KeySlotKeyKind::Bytes);
+    CHECK(KeySlotStore(MemoryUtils::plan_for<std::int32_t>(), key_slot_store_ops_for<std::int32_t>()).key_kind() ==
+          KeySlotKeyKind::Erased);
+
+    KeySlotStore store(MemoryUtils::plan_for<Str>(), key_slot_store_ops_for<Str>());
+    REQUIRE(store.key_kind() == KeySlotKeyKind::Str);
+    constexpr int key_count = 512;
+    const auto key = [](int index) { return Str{"key." + std::to_string(index)}; };
+    for (int index = 0; index < key_count; ++index) { REQUIRE(store.insert(key(index)).inserted); }
+    for (int index = 0; index < key_count; index += 2) { REQUIRE(store.remove(key(index))); }
+    store.erase_pending();
+    for (int index = 0; index < key_count / 2; ++index) { REQUIRE(store.insert(Str{"new." + std::to_string(index)}).inserted); }
+
+    KeySlotStore moved{std::move(store)};
+    CHECK(moved.size() == static_cast<std::size_t>(key_count));
+    CHECK(moved.slot_capacity() == static_cast<std::size_t>(key_count));
+    for (int index = 0; index < key_count; ++index)
+    {
+        CHECK(moved.contains(key(index)) == (index % 2 == 1));
+    }
+    for (int index = 0; index < key_count / 2; ++index) { CHECK(moved.contains(Str{"new." + std::to_string(index)})); }
+    CHECK(moved.dynamic_storage_metrics().reserved_bytes >= key_count * sizeof(std::size_t));
+}
+
 TEST_CASE("key slot store resurrects removed keys before erase and reuses slots after explicit erase", "[v2 slot utils]") {
     KeySlotStore store(MemoryUtils::plan_for<std::int32_t>(), key_slot_store_ops_for<std::int32_t>());
 
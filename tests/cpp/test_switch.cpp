@@ -30,6 +30,7 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <span>
 #include <stdexcept>
 #include <vector>
@@ -434,16 +435,16 @@ namespace
         }
     };
 
-    struct SwitchStorageRecorderTag
+    struct SwitchInspectorTag
     {
     };
 
-    void wire_switch_storage_recorder(Wiring &w,
-                                      const WiringPortRef &switch_output,
-                                      const WiringPortRef &key,
-                                      std::vector<std::size_t> &stored_counts,
-                                      std::vector<std::uintptr_t> &active_addresses,
-                                      std::vector<NestedLifecycleSnapshot> *lifecycle = nullptr)
+    /** Calls ``inspect`` with the graph's switch node whenever the switch
+        output or its key ticks. */
+    void wire_switch_inspector(Wiring &w,
+                               const WiringPortRef &switch_output,
+                               const WiringPortRef &key,
+                               std::function<void(const NodeView &, SwitchNodeView)> inspect)
     {
         const auto *input_schema = TypeRegistry::instance().un_named_tsb(
             {{"switch", switch_output.schema}, {"key", key.schema}});
@@ -453,41 +454,76 @@ namespace
         };
 
         NodeTypeMetaData meta;
-        meta.display_name = "switch_storage_recorder";
+        meta.display_name = "switch_inspector";
         meta.input_schema = input_schema;
         meta.node_kind    = NodeKind::Sink;
         meta.valid_inputs = std::vector<std::size_t>{};
 
         NodeCallbacks callbacks;
-        callbacks.evaluate = [&stored_counts, &active_addresses, lifecycle](const NodeView &view, DateTime) {
+        callbacks.evaluate = [inspect = std::move(inspect)](const NodeView &view, DateTime) {
             auto graph = view.graph();
             for (std::size_t i = 0; i < graph.node_count(); ++i)
             {
                 auto node = graph.node_at(i);
                 if (node.is<SwitchNodeView>())
                 {
-                    auto switch_view = node.as<SwitchNodeView>();
-                    stored_counts.push_back(switch_view.stored_graph_count());
-                    active_addresses.push_back(reinterpret_cast<std::uintptr_t>(
-                        switch_view.active_graph_value().view().data()));
-                    if (lifecycle != nullptr)
-                    {
-                        lifecycle->push_back(NestedLifecycleCounters::snapshot());
-                    }
+                    inspect(node, node.as<SwitchNodeView>());
                     return;
                 }
             }
-            throw std::logic_error("switch_storage_recorder could not find a switch node");
+            throw std::logic_error("switch_inspector could not find a switch node");
         };
 
         NodeBuilder builder = NodeBuilder::native(
             std::move(meta), std::move(callbacks),
             TSEndpointSchema::non_peered(input_schema, std::move(endpoints)));
         const std::array<WiringPortRef, 2> inputs{switch_output, key};
-        static_cast<void>(w.add_node(std::type_index(typeid(SwitchStorageRecorderTag)),
+        static_cast<void>(w.add_node(std::type_index(typeid(SwitchInspectorTag)),
                                      std::move(builder), inputs, Value{}));
     }
 
+    void wire_switch_storage_recorder(Wiring &w,
+                                      const WiringPortRef &switch_output,
+                                      const WiringPortRef &key,
+                                      std::vector<std::size_t> &stored_counts,
+                                      std::vector<std::uintptr_t> &active_addresses,
+                                      std::vector<NestedLifecycleSnapshot> *lifecycle = nullptr)
+    {
+        wire_switch_inspector(
+            w, switch_output, key,
+            [&stored_counts, &active_addresses, lifecycle](const NodeView &, SwitchNodeView switch_view) {
+                stored_counts.push_back(switch_view.stored_graph_count());
+                active_addresses.push_back(reinterpret_cast<std::uintptr_t>(
+                    switch_view.active_graph_value().view().data()));
+                if (lifecycle != nullptr)
+                {
+                    lifecycle->push_back(NestedLifecycleCounters::snapshot());
+                }
+            });
+    }
+
+    /** What ``SwitchNodeView`` and the node's storage metrics report after one tick. */
+    struct WarmSwitchSample
+    {
+        std::size_t        warm_count{0};
+        std::size_t        warm_capacity{0};
+        std::size_t        warm_bytes{0};
+        std::size_t        warm_restarts{0};
+        NodeStorageMetrics storage{};
+    };
+
+    // Keeps a 64-slot window, so its graph holds dynamic node storage.
+    struct WindowedAddOne
+    {
+        static constexpr auto name = "windowed_add_one";
+        static Port<TS<Int>>  compose(Wiring &w, Port<TS<Int>> ts)
+        {
+            using namespace hgraph::stdlib::syntax;
+            static_cast<void>(wire<stdlib::to_window>(w, ts, Int{64}, Int{1}));
+            return (ts + Int{1}).as<TS<Int>>();
+        }
+    };
+
     using Issue38Dict = TSD<Str, TS<Int>>;
     using Issue38Position =
         TSB<"Issue38Position", Field<"units", Issue38Dict>, Field<"unit_values", Issue38Dict>>;
@@ -824,6 +860,140 @@ TEST_CASE("switch_: alternating branches reuse two fixed graph addresses")
     CHECK(NestedLifecycleCounters::snapshot() == NestedLifecycleSnapshot{3, 0, 3, 3, 3});
 }
 
+TEST_CASE("switch_: a warm branch is restarted with its node state")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    // With one warm branch, returning to the counter restarts the graph it
+    // was stopped in, so the count carries on from 2.
+    CHECK_OUTPUT(eval_node<stdlib::switch_>(
+                     values<Str>(Str{"c"}, none, Str{"d"}, Str{"c"}),
+                     stdlib::switch_cases({{Value{Str{"c"}}, fn<CounterNode>()}, {Value{Str{"d"}}, fn<Doubler>()}})
+                         .warm(1),
+                     values<Int>(5, 6, 7, 8)),
+                 values<Int>(1, 2, 14, 3));
+}
+
+TEST_CASE("switch_: warm branches restart in place instead of being rebuilt")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+    NestedLifecycleCounters::reset();
+
+    std::vector<std::size_t>    stored_counts;
+    std::vector<std::uintptr_t> active_addresses;
+    std::vector<NestedLifecycleSnapshot> lifecycle;
+    Wiring                      w;
+    auto key = wire<stdlib::replay_impl, TS<Str>>(w, Str{"key"});
+    auto source = wire<stdlib::replay_impl, TS<Int>>(w, Str{"source"});
+    auto switched = wire<stdlib::switch_>(
+                        w, key,
+                        stdlib::switch_cases({{Value{Str{"a"}}, fn<NestedLifecycleNode>()},
+                                              {Value{Str{"b"}}, fn<NestedLifecycleNode>()}})
+                            .warm(1),
+                        source)
+                        .as<TS<Int>>();
+    wire_switch_storage_recorder(w, switched.erased(), key.erased(), stored_counts,
+                                 active_addresses, &lifecycle);
+
+    GraphBuilder gb = std::move(w).finish();
+    set_replay_values(gb.global_state(), "key",
+                      values<Str>(Str{"a"}, Str{"b"}, Str{"a"}, Str{"b"}));
+    set_replay_values(gb.global_state(), "source", values<Int>(1, 2, 3, 4));
+
+    {
+        GraphExecutorBuilder eb;
+        eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+        GraphExecutorValue ex = eb.make_executor();
+        ex.view().run();
+
+        // Two graphs are ever built; each switch back only restarts one.
+        CHECK(lifecycle == std::vector<NestedLifecycleSnapshot>{
+                               {1, 1, 1, 0, 0},
+                               {2, 2, 2, 1, 0},
+                               {2, 2, 3, 2, 0},
+                               {2, 2, 4, 3, 0},
+                           });
+    }
+
+    REQUIRE(stored_counts == std::vector<std::size_t>{1, 2, 2, 2});
+    REQUIRE(active_addresses.size() == 4);
+    CHECK(active_addresses[0] != active_addresses[1]);
+    CHECK(active_addresses[0] == active_addresses[2]);
+    CHECK(active_addresses[1] == active_addresses[3]);
+    CHECK(NestedLifecycleCounters::snapshot() == NestedLifecycleSnapshot{2, 0, 4, 4, 2});
+}
+
+TEST_CASE("switch_: warm branches are counted in the node's storage metrics")
+{
+    using namespace hgraph;
+    stdlib::register_standard_operators();
+
+    std::vector<WarmSwitchSample> samples;
+    Wiring                        w;
+    auto key = wire<stdlib::replay_impl, TS<Str>>(w, Str{"key"});
+    auto source = wire<stdlib::replay_impl, TS<Int>>(w, Str{"source"});
+    auto switched = wire<stdlib::switch_>(
+                        w, key,
+                        stdlib::switch_cases({{Value{Str{"a"}}, fn<WindowedAddOne>()},
+                                              {Value{Str{"b"}}, fn<WindowedAddOne>()},
+                                              {Value{Str{"c"}}, fn<WindowedAddOne>()}})
+                            .warm(1),
+                        source)
+                        .as<TS<Int>>();
+    wire_switch_inspector(w, switched.erased(), key.erased(),
+                          [&samples](const NodeView &node, SwitchNodeView switch_view) {
+                              samples.push_back(WarmSwitchSample{
+                                  .warm_count    = switch_view.warm_graph_count(),
+                                  .warm_capacity = switch_view.warm_graph_capacity(),
+                                  .warm_bytes    = switch_view.warm_graph_bytes(),
+                                  .warm_restarts = switch_view.warm_restart_count(),
+                                  .storage       = node.storage_metrics(),
+                              });
+                          });
+
+    GraphBuilder gb = std::move(w).finish();
+    set_replay_values(gb.global_state(), "key",
+                      values<Str>(Str{"a"}, Str{"b"}, Str{"a"}, Str{"c"}));
+    set_replay_values(gb.global_state(), "source", values<Int>(1, 2, 3, 4));
+
+    GraphExecutorBuilder eb;
+    eb.graph_builder(std::move(gb)).start_time(MIN_ST).end_time(MIN_ST + TimeDelta{10});
+    GraphExecutorValue ex = eb.make_executor();
+    ex.view().run();
+
+    // a; b with a warm; a restarted with b warm; c built, a kept and b evicted.
+    REQUIRE(samples.size() == 4);
+    const std::array<std::size_t, 4> warm_counts{0, 1, 1, 1};
+    const std::array<std::size_t, 4> restarts{0, 0, 1, 1};
+    for (std::size_t tick = 0; tick < samples.size(); ++tick)
+    {
+        INFO("tick " << tick);
+        CHECK(samples[tick].warm_count == warm_counts[tick]);
+        CHECK(samples[tick].warm_capacity == 1);
+        CHECK(samples[tick].warm_restarts == restarts[tick]);
+        CHECK(samples[tick].storage.nested_graph_capacity == 3);
+    }
+    CHECK(samples[0].warm_bytes == 0);
+    CHECK(samples[1].storage.nested_graph_count == 2);
+
+    // A warm graph's window is reported as the switch's dynamic storage, and
+    // warm_graph_bytes adds the graph's in-place storage on top of it.
+    const NodeStorageMetrics &cold = samples[0].storage;
+    for (std::size_t tick = 1; tick < samples.size(); ++tick)
+    {
+        INFO("tick " << tick);
+        const NodeStorageMetrics &warm = samples[tick].storage;
+        CHECK(warm.dynamic_reserved_bytes > cold.dynamic_reserved_bytes);
+        CHECK(warm.dynamic_live_bytes >= cold.dynamic_live_bytes);
+        CHECK(samples[tick].warm_bytes > warm.dynamic_live_bytes - cold.dynamic_live_bytes);
+        CHECK(warm.dynamic_reserved_bytes == samples[1].storage.dynamic_reserved_bytes);
+    }
+    // The last warm graph is a, whose window holds two ticks to b's one.
+    CHECK(samples[3].warm_bytes > samples[2].warm_bytes);
+}
+
 TEST_CASE("switch_: reload_on_ticked rebuilds the branch on every key tick")
 {
     using namespace hgraph;
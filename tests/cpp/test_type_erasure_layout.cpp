@@ -96,7 +96,8 @@ TEST_CASE("current type-erasure records retain their baseline layouts")
 #if defined(__APPLE__) && defined(__aarch64__)
     // 272 -> 280: heterogeneous realized keys store the value binding
     // (m_value_binding) so keys hash/compare through the bound ValueOps.
-    static_assert(sizeof(KeySlotStore) <= 280);
+    // 280 -> 312: the inline key kind and the cached string-key hashes.
+    static_assert(sizeof(KeySlotStore) <= 312);
     static_assert(sizeof(KeyMirroredValueSlotStore) <= 208);
     static_assert(sizeof(TSDProxySlotSync) <= 24);
     static_assert(sizeof(TSDProxy) <= 400);
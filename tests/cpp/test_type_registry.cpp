@@ -782,6 +782,27 @@ TEST_CASE("KeySlotStore supports heterogeneous realized value lookup") {
   REQUIRE(canonical_store.size() == 1);
 }
 
+TEST_CASE("KeySlotStore selects inline hashing from a scalar binding") {
+  using namespace hgraph;
+  auto &registry = TypeRegistry::instance();
+  const auto *text = registry.value_type("str");
+  REQUIRE(text != nullptr);
+
+  const auto binding = ValuePlanFactory::instance().type_for(text);
+  KeySlotStore store{binding};
+  REQUIRE(store.key_kind() == KeySlotKeyKind::Str);
+
+  const Value alpha{Str{"alpha"}};
+  const Value beta{Str{"beta"}};
+  const auto inserted = store.insert(alpha.view());
+  REQUIRE(inserted.inserted);
+  REQUIRE(store.insert(beta.view()).inserted);
+  CHECK(store.find_slot(alpha.view()) == inserted.slot);
+  CHECK(store.find_slot(Str{"alpha"}) == inserted.slot);
+  CHECK_FALSE(store.insert(Str{"beta"}).inserted);
+  CHECK(store.size() == 2);
+}
+
 TEST_CASE("closed unions convert alternatives between realization snapshots") {
   using namespace hgraph;
   auto &registry = TypeRegistry::instance();
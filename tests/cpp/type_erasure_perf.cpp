@@ -2,8 +2,10 @@
 #include <hgraph/lib/std/value_util.h>
 #include <hgraph/lib/testing/eval_node.h>
 #include <hgraph/lib/testing/mock_runtime.h>
+#include <hgraph/runtime/allocation_hooks.h>
 #include <hgraph/runtime/global_state.h>
 #include <hgraph/runtime/mesh_node.h>
+#include <hgraph/runtime/node_scheduler.h>
 #include <hgraph/runtime/reduce_node.h>
 #include <hgraph/runtime/runtime.h>
 #include <hgraph/types/metadata/type_realization.h>
@@ -13,6 +15,7 @@
 #include <hgraph/types/temporal.h>
 #include <hgraph/types/time_series/ts_output.h>
 #include <hgraph/types/time_series/visitor.h>
+#include <hgraph/types/utils/key_slot_store.h>
 #include <hgraph/types/value/compound_scalar_storage.h>
 #include <hgraph/types/value/value_builder.h>
 #include <hgraph/types/value/visitor.h>
@@ -27,7 +30,6 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
-#include <new>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -35,79 +37,23 @@
 #include <utility>
 #include <vector>
 
-#if defined(_MSC_VER)
-#include <malloc.h>
-#endif
-
 namespace
 {
-    std::atomic<bool> g_count_allocations{false};
-    std::atomic<std::size_t> g_allocations{0};
-    std::atomic<std::size_t> g_allocated_bytes{0};
     std::atomic<const hgraph::ValueView *> g_atomic_value_view_input{nullptr};
     std::atomic<const hgraph::TSOutputView *> g_atomic_ts_output_view_input{nullptr};
     volatile std::uint64_t g_retained_value{0};
     std::uint64_t g_graph_observation{0};
 
-    void record_allocation(std::size_t size) noexcept
-    {
-        if (g_count_allocations.load(std::memory_order_relaxed))
-        {
-            g_allocations.fetch_add(1, std::memory_order_relaxed);
-            g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
-        }
-    }
-
-    [[nodiscard]] void *allocate_unaligned(std::size_t size)
-    {
-        const std::size_t actual_size = std::max<std::size_t>(size, 1);
-        if (void *memory = std::malloc(actual_size))
-        {
-            return memory;
-        }
-        throw std::bad_alloc{};
-    }
-
-    [[nodiscard]] void *allocate_aligned(std::size_t size, std::size_t alignment)
-    {
-        const std::size_t actual_size = std::max<std::size_t>(size, 1);
-#if defined(_MSC_VER)
-        if (void *memory = _aligned_malloc(actual_size, alignment))
-        {
-            return memory;
-        }
-#else
-        void *memory = nullptr;
-        if (posix_memalign(&memory, alignment, actual_size) == 0)
-        {
-            return memory;
-        }
-#endif
-        throw std::bad_alloc{};
-    }
-
-    void free_aligned(void *memory) noexcept
-    {
-#if defined(_MSC_VER)
-        _aligned_free(memory);
-#else
-        std::free(memory);
-#endif
-    }
-
+    /** Allocations made on this thread since the scope opened, counted by
+        the replacement allocator of ``allocation_hooks.h``. */
     struct AllocationScope
     {
-        AllocationScope()
+        [[nodiscard]] hgraph::AllocationCount counted() const noexcept
         {
-            g_allocations.store(0, std::memory_order_relaxed);
-            g_allocated_bytes.store(0, std::memory_order_relaxed);
-            g_count_allocations.store(true, std::memory_order_relaxed);
+            return hgraph::thread_allocation_count() - started;
         }
 
-        ~AllocationScope()
-        {
-            g_count_allocations.store(false, std::memory_order_relaxed);
-        }
+        hgraph::AllocationCount started{hgraph::thread_allocation_count()};
     };
 
     struct Sample
@@ -163,6 +109,20 @@ namespace
         return median(std::move(deviations));
     }
 
+    /** Ops routing a key store through ``ValueOps``, as a binding-bound store did before inline kinds. */
+    [[nodiscard]] hgraph::KeySlotStoreOps erased_key_slot_ops(const hgraph::ValueOps &ops) noexcept
+    {
+        return hgraph::KeySlotStoreOps{
+            .hash = [](const void *key, const void *context) {
+                return static_cast<const hgraph::ValueOps *>(context)->hash(key);
+            },
+            .equal = [](const void *lhs, const void *rhs, const void *context) {
+                return static_cast<const hgraph::ValueOps *>(context)->equals(lhs, rhs);
+            },
+            .context = &ops,
+        };
+    }
+
     [[nodiscard]] bool benchmark_selected(std::string_view name) noexcept
     {
         const char *filter = std::getenv("HGRAPH_TYPE_ERASURE_PERF_FILTER");
@@ -221,8 +181,8 @@ namespace
                 results.push_back(Sample{
                     .elapsed_ns =
                         std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count(),
-                    .allocations = g_allocations.load(std::memory_order_relaxed),
-                    .allocated_bytes = g_allocated_bytes.load(std::memory_order_relaxed),
+                    .allocations = static_cast<std::size_t>(allocations.counted().allocations),
+                    .allocated_bytes = static_cast<std::size_t>(allocations.counted().bytes),
                     .checksum = checksum,
                 });
             }
@@ -274,16 +234,13 @@ namespace
     {
         retain(operation());
         std::uint64_t checksum = 0;
+        const AllocationScope scope;
+        for (std::size_t index = 0; index < iterations; ++index)
         {
-            AllocationScope allocations;
-            for (std::size_t index = 0; index < iterations; ++index)
-            {
-                checksum += operation();
-            }
+            checksum += operation();
         }
+        const auto allocations = scope.counted().allocations;
         retain(checksum);
-        const auto allocations =
-            g_allocations.load(std::memory_order_relaxed);
         if (allocations != 0)
         {
             throw std::runtime_error(
@@ -444,127 +401,6 @@ namespace
     };
 }  // namespace
 
-void *operator new(std::size_t size)
-{
-    record_allocation(size);
-    return allocate_unaligned(size);
-}
-
-void *operator new[](std::size_t size)
-{
-    record_allocation(size);
-    return allocate_unaligned(size);
-}
-
-void *operator new(std::size_t size, std::align_val_t alignment)
-{
-    record_allocation(size);
-    return allocate_aligned(size, static_cast<std::size_t>(alignment));
-}
-
-void *operator new[](std::size_t size, std::align_val_t alignment)
-{
-    record_allocation(size);
-    return allocate_aligned(size, static_cast<std::size_t>(alignment));
-}
-
-void *operator new(std::size_t size, const std::nothrow_t &) noexcept
-{
-    try
-    {
-        return ::operator new(size);
-    }
-    catch (...)
-    {
-        return nullptr;
-    }
-}
-
-void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
-{
-    try
-    {
-        return ::operator new[](size);
-    }
-    catch (...)
-    {
-        return nullptr;
-    }
-}
-
-void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
-{
-    try
-    {
-        return ::operator new(size, alignment);
-    }
-    catch (...)
-    {
-        return nullptr;
-    }
-}
-
-void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
-{
-    try
-    {
-        return ::operator new[](size, alignment);
-    }
-    catch (...)
-    {
-        return nullptr;
-    }
-}
-
-void operator delete(void *memory) noexcept
-{
-    std::free(memory);
-}
-void operator delete[](void *memory) noexcept
-{
-    std::free(memory);
-}
-void operator delete(void *memory, std::size_t) noexcept
-{
-    std::free(memory);
-}
-void operator delete[](void *memory, std::size_t) noexcept
-{
-    std::free(memory);
-}
-void operator delete(void *memory, const std::nothrow_t &) noexcept
-{
-    std::free(memory);
-}
-void operator delete[](void *memory, const std::nothrow_t &) noexcept
-{
-    std::free(memory);
-}
-void operator delete(void *memory, std::align_val_t) noexcept
-{
-    free_aligned(memory);
-}
-void operator delete[](void *memory, std::align_val_t) noexcept
-{
-    free_aligned(memory);
-}
-void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
-{
-    free_aligned(memory);
-}
-void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept
-{
-    free_aligned(memory);
-}
-void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept
-{
-    free_aligned(memory);
-}
-void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept
-{
-    free_aligned(memory);
-}
-
 int main()
 {
     using namespace hgraph;
@@ -787,6 +623,148 @@ int main()
             }
         });
 
+    // Scheduler churn: a node re-arming a fixed set of tags (throttles,
+    // heartbeats) and a node firing a burst of untagged timers per cycle.
+    // Both reuse one state, so once warm neither may allocate.
+    std::vector<std::string> scheduler_tags;
+    for (int index = 0; index < 32; ++index)
+    {
+        scheduler_tags.push_back("tag" + std::to_string(index));
+    }
+    NodeSchedulerState tagged_scheduler_state;
+    const auto tagged_reschedule_operation = [&] {
+        const NodeScheduler scheduler{
+            tagged_scheduler_state, nullptr, 0, MIN_ST};
+        for (std::size_t index = 0; index < scheduler_tags.size(); ++index)
+        {
+            scheduler.schedule(
+                MIN_ST + TimeDelta{1 + static_cast<int>((index * 7) % 32)},
+                std::string_view{scheduler_tags[index]});
+        }
+        for (std::size_t index = 0; index < scheduler_tags.size(); index += 2)
+        {
+            scheduler.un_schedule(scheduler_tags[index]);
+        }
+        return static_cast<std::uint64_t>(
+            tagged_scheduler_state.size() +
+            (scheduler.next_scheduled_time() - MIN_ST).count());
+    };
+    require_no_allocations(
+        "node_scheduler_tagged_reschedule", 10'000,
+        tagged_reschedule_operation);
+    run_benchmark(
+        "node_scheduler_tagged_reschedule", 50'000, samples, warmup,
+        tagged_reschedule_operation,
+        [](std::uint64_t value) {
+            if (value != 16 + 2)
+            {
+                throw std::runtime_error(
+                    "node scheduler tagged reschedule failed");
+            }
+        });
+
+    NodeSchedulerState untagged_scheduler_state;
+    const auto untagged_churn_operation = [&] {
+        const NodeScheduler scheduler{
+            untagged_scheduler_state, nullptr, 0, MIN_ST};
+        for (int index = 0; index < 32; ++index)
+        {
+            scheduler.schedule(
+                MIN_ST + TimeDelta{1 + (index * 13) % 32});
+        }
+        scheduler.schedule(TimeDelta{40}, "_next");
+        const auto pending = untagged_scheduler_state.size();
+        NodeScheduler{untagged_scheduler_state, nullptr, 0,
+                      MIN_ST + TimeDelta{32}}
+            .advance();
+        return static_cast<std::uint64_t>(
+            pending * 100 + untagged_scheduler_state.size());
+    };
+    require_no_allocations(
+        "node_scheduler_untagged_churn", 10'000,
+        untagged_churn_operation);
+    run_benchmark(
+        "node_scheduler_untagged_churn", 50'000, samples, warmup,
+        untagged_churn_operation,
+        [](std::uint64_t value) {
+            if (value != 33 * 100 + 1)
+            {
+                throw std::runtime_error(
+                    "node scheduler untagged churn failed");
+            }
+        });
+
+    // Keyed lookup: the same 1,024 keys found through the ValueOps
+    // indirection and through the store's inline kind, then half of them
+    // removed, erased and reinserted.
+    constexpr std::size_t key_store_count = 1024;
+    std::vector<Int> int_store_keys;
+    std::vector<Str> str_store_keys;
+    int_store_keys.reserve(key_store_count);
+    str_store_keys.reserve(key_store_count);
+    for (std::size_t index = 0; index < key_store_count; ++index)
+    {
+        int_store_keys.push_back(static_cast<Int>(index * 7919));
+        str_store_keys.push_back("instrument." + std::to_string(index * 7919));
+    }
+    constexpr auto key_store_slot_sum = static_cast<std::uint64_t>(key_store_count * (key_store_count - 1) / 2);
+    const auto run_key_store_benchmarks = [&](std::string_view kind, const auto &keys, KeySlotStore &store) {
+        for (const auto &key : keys) { static_cast<void>(store.insert(key)); }
+        run_benchmark(
+            std::string{"key_slot_store_"} + std::string{kind} + "_find", 2'000, samples, warmup,
+            [&] {
+                std::uint64_t slots = 0;
+                for (const auto &key : keys) { slots += store.find_slot(key); }
+                return slots;
+            },
+            [&](std::uint64_t value) {
+                if (value != key_store_slot_sum)
+                {
+                    throw std::runtime_error(std::string{"key store find checksum failed: "} + std::string{kind});
+                }
+            });
+        run_benchmark(
+            std::string{"key_slot_store_"} + std::string{kind} + "_churn", 2'000, samples, warmup,
+            [&] {
+                for (std::size_t index = 0; index < keys.size(); index += 2)
+                {
+                    static_cast<void>(store.remove(keys[index]));
+                }
+                store.erase_pending();
+                for (std::size_t index = 0; index < keys.size(); index += 2)
+                {
+                    static_cast<void>(store.insert(keys[index]));
+                }
+                return static_cast<std::uint64_t>(store.size());
+            },
+            [&](std::uint64_t value) {
+                if (value != keys.size())
+                {
+                    throw std::runtime_error(std::string{"key store churn checksum failed: "} + std::string{kind});
+                }
+            });
+    };
+    {
+        KeySlotStore erased{MemoryUtils::plan_for<Int>(), erased_key_slot_ops(ops_for<Int>())};
+        KeySlotStore inlined{MemoryUtils::plan_for<Int>(), key_slot_store_ops_for<Int>()};
+        if (erased.key_kind() != KeySlotKeyKind::Erased || inlined.key_kind() != KeySlotKeyKind::Int)
+        {
+            throw std::runtime_error("int key store benchmark did not select the expected key kinds");
+        }
+        run_key_store_benchmarks("int_erased", int_store_keys, erased);
+        run_key_store_benchmarks("int_inline", int_store_keys, inlined);
+    }
+    {
+        KeySlotStore erased{MemoryUtils::plan_for<Str>(), erased_key_slot_ops(ops_for<Str>())};
+        KeySlotStore inlined{MemoryUtils::plan_for<Str>(), key_slot_store_ops_for<Str>()};
+        if (erased.key_kind() != KeySlotKeyKind::Erased || inlined.key_kind() != KeySlotKeyKind::Str)
+        {
+            throw std::runtime_error("str key store benchmark did not select the expected key kinds");
+        }
+        run_key_store_benchmarks("str_erased", str_store_keys, erased);
+        run_key_store_benchmarks("str_inline", str_store_keys, inlined);
+    }
+
     run_benchmark(
         "atomic_value_read", 200000, samples, warmup,
         [&] {